@@ -20,15 +20,15 @@
 #include "../synthesizer/modSynth.h"
 
 int res_amp;
-mod_synth_settings_int_param_t int_param_amp;
+int int_value_amp;
 
 int mod_synth_get_active_ch_1_level() 
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch1.level", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH1_LEVEL, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -38,11 +38,11 @@ int mod_synth_get_active_ch_1_level()
 
 int mod_synth_get_active_ch_1_pan() 
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch1.pan", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH1_PAN, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -52,11 +52,11 @@ int mod_synth_get_active_ch_1_pan()
 
 int mod_synth_get_active_ch_1_pan_mod_lfo() 
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch1.pan_modulation_lfo_num", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH1_PAN_MODULATION_LFO_NUM, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -66,11 +66,11 @@ int mod_synth_get_active_ch_1_pan_mod_lfo()
 
 int mod_synth_get_active_ch_1_pan_mod_lfo_level() 
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch1.pan_modulation_lfo_level", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH1_PAN_MODULATION_LFO_LEVEL, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -78,11 +78,11 @@ int mod_synth_get_active_ch_1_pan_mod_lfo_level()
 	}
 }
 int mod_synth_get_active_ch_1_send() {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch1.send", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH1_SEND, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -92,11 +92,11 @@ int mod_synth_get_active_ch_1_send() {
 
 int mod_synth_get_active_ch_2_level()
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch2.level", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH2_LEVEL, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -106,11 +106,11 @@ int mod_synth_get_active_ch_2_level()
 
 int mod_synth_get_active_ch_2_pan()
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch2.pan", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH2_PAN, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -120,11 +120,11 @@ int mod_synth_get_active_ch_2_pan()
 
 int mod_synth_get_active_ch_2_pan_mod_lfo()
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch2.pan_modulation_lfo_num", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH2_PAN_MODULATION_LFO_NUM, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -134,11 +134,11 @@ int mod_synth_get_active_ch_2_pan_mod_lfo()
 
 int mod_synth_get_active_ch_2_pan_mod_lfo_level()
 {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch2.pan_modulation_lfo_level", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH2_PAN_MODULATION_LFO_LEVEL, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
@@ -146,11 +146,11 @@ int mod_synth_get_active_ch_2_pan_mod_lfo_level()
 	}
 }
 int mod_synth_get_active_ch_2_send() {
-	res_amp = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.amp_ch2.send", &int_param_amp);
+	res_amp = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_AMP_CH2_SEND, &int_value_amp);
 	if (res_amp == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_amp.value;
+		return int_value_amp;
 	}
 	else
 	{
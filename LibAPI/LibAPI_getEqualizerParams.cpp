@@ -17,17 +17,17 @@
 #include "LibAPI_settingsManager.h"
 
 int res_equi;
-mod_synth_settings_int_param_t int_param_equi;
+int int_value_equi;
 
 #include "../synthesizer/modSynth.h"
 
 int mod_synth_get_active_equilizer_band31_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_31_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_31_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -37,11 +37,11 @@ int mod_synth_get_active_equilizer_band31_level()
 
 int mod_synth_get_active_equilizer_band62_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_62_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_62_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -51,11 +51,11 @@ int mod_synth_get_active_equilizer_band62_level()
 
 int mod_synth_get_active_equilizer_band125_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_125_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_125_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -65,11 +65,11 @@ int mod_synth_get_active_equilizer_band125_level()
 
 int mod_synth_get_active_equilizer_band250_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_250_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_250_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -79,11 +79,11 @@ int mod_synth_get_active_equilizer_band250_level()
 
 int mod_synth_get_active_equilizer_band500_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_500_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_500_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -93,11 +93,11 @@ int mod_synth_get_active_equilizer_band500_level()
 
 int mod_synth_get_active_equilizer_band1k_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_1k_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_1K_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -107,11 +107,11 @@ int mod_synth_get_active_equilizer_band1k_level()
 
 int mod_synth_get_active_equilizer_band2k_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_2k_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_2K_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -121,11 +121,11 @@ int mod_synth_get_active_equilizer_band2k_level()
 
 int mod_synth_get_active_equilizer_band4k_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_4k_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_4K_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -135,11 +135,11 @@ int mod_synth_get_active_equilizer_band4k_level()
 
 int mod_synth_get_active_equilizer_band8k_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_8k_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_8K_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -149,11 +149,11 @@ int mod_synth_get_active_equilizer_band8k_level()
 
 int mod_synth_get_active_equilizer_band16k_level() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.band_16k_level", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_BAND_16K_LEVEL, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -163,11 +163,11 @@ int mod_synth_get_active_equilizer_band16k_level()
 
 int mod_synth_get_active_equilizer_preset() 
 {
-	res_equi = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.equilizer.preset", &int_param_equi);
+	res_equi = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_EQUILIZER_PRESET, &int_value_equi);
 	if (res_equi == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_equi.value;
+		return int_value_equi;
 	}
 	else
 	{
@@ -19,16 +19,16 @@
 #include "../synthesizer/modSynth.h"
 
 int res_kps;
-mod_synth_settings_int_param_t int_param_kps;
-mod_synth_settings_bool_param_t bool_param_kps;
+int int_value_kps;
+bool bool_value_kps;
 
 bool mod_synth_get_active_karplus_enable_state()
 {
-	res_kps = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.enabled", &bool_param_kps);
+	res_kps = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_ENABLED, &bool_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_kps.value;
+		return bool_value_kps;
 	}
 	else
 	{
@@ -38,11 +38,11 @@ bool mod_synth_get_active_karplus_enable_state()
 
 int mod_synth_get_active_karplus_excitation_waveform_type()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.excitation_waveform_type", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_EXCITATION_WAVEFORM_TYPE, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -52,12 +52,12 @@ int mod_synth_get_active_karplus_excitation_waveform_type()
 
 int mod_synth_get_active_karplus_excitation_waveform_variations()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.excitation_waveform_variations",
-		&int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_EXCITATION_WAVEFORM_VARIATIONS,
+		&int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -67,11 +67,11 @@ int mod_synth_get_active_karplus_excitation_waveform_variations()
 
 int mod_synth_get_active_karplus_string_damping_calculation_mode()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.string_damping_calculation_mode", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_STRING_DAMPING_CALCULATION_MODE, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -81,11 +81,11 @@ int mod_synth_get_active_karplus_string_damping_calculation_mode()
 
 int mod_synth_get_active_karplus_string_damping()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.string_damping", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_STRING_DAMPING, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -95,11 +95,11 @@ int mod_synth_get_active_karplus_string_damping()
 
 int mod_synth_get_active_karplus_pluck_damping()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.pluck_damping", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_PLUCK_DAMPING, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -110,11 +110,11 @@ int mod_synth_get_active_karplus_pluck_damping()
 
 int mod_synth_get_active_karplus_string_on_decay()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.on_decay", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_ON_DECAY, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -124,11 +124,11 @@ int mod_synth_get_active_karplus_string_on_decay()
 
 int mod_synth_get_active_karplus_string_off_decay()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.off_decay", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_OFF_DECAY, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -138,11 +138,11 @@ int mod_synth_get_active_karplus_string_off_decay()
 
 int mod_synth_get_active_karplus_string_damping_variation()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.string_damping_variations", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_STRING_DAMPING_VARIATIONS, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -152,11 +152,11 @@ int mod_synth_get_active_karplus_string_damping_variation()
 
 int mod_synth_get_active_karplus_pluck_damping_variation()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.pluck_damping_variations", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_PLUCK_DAMPING_VARIATIONS, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -166,11 +166,11 @@ int mod_synth_get_active_karplus_pluck_damping_variation()
 
 int mod_synth_get_active_karplus_send_filter_1()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.send_filter_1", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_SEND_FILTER_1, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
@@ -180,11 +180,11 @@ int mod_synth_get_active_karplus_send_filter_1()
 
 int mod_synth_get_active_karplus_send_filter_2()
 {
-	res_kps = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.karplus_synth.send_filter_2", &int_param_kps);
+	res_kps = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_KARPLUS_SYNTH_SEND_FILTER_2, &int_value_kps);
 	if (res_kps == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kps.value;
+		return int_value_kps;
 	}
 	else
 	{
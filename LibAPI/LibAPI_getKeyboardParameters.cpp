@@ -17,18 +17,18 @@
 #include "LibAPI_settingsManager.h"
 
 int res_kbd;
-mod_synth_settings_int_param_t int_param_kbd;
-mod_synth_settings_bool_param_t bool_param_kbd;
+int int_value_kbd;
+bool bool_value_kbd;
 
 #include "../synthesizer/modSynth.h"
 
 bool mod_synth_get_active_keyboard_portamento_enabled_state() 
 {
-	res_kbd = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.keyboard.portamento_state", &bool_param_kbd);
+	res_kbd = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_KEYBOARD_PORTAMENTO_STATE, &bool_value_kbd);
 	if (res_kbd == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_kbd.value;
+		return bool_value_kbd;
 	}
 	else
 	{
@@ -39,11 +39,11 @@ bool mod_synth_get_active_keyboard_portamento_enabled_state()
 
 int mod_synth_get_active_keyboard_portamento_level() 
 {
-	res_kbd = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.keyboard.portamento", &int_param_kbd);
+	res_kbd = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_KEYBOARD_PORTAMENTO, &int_value_kbd);
 	if (res_kbd == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kbd.value;
+		return int_value_kbd;
 	}
 	else
 	{
@@ -53,11 +53,11 @@ int mod_synth_get_active_keyboard_portamento_level()
 
 int mod_synth_get_active_keyboard_sensitivity() 
 {
-	res_kbd = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.keyboard.sensetivity", &int_param_kbd);
+	res_kbd = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_KEYBOARD_SENSETIVITY, &int_value_kbd);
 	if (res_kbd == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kbd.value;
+		return int_value_kbd;
 	}
 	else
 	{
@@ -67,11 +67,11 @@ int mod_synth_get_active_keyboard_sensitivity()
 
 int mod_synth_get_active_keyboard_sensitivity_low() 
 {
-	res_kbd = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.keyboard.sensetivity_low", &int_param_kbd);
+	res_kbd = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_KEYBOARD_SENSETIVITY_LOW, &int_value_kbd);
 	if (res_kbd == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kbd.value;
+		return int_value_kbd;
 	}
 	else
 	{
@@ -81,11 +81,11 @@ int mod_synth_get_active_keyboard_sensitivity_low()
 
 int mod_synth_get_active_keyboard_poly_mode() 
 {
-	res_kbd = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.keyboard.polyphonic_mode", &int_param_kbd);
+	res_kbd = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_KEYBOARD_POLYPHONIC_MODE, &int_value_kbd);
 	if (res_kbd == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kbd.value;
+		return int_value_kbd;
 	}
 	else
 	{
@@ -96,11 +96,11 @@ int mod_synth_get_active_keyboard_poly_mode()
 
 int mod_synth_get_active_keyboard_split_point()
 {
-	res_kbd = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.keyboard.split_point", &int_param_kbd);
+	res_kbd = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_KEYBOARD_SPLIT_POINT, &int_value_kbd);
 	if (res_kbd == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_kbd.value;
+		return int_value_kbd;
 	}
 	else
 	{
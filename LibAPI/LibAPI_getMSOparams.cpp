@@ -17,16 +17,16 @@
 #include "../synthesizer/modSynth.h"
 
 int res_mso;
-mod_synth_settings_int_param_t int_param_mso;
-mod_synth_settings_bool_param_t bool_param_mso;
+int int_value_mso;
+bool bool_value_mso;
 
 bool mod_synth_get_active_mso_enable_state()
 {
-	res_mso = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.enabled", &bool_param_mso);
+	res_mso = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_ENABLED, &bool_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_mso.value;
+		return bool_value_mso;
 	}
 	else
 	{
@@ -39,11 +39,11 @@ int mod_synth_get_active_mso_table_segment_point(int point)
 	switch (point)
 	{
 	case en_positions::pos_a:
-		res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.mso_synth.segment_position_a", &int_param_mso);
+		res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_A, &int_value_mso);
 		if (res_mso == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mso.value;
+			return int_value_mso;
 		}
 		else
 		{
@@ -51,11 +51,11 @@ int mod_synth_get_active_mso_table_segment_point(int point)
 		}
 
 	case en_positions::pos_b:
-		res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.mso_synth.segment_position_b", &int_param_mso);
+		res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_B, &int_value_mso);
 		if (res_mso == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mso.value;
+			return int_value_mso;
 		}
 		else
 		{
@@ -63,11 +63,11 @@ int mod_synth_get_active_mso_table_segment_point(int point)
 		}
 
 	case en_positions::pos_c:
-		res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.mso_synth.segment_position_c", &int_param_mso);
+		res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_C, &int_value_mso);
 		if (res_mso == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mso.value;
+			return int_value_mso;
 		}
 		else
 		{
@@ -75,11 +75,11 @@ int mod_synth_get_active_mso_table_segment_point(int point)
 		}
 
 	case en_positions::pos_d:
-		res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.mso_synth.segment_position_d", &int_param_mso);
+		res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_D, &int_value_mso);
 		if (res_mso == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mso.value;
+			return int_value_mso;
 		}
 		else
 		{
@@ -87,11 +87,11 @@ int mod_synth_get_active_mso_table_segment_point(int point)
 		}
 
 	case en_positions::pos_e:
-		res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.mso_synth.segment_position_e", &int_param_mso);
+		res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_E, &int_value_mso);
 		if (res_mso == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mso.value;
+			return int_value_mso;
 		}
 		else
 		{
@@ -99,11 +99,11 @@ int mod_synth_get_active_mso_table_segment_point(int point)
 		}
 
 	case en_positions::pos_f:
-		res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.mso_synth.segment_position_f", &int_param_mso);
+		res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_F, &int_value_mso);
 		if (res_mso == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mso.value;
+			return int_value_mso;
 		}
 		else
 		{
@@ -116,11 +116,11 @@ int mod_synth_get_active_mso_table_segment_point(int point)
 
 int mod_synth_get_active_mso_symetry()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.symmetry", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_SYMMETRY, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -131,11 +131,11 @@ int mod_synth_get_active_mso_symetry()
 
 int mod_synth_get_active_mso_pwm_percents()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.symmetry", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_SYMMETRY, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -145,11 +145,11 @@ int mod_synth_get_active_mso_pwm_percents()
 
 int mod_synth_get_active_mso_detune_octave()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.tune_offset_oct", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_TUNE_OFFSET_OCT, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -159,11 +159,11 @@ int mod_synth_get_active_mso_detune_octave()
 
 int mod_synth_get_active_mso_detune_semitones()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.tune_offset_semitones", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_TUNE_OFFSET_SEMITONES, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -173,11 +173,11 @@ int mod_synth_get_active_mso_detune_semitones()
 
 int mod_synth_get_active_mso_detune_cents()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.tune_offset_cents", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_TUNE_OFFSET_CENTS, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -187,11 +187,11 @@ int mod_synth_get_active_mso_detune_cents()
 
 int mod_synth_get_active_mso_send_filter_1()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.send_filter_1", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_SEND_FILTER_1, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -201,11 +201,11 @@ int mod_synth_get_active_mso_send_filter_1()
 
 int mod_synth_get_active_mso_send_filter_2()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.send_filter_2", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_SEND_FILTER_2, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -216,11 +216,11 @@ int mod_synth_get_active_mso_send_filter_2()
 
 int mod_synth_get_active_mso_freq_mod_lfo()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.freq_modulation_lfo_num", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_FREQ_MODULATION_LFO_NUM, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -230,11 +230,11 @@ int mod_synth_get_active_mso_freq_mod_lfo()
 
 int mod_synth_get_active_mso_freq_mod_lfo_level()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.freq_modulation_lfo_level", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_FREQ_MODULATION_LFO_LEVEL, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -244,11 +244,11 @@ int mod_synth_get_active_mso_freq_mod_lfo_level()
 
 int mod_synth_get_active_mso_freq_mod_env()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.freq_modulation_env_num", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_FREQ_MODULATION_ENV_NUM, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -258,11 +258,11 @@ int mod_synth_get_active_mso_freq_mod_env()
 
 int mod_synth_get_active_mso_freq_mod_env_level()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.freq_modulation_env_lev", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_FREQ_MODULATION_ENV_LEV, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -272,11 +272,11 @@ int mod_synth_get_active_mso_freq_mod_env_level()
 
 int mod_synth_get_active_mso_pwm_mod_lfo()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.pwm_modulation_lfo_num", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_PWM_MODULATION_LFO_NUM, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -286,11 +286,11 @@ int mod_synth_get_active_mso_pwm_mod_lfo()
 
 int mod_synth_get_active_mso_pwm_mod_lfo_level()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.pwm_modulation_lfo_level", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_PWM_MODULATION_LFO_LEVEL, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -300,11 +300,11 @@ int mod_synth_get_active_mso_pwm_mod_lfo_level()
 
 int mod_synth_get_active_mso_pwm_mod_env()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.pwm_modulation_env_num", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_PWM_MODULATION_ENV_NUM, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -314,11 +314,11 @@ int mod_synth_get_active_mso_pwm_mod_env()
 
 int mod_synth_get_active_mso_pwm_mod_env_level()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.pwm_modulation_env_level", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_PWM_MODULATION_ENV_LEVEL, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -328,11 +328,11 @@ int mod_synth_get_active_mso_pwm_mod_env_level()
 
 int mod_synth_get_active_mso_amp_mod_lfo()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.amp_modulation_lfo_num", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_AMP_MODULATION_LFO_NUM, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -342,11 +342,11 @@ int mod_synth_get_active_mso_amp_mod_lfo()
 
 int mod_synth_get_active_mso_amp_mod_lfo_level()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.amp_modulation_lfo_level", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_AMP_MODULATION_LFO_LEVEL, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -356,11 +356,11 @@ int mod_synth_get_active_mso_amp_mod_lfo_level()
 
 int mod_synth_get_active_mso_amp_mod_env()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.amp_modulation_env_num", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_AMP_MODULATION_ENV_NUM, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
@@ -370,11 +370,11 @@ int mod_synth_get_active_mso_amp_mod_env()
 
 int mod_synth_get_active_mso_amp_mod_env_level()
 {
-	res_mso = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.mso_synth.amp_modulation_env_level", &int_param_mso);
+	res_mso = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_MSO_SYNTH_AMP_MODULATION_ENV_LEVEL, &int_value_mso);
 	if (res_mso == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mso.value;
+		return int_value_mso;
 	}
 	else
 	{
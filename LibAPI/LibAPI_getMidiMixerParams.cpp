@@ -20,8 +20,7 @@
 int mod_synth_get_active_midi_mixer_setting_param(int paramid)
 {
 	int res_mixer;
-	mod_synth_settings_int_param_t int_param_mixer;
-	char keyString[128];
+	int int_value_mixer;
 
 	switch (paramid)
 	{
@@ -42,13 +41,12 @@ int mod_synth_get_active_midi_mixer_setting_param(int paramid)
 	case _MIXER_CHAN_15_LEVEL:
 	case _MIXER_CHAN_16_LEVEL:
 
-		sprintf(keyString, "adjsynth.mixer_channel_%i.level", paramid - _MIXER_CHAN_1_LEVEL + 1);
-		res_mixer = settings_manager->get_int_param(
+		res_mixer = settings_manager->get_int_param_value(
 			ModSynth::get_instance()->get_adj_synth()->get_active_settings_params(),
-			string(keyString), &int_param_mixer);
+			(settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_LEVEL + paramid - _MIXER_CHAN_1_LEVEL), &int_value_mixer);
 		if (res_mixer == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mixer.value;
+			return int_value_mixer;
 		}
 		else
 		{
@@ -74,13 +72,12 @@ int mod_synth_get_active_midi_mixer_setting_param(int paramid)
 	case _MIXER_CHAN_15_PAN:
 	case _MIXER_CHAN_16_PAN:
 
-		sprintf(keyString, "adjsynth.mixer_channel_%i.pan", paramid - _MIXER_CHAN_1_PAN + 1);
-		res_mixer = settings_manager->get_int_param(
+		res_mixer = settings_manager->get_int_param_value(
 			ModSynth::get_instance()->get_adj_synth()->get_active_settings_params(),
-			string(keyString), &int_param_mixer);
+			(settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_PAN + paramid - _MIXER_CHAN_1_PAN), &int_value_mixer);
 		if (res_mixer == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mixer.value;
+			return int_value_mixer;
 		}
 		else
 		{
@@ -106,13 +103,12 @@ int mod_synth_get_active_midi_mixer_setting_param(int paramid)
 	case _MIXER_CHAN_15_SEND:
 	case _MIXER_CHAN_16_SEND:
 
-		sprintf(keyString, "adjsynth.mixer_channel_%i.send", paramid - _MIXER_CHAN_1_SEND + 1);
-		res_mixer = settings_manager->get_int_param(
+		res_mixer = settings_manager->get_int_param_value(
 			ModSynth::get_instance()->get_adj_synth()->get_active_settings_params(),
-			string(keyString), &int_param_mixer);
+			(settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_SEND + paramid - _MIXER_CHAN_1_SEND), &int_value_mixer);
 		if (res_mixer == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_mixer.value;
+			return int_value_mixer;
 		}
 		else
 		{
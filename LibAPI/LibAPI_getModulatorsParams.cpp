@@ -17,15 +17,15 @@
 #include "../synthesizer/modSynth.h" // why AdjSynth unrecognized?
 
 int res_mod;
-mod_synth_settings_int_param_t int_param_mod;
+int int_value_mod;
 
 int mod_synth_get_active_env_mod_1_attack()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_1.attack", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_1_ATTACK, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -35,11 +35,11 @@ int mod_synth_get_active_env_mod_1_attack()
 
 int mod_synth_get_active_env_mod_1_decay()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_1.decay", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_1_DECAY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -49,11 +49,11 @@ int mod_synth_get_active_env_mod_1_decay()
 
 int mod_synth_get_active_env_mod_1_sustain()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_1.sustain", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_1_SUSTAIN, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -63,11 +63,11 @@ int mod_synth_get_active_env_mod_1_sustain()
 
 int mod_synth_get_active_env_mod_1_release()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_1.release", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_1_RELEASE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -78,11 +78,11 @@ int mod_synth_get_active_env_mod_1_release()
 
 int mod_synth_get_active_env_mod_2_attack()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_2.attack", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_2_ATTACK, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -92,11 +92,11 @@ int mod_synth_get_active_env_mod_2_attack()
 
 int mod_synth_get_active_env_mod_2_decay()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_2.decay", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_2_DECAY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -106,11 +106,11 @@ int mod_synth_get_active_env_mod_2_decay()
 
 int mod_synth_get_active_env_mod_2_sustain()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_2.sustain", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_2_SUSTAIN, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -120,11 +120,11 @@ int mod_synth_get_active_env_mod_2_sustain()
 
 int mod_synth_get_active_env_mod_2_release()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_2.release", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_2_RELEASE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -134,11 +134,11 @@ int mod_synth_get_active_env_mod_2_release()
 
 int mod_synth_get_active_env_mod_3_attack()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_3.attack", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_3_ATTACK, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -148,11 +148,11 @@ int mod_synth_get_active_env_mod_3_attack()
 
 int mod_synth_get_active_env_mod_3_decay()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_3.decay", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_3_DECAY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -162,11 +162,11 @@ int mod_synth_get_active_env_mod_3_decay()
 
 int mod_synth_get_active_env_mod_3_sustain()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_3.sustain", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_3_SUSTAIN, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -176,11 +176,11 @@ int mod_synth_get_active_env_mod_3_sustain()
 
 int mod_synth_get_active_env_mod_3_release()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_3.release", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_3_RELEASE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -190,11 +190,11 @@ int mod_synth_get_active_env_mod_3_release()
 
 int mod_synth_get_active_env_mod_4_attack()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_4.attack", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_4_ATTACK, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -204,11 +204,11 @@ int mod_synth_get_active_env_mod_4_attack()
 
 int mod_synth_get_active_env_mod_4_decay()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_4.decay", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_4_DECAY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -218,11 +218,11 @@ int mod_synth_get_active_env_mod_4_decay()
 
 int mod_synth_get_active_env_mod_4_sustain()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_4.sustain", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_4_SUSTAIN, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -232,11 +232,11 @@ int mod_synth_get_active_env_mod_4_sustain()
 
 int mod_synth_get_active_env_mod_4_release()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_4.release", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_4_RELEASE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -246,11 +246,11 @@ int mod_synth_get_active_env_mod_4_release()
 
 int mod_synth_get_active_env_mod_5_attack()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_5.attack", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_5_ATTACK, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -260,11 +260,11 @@ int mod_synth_get_active_env_mod_5_attack()
 
 int mod_synth_get_active_env_mod_5_decay()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_5.decay", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_5_DECAY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -274,11 +274,11 @@ int mod_synth_get_active_env_mod_5_decay()
 
 int mod_synth_get_active_env_mod_5_sustain()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_5.sustain", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_5_SUSTAIN, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -288,11 +288,11 @@ int mod_synth_get_active_env_mod_5_sustain()
 
 int mod_synth_get_active_env_mod_5_release()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.env_5.release", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_ENV_5_RELEASE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -303,11 +303,11 @@ int mod_synth_get_active_env_mod_5_release()
 
 int mod_synth_get_active_lfo_mod_1_waveform()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_1.waveform", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_1_WAVEFORM, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -317,11 +317,11 @@ int mod_synth_get_active_lfo_mod_1_waveform()
 
 int mod_synth_get_active_lfo_mod_1_symmetry()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_1.symmetry", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_1_SYMMETRY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -331,11 +331,11 @@ int mod_synth_get_active_lfo_mod_1_symmetry()
 
 int mod_synth_get_active_lfo_mod_1_rate()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_1.rate", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_1_RATE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -346,11 +346,11 @@ int mod_synth_get_active_lfo_mod_1_rate()
 
 int mod_synth_get_active_lfo_mod_2_waveform()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_2.waveform", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_2_WAVEFORM, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -360,11 +360,11 @@ int mod_synth_get_active_lfo_mod_2_waveform()
 
 int mod_synth_get_active_lfo_mod_2_symmetry()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_2.symmetry", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_2_SYMMETRY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -374,11 +374,11 @@ int mod_synth_get_active_lfo_mod_2_symmetry()
 
 int mod_synth_get_active_lfo_mod_2_rate()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_2.rate", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_2_RATE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -388,11 +388,11 @@ int mod_synth_get_active_lfo_mod_2_rate()
 
 int mod_synth_get_active_lfo_mod_3_waveform()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_3.waveform", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_3_WAVEFORM, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -402,11 +402,11 @@ int mod_synth_get_active_lfo_mod_3_waveform()
 
 int mod_synth_get_active_lfo_mod_3_symmetry()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_3.symmetry", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_3_SYMMETRY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -416,11 +416,11 @@ int mod_synth_get_active_lfo_mod_3_symmetry()
 
 int mod_synth_get_active_lfo_mod_3_rate()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_3.rate", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_3_RATE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -430,11 +430,11 @@ int mod_synth_get_active_lfo_mod_3_rate()
 
 int mod_synth_get_active_lfo_mod_4_waveform()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_4.waveform", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_4_WAVEFORM, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -444,11 +444,11 @@ int mod_synth_get_active_lfo_mod_4_waveform()
 
 int mod_synth_get_active_lfo_mod_4_symmetry()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_4.symmetry", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_4_SYMMETRY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -458,11 +458,11 @@ int mod_synth_get_active_lfo_mod_4_symmetry()
 
 int mod_synth_get_active_lfo_mod_4_rate()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_4.rate", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_4_RATE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -472,11 +472,11 @@ int mod_synth_get_active_lfo_mod_4_rate()
 
 int mod_synth_get_active_lfo_mod_5_waveform()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_5.waveform", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_5_WAVEFORM, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -486,11 +486,11 @@ int mod_synth_get_active_lfo_mod_5_waveform()
 
 int mod_synth_get_active_lfo_mod_5_symmetry()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_5.symmetry", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_5_SYMMETRY, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -500,11 +500,11 @@ int mod_synth_get_active_lfo_mod_5_symmetry()
 
 int mod_synth_get_active_lfo_mod_5_rate()
 {
-	res_mod = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.lfo_5.rate", &int_param_mod);
+	res_mod = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_LFO_5_RATE, &int_value_mod);
 	if (res_mod == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_mod.value;
+		return int_value_mod;
 	}
 	else
 	{
@@ -19,16 +19,16 @@
 #include "../synthesizer/modSynth.h"
 
 int res_noise;
-mod_synth_settings_int_param_t int_param_noise;
-mod_synth_settings_bool_param_t bool_param_noise;
+int int_value_noise;
+bool bool_value_noise;
 
 bool mod_synth_get_active_noise_enable_state()
 {
-	res_noise = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.enabled", &bool_param_noise);
+	res_noise = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_ENABLED, &bool_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_noise.value;
+		return bool_value_noise;
 	}
 	else
 	{
@@ -38,11 +38,11 @@ bool mod_synth_get_active_noise_enable_state()
 
 int mod_synth_get_active_noise_color()
 {
-	res_noise = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.color", &int_param_noise);
+	res_noise = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_COLOR, &int_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_noise.value;
+		return int_value_noise;
 	}
 	else
 	{
@@ -52,11 +52,11 @@ int mod_synth_get_active_noise_color()
 
 int mod_synth_get_active_noise_send_filter_1()
 {
-	res_noise = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.send_filter_1", &int_param_noise);
+	res_noise = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_SEND_FILTER_1, &int_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_noise.value;
+		return int_value_noise;
 	}
 	else
 	{
@@ -66,11 +66,11 @@ int mod_synth_get_active_noise_send_filter_1()
 
 int mod_synth_get_active_noise_send_filter_2()
 {
-	res_noise = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.send_filter_2", &int_param_noise);
+	res_noise = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_SEND_FILTER_2, &int_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_noise.value;
+		return int_value_noise;
 	}
 	else
 	{
@@ -80,11 +80,11 @@ int mod_synth_get_active_noise_send_filter_2()
 
 int mod_synth_get_active_noise_amp_mod_lfo()
 {
-	res_noise = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.amp_modulation_lfo_num", &int_param_noise);
+	res_noise = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_AMP_MODULATION_LFO_NUM, &int_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_noise.value;
+		return int_value_noise;
 	}
 	else
 	{
@@ -94,11 +94,11 @@ int mod_synth_get_active_noise_amp_mod_lfo()
 
 int mod_synth_get_active_noise_amp_mod_lfo_level()
 {
-	res_noise = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.amp_modulation_lfo_level", &int_param_noise);
+	res_noise = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_AMP_MODULATION_LFO_LEVEL, &int_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_noise.value;
+		return int_value_noise;
 	}
 	else
 	{
@@ -107,11 +107,11 @@ int mod_synth_get_active_noise_amp_mod_lfo_level()
 }
 int mod_synth_get_active_noise_amp_mod_env()
 {
-	res_noise = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.amp_modulation_env_num", &int_param_noise);
+	res_noise = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_AMP_MODULATION_ENV_NUM, &int_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_noise.value;
+		return int_value_noise;
 	}
 	else
 	{
@@ -121,11 +121,11 @@ int mod_synth_get_active_noise_amp_mod_env()
 
 int mod_synth_get_active_noise_amp_mod_env_level()
 {
-	res_noise = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.noise.amp_modulation_env_level", &int_param_noise);
+	res_noise = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_NOISE_AMP_MODULATION_ENV_LEVEL, &int_value_noise);
 	if (res_noise == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_noise.value;
+		return int_value_noise;
 	}
 	else
 	{
@@ -19,16 +19,16 @@
 #include "../synthesizer/modSynth.h"
 
 int res_osc;
-mod_synth_settings_int_param_t int_param_osc;
-mod_synth_settings_bool_param_t bool_param_osc;
+int int_value_osc;
+bool bool_value_osc;
 
 bool mod_synth_get_active_osc1_enable_state()
 {
-	res_osc = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.enabled", &bool_param_osc);
+	res_osc = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_ENABLED, &bool_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_osc.value;
+		return bool_value_osc;
 	}
 	else
 	{
@@ -38,11 +38,11 @@ bool mod_synth_get_active_osc1_enable_state()
 
 bool mod_synth_get_active_osc2_enable_state()
 {
-	res_osc = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.enabled", &bool_param_osc);
+	res_osc = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_ENABLED, &bool_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_osc.value;
+		return bool_value_osc;
 	}
 	else
 	{
@@ -52,11 +52,11 @@ bool mod_synth_get_active_osc2_enable_state()
 
 int mod_synth_get_active_osc1_waveform()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.waveform", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_WAVEFORM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -66,11 +66,11 @@ int mod_synth_get_active_osc1_waveform()
 
 int mod_synth_get_active_osc1_pwm_percents()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.symmetry", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_SYMMETRY, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -80,11 +80,11 @@ int mod_synth_get_active_osc1_pwm_percents()
 
 int mod_synth_get_active_osc1_detune_octave()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.tune_offset_oct", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_TUNE_OFFSET_OCT, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -94,11 +94,11 @@ int mod_synth_get_active_osc1_detune_octave()
 
 int mod_synth_get_active_osc1_detune_semitones()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.tune_offset_semitones", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_TUNE_OFFSET_SEMITONES, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -108,11 +108,11 @@ int mod_synth_get_active_osc1_detune_semitones()
 
 int mod_synth_get_active_osc1_detune_cents()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.tune_offset_cents", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_TUNE_OFFSET_CENTS, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -122,11 +122,11 @@ int mod_synth_get_active_osc1_detune_cents()
 
 int mod_synth_get_active_osc1_send_filter_1()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.send_filter_1", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_SEND_FILTER_1, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -136,11 +136,11 @@ int mod_synth_get_active_osc1_send_filter_1()
 
 int mod_synth_get_active_osc1_send_filter_2()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.send_filter_2", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_SEND_FILTER_2, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -150,11 +150,11 @@ int mod_synth_get_active_osc1_send_filter_2()
 
 int mod_synth_get_active_osc1_unison_mode()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.unison_mode", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_UNISON_MODE, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -164,11 +164,11 @@ int mod_synth_get_active_osc1_unison_mode()
 
 int mod_synth_get_active_osc1_hammond_mode()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.hammond_percussion_mode", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_HAMMOND_PERCUSSION_MODE, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -181,11 +181,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 	switch (harnum)
 	{
 	case 0:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_1", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_1, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -193,11 +193,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 1:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_2", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_2, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -205,11 +205,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 2:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_3", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_3, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -217,11 +217,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 3:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_4", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_4, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -229,11 +229,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 4:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_5", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_5, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -241,11 +241,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 5:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_6", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_6, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -253,11 +253,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 6:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_7", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_7, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -265,11 +265,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 7:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_8", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_8, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -277,11 +277,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 		}
 
 	case 8:
-		res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.osc1.unison_level_9", &int_param_osc);
+		res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_OSC1_UNISON_LEVEL_9, &int_value_osc);
 		if (res_osc == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_osc.value;
+			return int_value_osc;
 		}
 		else
 		{
@@ -295,11 +295,11 @@ int mod_synth_get_active_osc1_harmonies_levels(int harnum)
 
 int mod_synth_get_active_osc1_harmonies_detune_factor()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.unison_detune", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_UNISON_DETUNE, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -309,11 +309,11 @@ int mod_synth_get_active_osc1_harmonies_detune_factor()
 
 int mod_synth_get_active_osc1_harmonies_dist_factor()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.unison_distortion", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_UNISON_DISTORTION, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -324,11 +324,11 @@ int mod_synth_get_active_osc1_harmonies_dist_factor()
 
 int mod_synth_get_active_osc1_freq_mod_lfo()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.freq_modulation_lfo_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_FREQ_MODULATION_LFO_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -338,11 +338,11 @@ int mod_synth_get_active_osc1_freq_mod_lfo()
 
 int mod_synth_get_active_osc1_freq_mod_lfo_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.freq_modulation_lfo_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_FREQ_MODULATION_LFO_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -352,11 +352,11 @@ int mod_synth_get_active_osc1_freq_mod_lfo_level()
 
 int mod_synth_get_active_osc1_freq_mod_env()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.freq_modulation_env_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_FREQ_MODULATION_ENV_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -366,11 +366,11 @@ int mod_synth_get_active_osc1_freq_mod_env()
 
 int mod_synth_get_active_osc1_freq_mod_env_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.freq_modulation_env_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_FREQ_MODULATION_ENV_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -380,11 +380,11 @@ int mod_synth_get_active_osc1_freq_mod_env_level()
 
 int mod_synth_get_active_osc1_pwm_mod_lfo()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.pwm_modulation_lfo_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_PWM_MODULATION_LFO_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -394,11 +394,11 @@ int mod_synth_get_active_osc1_pwm_mod_lfo()
 
 int mod_synth_get_active_osc1_pwm_mod_lfo_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.pwm_modulation_lfo_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_PWM_MODULATION_LFO_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -408,11 +408,11 @@ int mod_synth_get_active_osc1_pwm_mod_lfo_level()
 
 int mod_synth_get_active_osc1_pwm_mod_env()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.pwm_modulation_env_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_PWM_MODULATION_ENV_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -421,11 +421,11 @@ int mod_synth_get_active_osc1_pwm_mod_env()
 }
 int mod_synth_get_active_osc1_pwm_mod_env_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.pwm_modulation_env_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_PWM_MODULATION_ENV_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -435,11 +435,11 @@ int mod_synth_get_active_osc1_pwm_mod_env_level()
 
 int mod_synth_get_active_osc1_amp_mod_lfo()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.amp_modulation_lfo_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_AMP_MODULATION_LFO_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -449,11 +449,11 @@ int mod_synth_get_active_osc1_amp_mod_lfo()
 
 int mod_synth_get_active_osc1_amp_mod_lfo_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.amp_modulation_lfo_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_AMP_MODULATION_LFO_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -463,11 +463,11 @@ int mod_synth_get_active_osc1_amp_mod_lfo_level()
 
 int mod_synth_get_active_osc1_amp_mod_env()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.amp_modulation_env_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_AMP_MODULATION_ENV_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -477,11 +477,11 @@ int mod_synth_get_active_osc1_amp_mod_env()
 
 int mod_synth_get_active_osc1_amp_mod_env_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.amp_modulation_env_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_AMP_MODULATION_ENV_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -490,11 +490,11 @@ int mod_synth_get_active_osc1_amp_mod_env_level()
 }
 
 int mod_synth_get_active_osc2_waveform() {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.waveform", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_WAVEFORM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -504,11 +504,11 @@ int mod_synth_get_active_osc2_waveform() {
 
 int mod_synth_get_active_osc2_pwm_percents()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.symmetry", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_SYMMETRY, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -518,11 +518,11 @@ int mod_synth_get_active_osc2_pwm_percents()
 
 int mod_synth_get_active_osc2_detune_octave()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.tune_offset_oct", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_TUNE_OFFSET_OCT, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -531,11 +531,11 @@ int mod_synth_get_active_osc2_detune_octave()
 }
 
 int mod_synth_get_active_osc2_detune_semitones() {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.tune_offset_semitones", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_TUNE_OFFSET_SEMITONES, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -545,11 +545,11 @@ int mod_synth_get_active_osc2_detune_semitones() {
 
 int mod_synth_get_active_osc2_detune_cents()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.tune_offset_cents", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_TUNE_OFFSET_CENTS, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -559,11 +559,11 @@ int mod_synth_get_active_osc2_detune_cents()
 
 int mod_synth_get_active_osc2_send_filter_1()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.send_filter_1", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_SEND_FILTER_1, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -573,11 +573,11 @@ int mod_synth_get_active_osc2_send_filter_1()
 
 int mod_synth_get_active_osc2_send_filter_2()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.send_filter_2", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_SEND_FILTER_2, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -587,11 +587,11 @@ int mod_synth_get_active_osc2_send_filter_2()
 
 bool mod_synth_get_active_osc2_sync_is_on_state()
 {
-	res_osc = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.sync_on_osc_1", &bool_param_osc);
+	res_osc = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_SYNC_ON_OSC_1, &bool_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -602,11 +602,11 @@ bool mod_synth_get_active_osc2_fix_tone_is_on_state() { return false; /* Synthes
 
 int mod_synth_get_active_osc2_freq_mod_lfo()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.freq_modulation_lfo_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_FREQ_MODULATION_LFO_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -616,11 +616,11 @@ int mod_synth_get_active_osc2_freq_mod_lfo()
 
 int mod_synth_get_active_osc2_freq_mod_lfo_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.freq_modulation_lfo_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_FREQ_MODULATION_LFO_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -630,11 +630,11 @@ int mod_synth_get_active_osc2_freq_mod_lfo_level()
 
 int mod_synth_get_active_osc2_freq_mod_env()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.freq_modulation_env_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_FREQ_MODULATION_ENV_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -644,11 +644,11 @@ int mod_synth_get_active_osc2_freq_mod_env()
 
 int mod_synth_get_active_osc2_freq_mod_env_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.freq_modulation_env_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_FREQ_MODULATION_ENV_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -658,11 +658,11 @@ int mod_synth_get_active_osc2_freq_mod_env_level()
 
 int mod_synth_get_active_osc2_pwm_mod_lfo()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.pwm_modulation_lfo_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_PWM_MODULATION_LFO_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -671,11 +671,11 @@ int mod_synth_get_active_osc2_pwm_mod_lfo()
 }
 
 int mod_synth_get_active_osc2_pwm_mod_lfo_level() {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc1.pwm_modulation_lfo_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC1_PWM_MODULATION_LFO_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -685,11 +685,11 @@ int mod_synth_get_active_osc2_pwm_mod_lfo_level() {
 
 int mod_synth_get_active_osc2_pwm_mod_env()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.pwm_modulation_env_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_PWM_MODULATION_ENV_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -699,11 +699,11 @@ int mod_synth_get_active_osc2_pwm_mod_env()
 
 int mod_synth_get_active_osc2_pwm_mod_env_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.pwm_modulation_env_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_PWM_MODULATION_ENV_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -713,11 +713,11 @@ int mod_synth_get_active_osc2_pwm_mod_env_level()
 
 int mod_synth_get_active_osc2_amp_mod_lfo()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.amp_modulation_lfo_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_AMP_MODULATION_LFO_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -727,11 +727,11 @@ int mod_synth_get_active_osc2_amp_mod_lfo()
 
 int mod_synth_get_active_osc2_amp_mod_lfo_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.amp_modulation_lfo_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_AMP_MODULATION_LFO_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -741,11 +741,11 @@ int mod_synth_get_active_osc2_amp_mod_lfo_level()
 
 int mod_synth_get_active_osc2_amp_mod_env()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.amp_modulation_env_num", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_AMP_MODULATION_ENV_NUM, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -755,11 +755,11 @@ int mod_synth_get_active_osc2_amp_mod_env()
 
 int mod_synth_get_active_osc2_amp_mod_env_level()
 {
-	res_osc = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.osc2.amp_modulation_env_level", &int_param_osc);
+	res_osc = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_OSC2_AMP_MODULATION_ENV_LEVEL, &int_value_osc);
 	if (res_osc == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_osc.value;
+		return int_value_osc;
 	}
 	else
 	{
@@ -18,16 +18,16 @@
 #include "../synthesizer/modSynth.h"
 
 int res_pad;
-mod_synth_settings_int_param_t int_param_pad;
-mod_synth_settings_bool_param_t bool_param_pad;
+int int_value_pad;
+bool bool_value_pad;
 
 bool mod_synth_get_active_pad_enable_state()
 {
-	res_pad = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.enabled", &bool_param_pad);
+	res_pad = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_ENABLED, &bool_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_pad.value;
+		return bool_value_pad;
 	}
 	else
 	{
@@ -37,11 +37,11 @@ bool mod_synth_get_active_pad_enable_state()
 
 int mod_synth_get_active_pad_detune_octave()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.tune_offset_octave", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_TUNE_OFFSET_OCTAVE, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -51,11 +51,11 @@ int mod_synth_get_active_pad_detune_octave()
 
 int mod_synth_get_active_pad_detune_semitones()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.tune_offset_semitones", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_TUNE_OFFSET_SEMITONES, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -65,11 +65,11 @@ int mod_synth_get_active_pad_detune_semitones()
 
 int mod_synth_get_active_pad_detune_cents()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.tune_offset_cents", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_TUNE_OFFSET_CENTS, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -79,11 +79,11 @@ int mod_synth_get_active_pad_detune_cents()
 
 int mod_synth_get_active_pad_send_filter_1()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.send_filter_1", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_SEND_FILTER_1, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -93,11 +93,11 @@ int mod_synth_get_active_pad_send_filter_1()
 
 int mod_synth_get_active_pad_send_filter_2()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.send_filter_2", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_SEND_FILTER_2, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -107,11 +107,11 @@ int mod_synth_get_active_pad_send_filter_2()
 
 int mod_synth_get_active_pad_freq_mod_lfo()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.freq_modulation_lfo_num", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_FREQ_MODULATION_LFO_NUM, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -121,11 +121,11 @@ int mod_synth_get_active_pad_freq_mod_lfo()
 
 int mod_synth_get_active_pad_freq_mod_lfo_level()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.freq_modulation_lfo_level", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_FREQ_MODULATION_LFO_LEVEL, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -135,11 +135,11 @@ int mod_synth_get_active_pad_freq_mod_lfo_level()
 
 int mod_synth_get_active_pad_freq_mod_env()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.freq_modulation_env_num", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_FREQ_MODULATION_ENV_NUM, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -149,11 +149,11 @@ int mod_synth_get_active_pad_freq_mod_env()
 
 int mod_synth_get_active_pad_freq_mod_env_level()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.freq_modulation_env_level", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_FREQ_MODULATION_ENV_LEVEL, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -163,11 +163,11 @@ int mod_synth_get_active_pad_freq_mod_env_level()
 
 int mod_synth_get_active_pad_amp_mod_lfo()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.amp_modulation_lfo_num", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_AMP_MODULATION_LFO_NUM, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -177,11 +177,11 @@ int mod_synth_get_active_pad_amp_mod_lfo()
 
 int mod_synth_get_active_pad_amp_mod_lfo_level()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.amp_modulation_lfo_level", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_AMP_MODULATION_LFO_LEVEL, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -191,11 +191,11 @@ int mod_synth_get_active_pad_amp_mod_lfo_level()
 
 int mod_synth_get_active_pad_amp_mod_env()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.amp_modulation_env_num", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_AMP_MODULATION_ENV_NUM, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -205,11 +205,11 @@ int mod_synth_get_active_pad_amp_mod_env()
 
 int mod_synth_get_active_pad_amp_mod_env_level()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.amp_modulation_env_level", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_AMP_MODULATION_ENV_LEVEL, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -219,11 +219,11 @@ int mod_synth_get_active_pad_amp_mod_env_level()
 
 int mod_synth_get_active_pad_quality()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.quality", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_QUALITY, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -233,11 +233,11 @@ int mod_synth_get_active_pad_quality()
 
 int mod_synth_get_active_pad_shape()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.shape", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_SHAPE, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -247,11 +247,11 @@ int mod_synth_get_active_pad_shape()
 
 int mod_synth_get_active_pad_shape_cutoff()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.shape_cutoff", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_SHAPE_CUTOFF, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -261,11 +261,11 @@ int mod_synth_get_active_pad_shape_cutoff()
 
 int mod_synth_get_active_pad_base_note()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.base_note", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_BASE_NOTE, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -275,11 +275,11 @@ int mod_synth_get_active_pad_base_note()
 
 int mod_synth_get_active_pad_base_width()
 {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.base_width", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_BASE_WIDTH, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -293,11 +293,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 	switch (harmony)
 	{
 	case 0:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_0", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_0, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -305,11 +305,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 1:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_1", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_1, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -317,11 +317,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 2:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_2", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_2, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -329,11 +329,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 3:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_3", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_3, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -341,11 +341,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 4:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_4", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_4, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -353,11 +353,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 5:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_5", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_5, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -365,11 +365,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 6:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_6", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_6, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -377,11 +377,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 7:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_7", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_7, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -389,11 +389,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 8:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_8", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_8, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -401,11 +401,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 		}
 
 	case 9:
-		res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-			"adjsynth.pad_synth.harmonies_level_9", &int_param_pad);
+		res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+			_PARAM_ID_PAD_SYNTH_HARMONIES_LEVEL_9, &int_value_pad);
 		if (res_pad == _SETTINGS_KEY_FOUND)
 		{
-			return int_param_pad.value;
+			return int_value_pad;
 		}
 		else
 		{
@@ -420,11 +420,11 @@ int mod_synth_get_active_pad_harmony_level(int harmony)
 }
 
 int mod_synth_get_active_pad_harmony_detune() {
-	res_pad = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.pad_synth.harmonies_detune", &int_param_pad);
+	res_pad = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_PAD_SYNTH_HARMONIES_DETUNE, &int_value_pad);
 	if (res_pad == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_pad.value;
+		return int_value_pad;
 	}
 	else
 	{
@@ -16,18 +16,18 @@
 #include "LibAPI_settingsManager.h"
 
 int res_rev;
-mod_synth_settings_int_param_t int_param_rev;
-mod_synth_settings_bool_param_t bool_param_rev;
+int int_value_rev;
+bool bool_value_rev;
 
 #include "../synthesizer/modSynth.h"
 
 bool mod_synth_get_active_reverb_enable_state() 
 {
-	res_rev = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb.enable_state", &bool_param_rev);
+	res_rev = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB_ENABLE_STATE, &bool_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_rev.value;
+		return bool_value_rev;
 	}
 	else
 	{
@@ -37,11 +37,11 @@ bool mod_synth_get_active_reverb_enable_state()
 
 int mod_synth_get_active_reverb_room_size() 
 {
-	res_rev = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb.room_size", &int_param_rev);
+	res_rev = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB_ROOM_SIZE, &int_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_rev.value;
+		return int_value_rev;
 	}
 	else
 	{
@@ -51,11 +51,11 @@ int mod_synth_get_active_reverb_room_size()
 
 int mod_synth_get_active_reverb_damp() 
 {
-	res_rev = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb.damp", &int_param_rev);
+	res_rev = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB_DAMP, &int_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_rev.value;
+		return int_value_rev;
 	}
 	else
 	{
@@ -65,11 +65,11 @@ int mod_synth_get_active_reverb_damp()
 
 int mod_synth_get_active_reverb_wet() 
 {
-	res_rev = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb.wet", &int_param_rev);
+	res_rev = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB_WET, &int_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_rev.value;
+		return int_value_rev;
 	}
 	else
 	{
@@ -79,11 +79,11 @@ int mod_synth_get_active_reverb_wet()
 
 int mod_synth_get_active_reverb_dry() 
 {
-	res_rev = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb.dry", &int_param_rev);
+	res_rev = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB_DRY, &int_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_rev.value;
+		return int_value_rev;
 	}
 	else
 	{
@@ -93,11 +93,11 @@ int mod_synth_get_active_reverb_dry()
 
 int mod_synth_get_active_reverb_width() 
 {
-	res_rev = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb.width", &int_param_rev);
+	res_rev = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB_WIDTH, &int_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_rev.value;
+		return int_value_rev;
 	}
 	else
 	{
@@ -107,11 +107,11 @@ int mod_synth_get_active_reverb_width()
 
 int mod_synth_get_active_reverb_mode() 
 {
-	res_rev = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb.mode", &int_param_rev);
+	res_rev = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB_MODE, &int_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_rev.value;
+		return int_value_rev;
 	}
 	else
 	{
@@ -121,11 +121,11 @@ int mod_synth_get_active_reverb_mode()
 
 bool mod_synth_get_active_reverb_3m_enable_state() 
 {
-	res_rev = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb3m.enable_state", &bool_param_rev);
+	res_rev = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB3M_ENABLE_STATE, &bool_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_rev.value;
+		return bool_value_rev;
 	}
 	else
 	{
@@ -135,11 +135,11 @@ bool mod_synth_get_active_reverb_3m_enable_state()
 
 int mod_synth_get_active_reverb_3m_preset() 
 {
-	res_rev = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_settings_params(),
-		"adjsynth.reverb3m.preset", &int_param_rev);
+	res_rev = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_settings_params(),
+		_PARAM_ID_REVERB3M_PRESET, &int_value_rev);
 	if (res_rev == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_rev.value;
+		return int_value_rev;
 	}
 	else
 	{
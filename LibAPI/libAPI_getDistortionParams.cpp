@@ -18,16 +18,16 @@
 #include "../synthesizer/modSynth.h"
 
 int res_dist;
-mod_synth_settings_int_param_t int_param_dist;
-mod_synth_settings_bool_param_t bool_param_dist;
+int int_value_dist;
+bool bool_value_dist;
 
 bool mod_synth_get_active_distortion_enable_state() 
 {
-	res_dist = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion.enabled", &bool_param_dist);
+	res_dist = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_ENABLED, &bool_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_dist.value;
+		return bool_value_dist;
 	}
 	else
 	{
@@ -37,11 +37,11 @@ bool mod_synth_get_active_distortion_enable_state()
 
 bool mod_synth_get_active_distortion_auto_gain_state() 
 {
-	res_dist = settings_manager->get_bool_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion.auto_gain_enabled", &bool_param_dist);
+	res_dist = settings_manager->get_bool_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_AUTO_GAIN_ENABLED, &bool_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return bool_param_dist.value;
+		return bool_value_dist;
 	}
 	else
 	{
@@ -51,11 +51,11 @@ bool mod_synth_get_active_distortion_auto_gain_state()
 
 int mod_synth_get_active_distortion_1_drive() 
 {
-	res_dist = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion_1.drive", &int_param_dist);
+	res_dist = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_1_DRIVE, &int_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_dist.value;
+		return int_value_dist;
 	}
 	else
 	{
@@ -65,11 +65,11 @@ int mod_synth_get_active_distortion_1_drive()
 
 int mod_synth_get_active_distortion_1_range() 
 {
-	res_dist = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion_1.range", &int_param_dist);
+	res_dist = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_1_RANGE, &int_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_dist.value;
+		return int_value_dist;
 	}
 	else
 	{
@@ -79,11 +79,11 @@ int mod_synth_get_active_distortion_1_range()
 
 int mod_synth_get_active_distortion_1_blend() 
 {
-	res_dist = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion_1.blend", &int_param_dist);
+	res_dist = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_1_BLEND, &int_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_dist.value;
+		return int_value_dist;
 	}
 	else
 	{
@@ -93,11 +93,11 @@ int mod_synth_get_active_distortion_1_blend()
 
 int mod_synth_get_active_distortion_2_drive()
 {
-	res_dist = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion_2.drive", &int_param_dist);
+	res_dist = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_2_DRIVE, &int_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_dist.value;
+		return int_value_dist;
 	}
 	else
 	{
@@ -107,11 +107,11 @@ int mod_synth_get_active_distortion_2_drive()
 
 int mod_synth_get_active_distortion_2_range()
 {
-	res_dist = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion_2.range", &int_param_dist);
+	res_dist = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_2_RANGE, &int_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_dist.value;
+		return int_value_dist;
 	}
 	else
 	{
@@ -121,11 +121,11 @@ int mod_synth_get_active_distortion_2_range()
 
 int mod_synth_get_active_distortion_2_blend()
 {
-	res_dist = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.distortion_2.blend", &int_param_dist);
+	res_dist = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_DISTORTION_2_BLEND, &int_value_dist);
 	if (res_dist == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_dist.value;
+		return int_value_dist;
 	}
 	else
 	{
@@ -17,17 +17,17 @@
 #include "LibAPI_settingsManager.h"
 
 int res_filter;
-mod_synth_settings_int_param_t int_param_filter;
+int int_value_filter;
 
 #include "../synthesizer/modSynth.h"
 
 int mod_synth_get_active_filter_1_freq() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.frequency", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_FREQUENCY, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -37,11 +37,11 @@ int mod_synth_get_active_filter_1_freq()
 
 int mod_synth_get_active_filter_1_oct() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.octave", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_OCTAVE, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -51,11 +51,11 @@ int mod_synth_get_active_filter_1_oct()
 
 int mod_synth_get_active_filter_1_q() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.q", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_Q, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -65,11 +65,11 @@ int mod_synth_get_active_filter_1_q()
 
 int mod_synth_get_active_filter_1_kbd_track() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.keyboard_track", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_KEYBOARD_TRACK, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -79,11 +79,11 @@ int mod_synth_get_active_filter_1_kbd_track()
 
 int mod_synth_get_active_filter_1_band() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.band", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_BAND, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -93,11 +93,11 @@ int mod_synth_get_active_filter_1_band()
 
 int mod_synth_get_active_filter_1_Freq_mod_lfo() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.freq_modulation_lfo_num", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_FREQ_MODULATION_LFO_NUM, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -107,11 +107,11 @@ int mod_synth_get_active_filter_1_Freq_mod_lfo()
 
 int mod_synth_get_active_filter_1_Freq_mod_lfo_level() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.freq_modulation_lfo_level", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_FREQ_MODULATION_LFO_LEVEL, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -121,11 +121,11 @@ int mod_synth_get_active_filter_1_Freq_mod_lfo_level()
 
 int mod_synth_get_active_filter_1_Freq_mod_env() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.freq_modulation_env_num", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_FREQ_MODULATION_ENV_NUM, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -135,11 +135,11 @@ int mod_synth_get_active_filter_1_Freq_mod_env()
 
 int mod_synth_get_active_filter_1_Freq_mod_env_level() 
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter1.freq_modulation_env_level", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER1_FREQ_MODULATION_ENV_LEVEL, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -150,11 +150,11 @@ int mod_synth_get_active_filter_1_Freq_mod_env_level()
 
 int mod_synth_get_active_filter_2_freq()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.frequency", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_FREQUENCY, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -164,11 +164,11 @@ int mod_synth_get_active_filter_2_freq()
 
 int mod_synth_get_active_filter_2_oct()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.octave", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_OCTAVE, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -178,11 +178,11 @@ int mod_synth_get_active_filter_2_oct()
 
 int mod_synth_get_active_filter_2_q()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.q", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_Q, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -192,11 +192,11 @@ int mod_synth_get_active_filter_2_q()
 
 int mod_synth_get_active_filter_2_kbd_track()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.keyboard_track", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_KEYBOARD_TRACK, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -206,11 +206,11 @@ int mod_synth_get_active_filter_2_kbd_track()
 
 int mod_synth_get_active_filter_2_band()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.band", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_BAND, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -220,11 +220,11 @@ int mod_synth_get_active_filter_2_band()
 
 int mod_synth_get_active_filter_2_Freq_mod_lfo()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.freq_modulation_lfo_num", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_FREQ_MODULATION_LFO_NUM, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -234,11 +234,11 @@ int mod_synth_get_active_filter_2_Freq_mod_lfo()
 
 int mod_synth_get_active_filter_2_Freq_mod_lfo_level()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.freq_modulation_lfo_level", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_FREQ_MODULATION_LFO_LEVEL, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -248,11 +248,11 @@ int mod_synth_get_active_filter_2_Freq_mod_lfo_level()
 
 int mod_synth_get_active_filter_2_Freq_mod_env()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.freq_modulation_env_num", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_FREQ_MODULATION_ENV_NUM, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -262,11 +262,11 @@ int mod_synth_get_active_filter_2_Freq_mod_env()
 
 int mod_synth_get_active_filter_2_Freq_mod_env_level()
 {
-	res_filter = settings_manager->get_int_param(AdjSynth::get_instance()->get_active_patch_params(),
-		"adjsynth.filter2.freq_modulation_env_level", &int_param_filter);
+	res_filter = settings_manager->get_int_param_value(AdjSynth::get_instance()->get_active_patch_params(),
+		_PARAM_ID_FILTER2_FREQ_MODULATION_ENV_LEVEL, &int_value_filter);
 	if (res_filter == _SETTINGS_KEY_FOUND)
 	{
-		return int_param_filter.value;
+		return int_value_filter;
 	}
 	else
 	{
@@ -1,8 +1,12 @@
 /**
 * @file		alsaBtClientOutput.cpp
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. BT data is pulled out of a preallocated lock-free ring; the thread
+*					   waits for new data instead of polling.
+*
+*	@version	1.1		6-Feb-2021
 *					1. Code refactoring and notaion.
 *
 *	@brief		Here we handle the BT RFCOMM (SPP) midi input streams and we
@@ -22,7 +26,7 @@ snd_rawmidi_t *AlsaBtClientOutput::midi_out = NULL;
 AlsaBtClientOutput *AlsaBtClientOutput::alsa_bt_client_output = NULL;
 
 /* Will hold data received from BT */
-bt_chan_data_t *bt_rx_alsa_channel_data = NULL;
+bt_queue_record_t *bt_rx_alsa_channel_data = NULL;
 
 AlsaBtClientOutput::AlsaBtClientOutput()
 {
@@ -120,8 +124,7 @@ void AlsaBtClientOutput::stop_bt_alsa_out_thread()
 */
 void *AlsaBtClientOutput::bt_alsa_out_thread(void *thread_id)
 {
-	bool timeout = false, blocking = true, non_blocking = false;
-	int count, last_count, status, timeouts = 0;
+	int count, i, status, timeouts = 0;
 	uint8_t bytes[512];
 
 
@@ -129,24 +132,24 @@ void *AlsaBtClientOutput::bt_alsa_out_thread(void *thread_id)
 
 	while (bt_alsa_out_thread_is_running)
 	{
-		// Wait for new data - non blocking
-		bt_rx_alsa_channel_data = Raspi3BluetoothQ::bt_rx_queue_alsa.dequeue(0, &timeout, &non_blocking);
-		// Get all new data
+		// Get all new data that fits
 		count = 0;
-		last_count = 0;		
+		bt_rx_alsa_channel_data = Raspi3BluetoothQ::bt_rx_queue_alsa.get_read_slot();
 		while (bt_rx_alsa_channel_data != NULL)
 		{
+			if ((count + bt_rx_alsa_channel_data->message.mssg_len) > sizeof(bytes))
+			{
+				// Left for the next cycle
+				break;
+			}
+			
 			// Collect all available data
-			for (count; count < (last_count + bt_rx_alsa_channel_data->message->mssg_len) &&
-						count < sizeof(bt_rx_alsa_channel_data->message->data) &&
-				count < sizeof(bytes); count++)
+			for (i = 0; i < bt_rx_alsa_channel_data->message.mssg_len; i++)
 			{
-				bytes[count] = bt_rx_alsa_channel_data->message->data[count - last_count];
+				bytes[count++] = bt_rx_alsa_channel_data->message.data[i];
 			}
-			last_count = count;
-			delete bt_rx_alsa_channel_data;
-			bt_rx_alsa_channel_data = Raspi3BluetoothQ::bt_rx_queue_alsa.dequeue(0, &timeout, &non_blocking);
-//			printf("ALSA BT client: BT in data alsa thread while data\n");
+			Raspi3BluetoothQ::bt_rx_queue_alsa.release_read_slot();
+			bt_rx_alsa_channel_data = Raspi3BluetoothQ::bt_rx_queue_alsa.get_read_slot();
 		}
 
 		if (count > 0)
@@ -165,7 +168,8 @@ void *AlsaBtClientOutput::bt_alsa_out_thread(void *thread_id)
 
 		}
 
-		usleep(5000);		
+		// Wait for new data (or 5msec)
+		Raspi3BluetoothQ::bt_rx_queue_alsa.wait_for_data(5);		
 	}
 
 	return 0;
@@ -1,8 +1,13 @@
 /**
 *	@file		alsaMidiIn.h
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. Received data is pushed into a preallocated wait-free rx ring
+*					   (no allocations on the receive path).
+*					2. Data to send is pulled out of a preallocated lock-free tx ring.
+*
+*	@version	1.1		6-Feb-2021
 *					1. Code refactoring and notaion.
 *					2. Adding support in multiple devices
 *					3. Seperating into input and output devices
@@ -43,10 +48,10 @@ pthread_t AlsaMidi::th_midi_tx_thread[_MAX_NUM_OF_MIDI_CONNECTIONS];
 snd_rawmidi_t* AlsaMidi::midi_in[_MAX_NUM_OF_MIDI_DEVICES];
 snd_rawmidi_t* AlsaMidi::midi_out[_MAX_NUM_OF_MIDI_DEVICES];
 
-/* Queue for holding midi input data */
-SafeQueue<alsa_data_t*> AlsaMidi::alsa_rx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
-/* Queue for holding midi output data */
-SafeQueue<alsa_data_t*> AlsaMidi::alsa_tx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
+/* Rings for holding midi input data (single producer: rx thread; single consumer: MIDI stream) */
+alsa_midi_rx_ring_t AlsaMidi::alsa_rx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
+/* Rings for holding midi output data (any producer; single consumer: tx thread) */
+alsa_midi_tx_ring_t AlsaMidi::alsa_tx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
 
 AlsaMidi* AlsaMidi::get_instance()
 {
@@ -1114,6 +1119,8 @@ void *midi_rx_thread(void *arg)
 	int err;
 
 	alsa_data_t *rx_data;
+	// Used when the rx ring is full (the data is dropped)
+	alsa_data_t overflow_data;
 	
 	if (midi_out == NULL) 
 	{
@@ -1122,7 +1129,14 @@ void *midi_rx_thread(void *arg)
 	
 	while (AlsaMidi::midi_rx_thread_is_running[connection]) 
 	{
-		rx_data = new alsa_data_t();
+		// Read directly into the next free ring record
+		rx_data = AlsaMidi::alsa_rx_queue[connection].get_write_slot();
+		if (rx_data == NULL)
+		{
+			// Full - keep reading the device so it is not blocked
+			rx_data = &overflow_data;
+		}
+		
 		if ((bytes_read = snd_rawmidi_read(midi_out, rx_data->data, sizeof(rx_data->data))) < 0)
 		{
 			err = errno;
@@ -1130,23 +1144,15 @@ void *midi_rx_thread(void *arg)
 			//	AlsaMidi::midi_rx_thread_is_running[connection] = false;   // Exit
 		}
 		
-		if ((bytes_read >= 0) && AlsaMidi::device_connected[device])
+		if ((bytes_read > 0) && AlsaMidi::device_connected[device] && (rx_data != &overflow_data))
 		{
-			printf("ALSA MIDI in thread %i: alsa in bytes: %i\n", connection, bytes_read);
 			rx_data->length = bytes_read;
-			// Push data into the midi in receive data queue
-			AlsaMidi::alsa_rx_queue[connection].enqueue(rx_data);			
-			for (int i = 0; i < bytes_read; i++)
-			{
-				printf("%x ", rx_data->data[i]);
-			}
-			printf("\n");
-		}
-		else
-		{
-			delete rx_data;
+			rx_data->timestamp_ns = MidiStream::get_time_ns();
+			// Publish the data to the midi in receive data ring
+			AlsaMidi::alsa_rx_queue[connection].commit_write_slot();
+			// Wake the MIDI stream thread - process now
+			MidiStream::notify_data_available();
 		}
-		
 	}
 
 	AlsaMidi::get_instance()->release_connection(connection);
@@ -1177,8 +1183,20 @@ void *midi_tx_thread(void *arg)
 	
 	while (AlsaMidi::midi_tx_thread_is_running[connection]) 
 	{
-		usleep(10000); // TODO
+		// Wait for data to send (or 10msec)
+		AlsaMidi::alsa_tx_queue[connection].wait_for_data(10);
 		
+		tx_data = AlsaMidi::alsa_tx_queue[connection].get_read_slot();
+		while (tx_data != NULL)
+		{
+			if ((midi_in != NULL) && AlsaMidi::device_connected[device] &&
+				((bytes_read = snd_rawmidi_write(midi_in, tx_data->data, tx_data->length)) < 0))
+			{
+				fprintf(stderr, "ALSA MIDI tx thread %i: Problem writing MIDI output: %s\n", connection, snd_strerror(bytes_read));
+			}
+			AlsaMidi::alsa_tx_queue[connection].release_read_slot();
+			tx_data = AlsaMidi::alsa_tx_queue[connection].get_read_slot();
+		}
 	}
 	
 	return NULL;
@@ -1,8 +1,13 @@
 /**
 *	@file		alsaMidi.h
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. Received data is pushed into a preallocated wait-free rx ring
+*					   (no allocations on the receive path).
+*					2. Data to send is pulled out of a preallocated lock-free tx ring.
+*
+*	@version	1.1		6-Feb-2021
 *					1. Code refactoring and notaion.
 *					2. Adding support in multiple devices
 *					3. Seperating into input and output devices
@@ -26,7 +31,11 @@
 #include "../commonDefs.h"
 
 #include "../midi/midiStream.h"
-#include "../utils/safeQueues.h"
+#include "../utils/lockFreeRings.h"
+
+/* Number of records in each connection rx ring (must be a power of 2) */
+#define _ALSA_MIDI_RX_RING_SIZE	64
+#define _ALSA_MIDI_TX_RING_SIZE	16
 
 /* Defines the number of bytes in received buffer */
 #define _NUM_OF_RX_BYTES		256
@@ -61,12 +70,17 @@ typedef struct midi_dev
 
 typedef struct alsa_data
 {
-	alsa_data() : length(0) { for (int i = 0; i < _RAWDATA_MSSG_MAX_LEN; i++) data[i] = 0; }
+	alsa_data() : length(0), timestamp_ns(0) { for (int i = 0; i < _RAWDATA_MSSG_MAX_LEN; i++) data[i] = 0; }
 
 	int length;
+	// Receive time (CLOCK_MONOTONIC ns; 0: unknown)
+	uint64_t timestamp_ns;
 	uint8_t data[_RAWDATA_MSSG_MAX_LEN];
 } alsa_data_t;
 
+typedef SpscRing<alsa_data_t, _ALSA_MIDI_RX_RING_SIZE> alsa_midi_rx_ring_t;
+typedef MpscRing<alsa_data_t, _ALSA_MIDI_TX_RING_SIZE> alsa_midi_tx_ring_t;
+
 typedef struct alsa_midi_thread_params
 {
 	int connection;
@@ -111,8 +125,8 @@ public:
 
 	static snd_rawmidi_t* midi_in[_MAX_NUM_OF_MIDI_DEVICES], *midi_out[_MAX_NUM_OF_MIDI_DEVICES];
 
-	static SafeQueue<alsa_data_t*> alsa_rx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
-	static SafeQueue<alsa_data_t*> alsa_tx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
+	static alsa_midi_rx_ring_t alsa_rx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
+	static alsa_midi_tx_ring_t alsa_tx_queue[_MAX_NUM_OF_MIDI_CONNECTIONS];
 	
 private:
 	AlsaMidi();
@@ -1,8 +1,12 @@
 /**
 *	@file		alsaMidiSequencerClient.h
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. Events are pushed into a preallocated wait-free rx ring of fixed-size
+*					   records (no allocations); sysex data is copied into the record.
+*
+*	@version	1.1		6-Feb-2021
 *					1. Code refactoring and notaion.
 *
 *	@brief		ALSA MIDI input client
@@ -16,12 +20,13 @@
 #include <pthread.h>
 
 #include "alsaMidiSequencerClient.h"
+#include "../midi/midiStream.h"
 #include "../misc/priorities.h"
 
 bool AlsaMidiSequencerInputClient::midi_in_client_thread_is_running = false;
 pthread_t AlsaMidiSequencerInputClient::midi_client_in_thread;
 snd_seq_t *AlsaMidiSequencerInputClient::midi_in_seq = NULL;
-SafeQueue<snd_seq_event_t*> AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue;
+alsa_seq_client_rx_ring_t AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue;
 
 AlsaMidiSequencerInputClient::AlsaMidiSequencerInputClient()
 {
@@ -114,7 +119,8 @@ void *midi_in_seq_client_thread(void *arg)
 	snd_seq_t* midi_in = AlsaMidiSequencerInputClient::open_seq();  //(snd_seq_t*)arg;
 	int npfd;
 	struct pollfd *pfd;
-	snd_seq_event_t *ev, *qev;
+	snd_seq_event_t *ev;
+	alsa_seq_event_record_t *rec;
 
 	npfd = snd_seq_poll_descriptors_count(midi_in, POLLIN);
 	pfd = (struct pollfd *)alloca(npfd * sizeof(struct pollfd));
@@ -126,9 +132,30 @@ void *midi_in_seq_client_thread(void *arg)
 			do {
 				snd_seq_event_input(midi_in, &ev);
 
-				qev = new snd_seq_event_t();
-				memcpy(qev, ev, sizeof(snd_seq_event_t));
-				AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.enqueue(qev);
+				// Copy into the next free ring record (dropped if full)
+				rec = AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.get_write_slot();
+				if (rec != NULL)
+				{
+					memcpy(&rec->event, ev, sizeof(snd_seq_event_t));
+					rec->timestamp_ns = MidiStream::get_time_ns();
+					if (ev->type == SND_SEQ_EVENT_SYSEX)
+					{
+						// The event data is freed with the event - keep a copy
+						if ((ev->data.ext.ptr != NULL) && (ev->data.ext.len <= _ALSA_SEQ_CLIENT_MAX_SYSEX_LEN))
+						{
+							memcpy(rec->sysex_data, ev->data.ext.ptr, ev->data.ext.len);
+							rec->event.data.ext.ptr = rec->sysex_data;
+						}
+						else
+						{
+							rec->event.data.ext.ptr = NULL;
+							rec->event.data.ext.len = 0;
+						}
+					}
+					AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.commit_write_slot();
+					// Wake the MIDI stream thread - process now
+					MidiStream::notify_data_available();
+				}
 /*
 				switch (ev->type) {
 					case SND_SEQ_EVENT_CONTROLLER:
@@ -1,8 +1,12 @@
 /**
 *	@file		alsaMidiSequencerClient.h
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. Events are pushed into a preallocated wait-free rx ring of fixed-size
+*					   records (no allocations); sysex data is copied into the record.
+*
+*	@version	1.1		6-Feb-2021
 *					1. Code refactoring and notaion.
 *
 *	@brief		ALSA MIDI input client. Pushes ALSA midi input data into alsa_seq_client_rx_queue
@@ -19,7 +23,23 @@
 #include <pthread.h>
 #include <alsa/asoundlib.h> 
 
-#include "../utils/safeQueues.h"
+#include "../utils/lockFreeRings.h"
+
+/* Number of records in the rx ring (must be a power of 2) */
+#define _ALSA_SEQ_CLIENT_RX_RING_SIZE			128
+/* Longer sysex messages are dropped */
+#define _ALSA_SEQ_CLIENT_MAX_SYSEX_LEN			512
+
+/* A received sequencer event; a sysex event data.ext.ptr points to the record sysex_data */
+typedef struct alsa_seq_event_record
+{
+	snd_seq_event_t event;
+	// Receive time (CLOCK_MONOTONIC ns)
+	uint64_t timestamp_ns;
+	uint8_t sysex_data[_ALSA_SEQ_CLIENT_MAX_SYSEX_LEN];
+} alsa_seq_event_record_t;
+
+typedef SpscRing<alsa_seq_event_record_t, _ALSA_SEQ_CLIENT_RX_RING_SIZE> alsa_seq_client_rx_ring_t;
 
 class AlsaMidiSequencerInputClient
 {
@@ -35,7 +55,7 @@ public:
 
 	static 	snd_seq_t *midi_in_seq;
 
-	static SafeQueue<snd_seq_event_t*> alsa_seq_client_rx_queue;
+	static alsa_seq_client_rx_ring_t alsa_seq_client_rx_queue;
 
 private:
 
@@ -1,8 +1,11 @@
 /**
 *	@file		midiAlsaSequrncerEventsHandler.h
 *	@author		Nahum Budin
-*	@date		13-12-2019
-*	@version	1.3
+*	@date		17-Oct-2026
+*	@version	1.4
+*					1. Events are pulled out of a preallocated wait-free rx ring (no allocations).
+*
+*	@version	1.3		13-12-2019
 *					1. Code refactoring and notaion.
 *
 *	@brief		Recives data from a alsa midi by puling it out of the midi in rx data queue.
@@ -219,14 +222,17 @@ AlsaMidiSeqencerEventsHandler::AlsaMidiSeqencerEventsHandler(uint8_t stage)
 
 void AlsaMidiSeqencerEventsHandler::update()
 {
+	alsa_seq_event_record_t *rec;
 	snd_seq_event_t *qev = NULL;
-	bool timeout, blocking = false;
 	uint8_t sysex_message[512];
 	int i;
 
-	qev = AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.dequeue(0, &timeout, &blocking); //// Non blocking get from Q
-	while (qev != NULL)
+	rec = AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.get_read_slot();
+	while (rec != NULL)
 	{
+		qev = &rec->event;
+		// Notes are scheduled by their own arrival time
+		set_input_timestamp_ns(rec->timestamp_ns);
 
 		switch (qev->type) 
 		{
@@ -325,7 +331,9 @@ void AlsaMidiSeqencerEventsHandler::update()
 				break;
 		}
 
-		delete qev;
-		qev = AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.dequeue(0, &timeout, &blocking);
+		AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.release_read_slot();
+		rec = AlsaMidiSequencerInputClient::alsa_seq_client_rx_queue.get_read_slot();
 	}
+
+	set_input_timestamp_ns(0);
 }
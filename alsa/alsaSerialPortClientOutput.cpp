@@ -1,8 +1,12 @@
 /**
 *	@file		alsaSerialPortClientOutput.h
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. Serial port data is pulled out of a preallocated lock-free ring; the
+*					   thread waits for new data instead of polling.
+*
+*	@version	1.1		6-Feb-2021
 *					1. Code refactoring and notaion.
 *	
 *		version 1.0		27-Nov-2020
@@ -128,33 +132,31 @@ void AlsaSerialPortClientOutput::stop_alsa_serial_port_out_thread()
 */
 void *AlsaSerialPortClientOutput::alsa_serial_port_out_thread(void *threadid)
 {
-	bool timeout = false, blocking = true, non_blocking = false;
-	int count, last_count, status, timeouts = 0;
+	int count, i, status, timeouts = 0;
 	uint8_t bytes[512];
 
 	fprintf(stderr, "Serial Prt alsa out thread started\n");
 
 	while (alsa_serial_port_out_thread_is_running)
 	{
-		// Wait for new data - non blocking
-		serial_port_rx_alsa_channel_data = SerialPort::alsa_serial_port_rx_queue.dequeue(0, &timeout, &non_blocking);
-		// Get all new data
+		// Get all new data that fits
 		count = 0;
-		last_count = 0;
+		serial_port_rx_alsa_channel_data = SerialPort::alsa_serial_port_rx_queue.get_read_slot();
 		while (serial_port_rx_alsa_channel_data != NULL)
 		{
+			if ((count + serial_port_rx_alsa_channel_data->mssg_len) > sizeof(bytes))
+			{
+				// Left for the next cycle
+				break;
+			}
+			
 			// Collect all available data
-			for (count; count < (last_count + serial_port_rx_alsa_channel_data->mssg_len) &&
-						count < sizeof(serial_port_rx_alsa_channel_data->message) &&
-						count < sizeof(bytes);
-				 count++)
+			for (i = 0; i < serial_port_rx_alsa_channel_data->mssg_len; i++)
 			{
-				bytes[count] = serial_port_rx_alsa_channel_data->message[count - last_count];
+				bytes[count++] = serial_port_rx_alsa_channel_data->message[i];
 			}
-			last_count = count;
-			delete serial_port_rx_alsa_channel_data;
-			serial_port_rx_alsa_channel_data = SerialPort::alsa_serial_port_rx_queue.dequeue(0, &timeout, &non_blocking);
-			//			printf("Serial port in data alsa thread while data\n");
+			SerialPort::alsa_serial_port_rx_queue.release_read_slot();
+			serial_port_rx_alsa_channel_data = SerialPort::alsa_serial_port_rx_queue.get_read_slot();
 		}
 
 		if (count > 0)
@@ -172,7 +174,8 @@ void *AlsaSerialPortClientOutput::alsa_serial_port_out_thread(void *threadid)
 			}
 		}
 
-		usleep(5000);
+		// Wait for new data (or 5msec)
+		SerialPort::alsa_serial_port_rx_queue.wait_for_data(5);
 	}
 
 	return 0;
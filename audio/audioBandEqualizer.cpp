@@ -16,8 +16,6 @@
 #include "audioBandEqualizer.h"
 #include "../utils/utils.h"
 
-extern pthread_mutex_t voice_mem_blocks_allocation_control_mutex;
-
 /**
 *   @brief  Creates and initializes a band equilizer audio-block object instance.
 *   @param  stage	update stage number
@@ -121,7 +119,6 @@ void AudioBandEqualizer::update(void)
 
 	if (!in_block_L1 || !in_block_R1 || !in_block_L2 || !in_block_R2)
 	{
-		pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 		if (in_block_L1)
 			release_audio_block(in_block_L1);
 		if (in_block_R1)
@@ -130,7 +127,6 @@ void AudioBandEqualizer::update(void)
 			release_audio_block(in_block_L2);
 		if (in_block_R2)
 			release_audio_block(in_block_R2);
-		pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 		return;
 	}
 	/*
@@ -139,25 +135,20 @@ void AudioBandEqualizer::update(void)
 			// Equilizer disabled - pass through
 			transmit_audio_block(in_block_L1, _LEFT);
 			transmit_audio_block(in_block_R1, _RIGHT);
-			pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 			release_audio_block(in_block_L1);
 			release_audio_block(in_block_R1);
 			release_audio_block(in_block_L2);
 			release_audio_block(in_block_R2);
-			pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 		}
 		else
 		{*/
 	// Equilizer enabled
 
-	pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 	out_block_L = allocate_audio_block();
 	out_block_R = allocate_audio_block();
-	pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 	if (!out_block_L || !out_block_R)
 	{
 		// Can't allocate 2audio blocks
-		pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 		if (in_block_L1)
 			release_audio_block(in_block_L1);
 		if (in_block_R1)
@@ -170,7 +161,6 @@ void AudioBandEqualizer::update(void)
 			release_audio_block(out_block_L);
 		if (out_block_R)
 			release_audio_block(out_block_R);
-		pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 
 		return;
 	}
@@ -195,13 +185,11 @@ void AudioBandEqualizer::update(void)
 
 	transmit_audio_block(out_block_L, _LEFT);
 	transmit_audio_block(out_block_R, _RIGHT);
-	pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 	release_audio_block(out_block_L);
 	release_audio_block(out_block_R);
 	release_audio_block(in_block_L1);
 	release_audio_block(in_block_R1);
 	release_audio_block(in_block_L2);
 	release_audio_block(in_block_R2);
-	pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 	//	}
 }
@@ -16,8 +16,6 @@
 #include "audioBlock.h"
 #include "../utils/utils.h"
 
-extern pthread_mutex_t voice_mem_blocks_allocation_control_mutex;
-
 // Set default values 
 //unsigned int AudioBlockFloat::period_time;
 volatile bool AudioBlockFloat::update_enable = false;
@@ -28,6 +26,7 @@ audio_block_float_mono_t *AudioBlockFloat::audio_data_blocks_memory_pool;
 
 uint32_t AudioBlockFloat::audio_data_blocks_memory_pool_available_mask[_AUDIO_BLOCKS_MESSAGES_POOL_NUM_OF_MASKS];
 uint16_t AudioBlockFloat::audio_data_blocks_memory_pool_first_mask;
+uint32_t AudioBlockFloat::audio_data_blocks_memory_pool_contention_count = 0;
 
 uint16_t AudioBlockFloat::audio_block_size = _AUDIO_MAX_BUF_SIZE;
 
@@ -172,62 +171,69 @@ void AudioBlockFloat::initialize_audio_memory(audio_block_float_mono_t *blocks,
 /**
 *   @brief  Allocate 1 audio data block.
 *			If successful, the caller is the only owner of this new block.
+*			Lock free: a free bit is claimed by an atomic compare-and-swap on its
+*			availability mask, so real-time threads never block on a mutex.
+*			A failed CAS (another thread modified the same mask) is counted as
+*			a contention event.
 *   @param  none
 *   @return a pointer to the allocated audio_block_float_mono_t block
 */
 audio_block_float_mono_t * AudioBlockFloat::allocate_audio_block(void)
 {
-	uint32_t n, index, avail;
-	uint32_t *p, *end;
+	uint32_t n, index, first, avail;
 	audio_block_float_mono_t *block;
 
-	p = audio_data_blocks_memory_pool_available_mask;
-	end = p + _AUDIO_BLOCKS_MESSAGES_POOL_NUM_OF_MASKS;
-	
-	update_stop();
+	first = __atomic_load_n(&audio_data_blocks_memory_pool_first_mask, __ATOMIC_RELAXED);
 	
-	index = audio_data_blocks_memory_pool_first_mask;
-	p += index;
-	while (1) 
+	// Scan from the first (hinted) non empty mask to the end, then wrap around
+	for (int m = 0; m < _AUDIO_BLOCKS_MESSAGES_POOL_NUM_OF_MASKS; m++)
 	{
-		if (p >= end) 
-		{
-			update_start();
-			return NULL;
-		}
-		avail = *p;
-		if (avail)
+		index = (first + m) % _AUDIO_BLOCKS_MESSAGES_POOL_NUM_OF_MASKS;
+		avail = __atomic_load_n(&audio_data_blocks_memory_pool_available_mask[index], __ATOMIC_RELAXED);
+		
+		while (avail)
 		{
-			break;
+			// Mark as used
+			n = __builtin_clz(avail);
+			if (__atomic_compare_exchange_n(&audio_data_blocks_memory_pool_available_mask[index],
+				&avail,
+				avail & ~(0x80000000 >> n),
+				true,
+				__ATOMIC_ACQUIRE,
+				__ATOMIC_RELAXED))
+			{
+				if ((avail & ~(0x80000000 >> n)) == 0)
+				{
+					// Mask exhausted - hint the next one
+					__atomic_compare_exchange_n(&audio_data_blocks_memory_pool_first_mask,
+						&first,
+						(uint16_t)((index + 1) % _AUDIO_BLOCKS_MESSAGES_POOL_NUM_OF_MASKS),
+						false,
+						__ATOMIC_RELAXED,
+						__ATOMIC_RELAXED);
+				}
+				
+				block = audio_data_blocks_memory_pool + ((index << 5) + (31 - n));
+				__atomic_store_n(&block->ref_count, 1, __ATOMIC_RELAXED);
+				
+				//	printf("allocate block %i\n", block->memory_pool_index);
+
+				return block;
+			}
+			
+			// avail was reloaded by the failed CAS - retry
+			__atomic_add_fetch(&audio_data_blocks_memory_pool_contention_count, 1, __ATOMIC_RELAXED);
 		}
-		index++;
-		p++;
 	}
-	// Mark as used
-	n = __builtin_clz(avail);
-	avail &= ~(0x80000000 >> n);
-	*p = avail;
-	if (!avail) 
-	{
-		index++;
-		audio_data_blocks_memory_pool_first_mask = index;
-	}
-	index = p - audio_data_blocks_memory_pool_available_mask;
-	block = audio_data_blocks_memory_pool + ((index << 5) + (31 - n));
-	block->ref_count = 1;
 
-	//	printf("allocate block %i\n", block->memory_pool_index);
-	
-		update_start();
-	
-	return block;
+	return NULL;
 }
 
 
 /**
 *   @brief  Release ownership of a data block.
 *			If no other streams have ownership, the block is
-*			returned to the free pool
+*			returned to the free pool (lock free).
 *   @param  block	a pointer to the to be released block (audio_block_float_mono_t)
 *   @return void
 */
@@ -235,23 +241,46 @@ void AudioBlockFloat::release_audio_block(audio_block_float_mono_t *block)
 {
 	//if (block == NULL) return;
 	uint32_t mask = (0x80000000 >> (31 - (block->memory_pool_index & 0x1F)));
-	uint32_t index = block->memory_pool_index >> 5;
+	uint16_t index = block->memory_pool_index >> 5;
+	uint16_t first;
 
-	update_stop();
-	if (block->ref_count > 1) 
+	if (__atomic_sub_fetch(&block->ref_count, 1, __ATOMIC_ACQ_REL) > 0) 
 	{
-		block->ref_count--;
-	}
-	else 
-	{
-		audio_data_blocks_memory_pool_available_mask[index] |= mask;
-		if (index < audio_data_blocks_memory_pool_first_mask)
-		{
-			audio_data_blocks_memory_pool_first_mask = index;
-		}
+		// Still owned by others
+		return;
 	}
+	
+	__atomic_fetch_or(&audio_data_blocks_memory_pool_available_mask[index], mask, __ATOMIC_RELEASE);
+	
+	first = __atomic_load_n(&audio_data_blocks_memory_pool_first_mask, __ATOMIC_RELAXED);
+	while ((index < first) &&
+		!__atomic_compare_exchange_n(&audio_data_blocks_memory_pool_first_mask,
+			&first,
+			index,
+			true,
+			__ATOMIC_RELAXED,
+			__ATOMIC_RELAXED)) ;
+}
 
-	update_start();
+/**
+*   @brief  Return the number of audio blocks pool contention events
+*			(failed allocation CAS attempts) since the last reset.
+*   @param  none
+*   @return contention events counter
+*/
+uint32_t AudioBlockFloat::get_audio_blocks_pool_contention_count()
+{
+	return __atomic_load_n(&audio_data_blocks_memory_pool_contention_count, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Reset the audio blocks pool contention events counter.
+*   @param  none
+*   @return void
+*/
+void AudioBlockFloat::reset_audio_blocks_pool_contention_count()
+{
+	__atomic_store_n(&audio_data_blocks_memory_pool_contention_count, 0, __ATOMIC_RELAXED);
 }
 
 /**
@@ -276,7 +305,7 @@ void AudioBlockFloat::transmit_audio_block(audio_block_float_mono_t *block, uint
 			if (c->dst->audio_input_queue[c->dest_index] == NULL) 
 			{
 				c->dst->audio_input_queue[c->dest_index] = block;
-				block->ref_count++;
+				__atomic_add_fetch(&block->ref_count, 1, __ATOMIC_RELAXED);
 			}
 		}
 	}
@@ -321,16 +350,14 @@ audio_block_float_mono_t * AudioBlockFloat::receive_audio_block_writable(uint16_
 
 	in = audio_input_queue[index];
 	audio_input_queue[index] = NULL;
-	if (in && in->ref_count > 1) 
+	if (in && __atomic_load_n(&in->ref_count, __ATOMIC_ACQUIRE) > 1) 
 	{
-		pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 		p = allocate_audio_block();
-		pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 		if (p)
 		{
-			memcpy(p->data, in->data, sizeof(*p->data)); // <<<<<<<<<<<<<<<<
+			memcpy(p->data, in->data, audio_block_size * sizeof(*p->data));
 		}
-		in->ref_count--;
+		release_audio_block(in);
 		in = p;
 	}
 
@@ -73,6 +73,9 @@ public:
 	static void initialize_audio_memory(audio_block_float_mono_t *blocks, uint16_t num, uint16_t block_size);	
 	
 	static int16_t random(int16_t min, int16_t max);	
+	
+	static uint32_t get_audio_blocks_pool_contention_count();
+	static void reset_audio_blocks_pool_contention_count();
 
 	// Perform block processing 
 	virtual void update(void) = 0;
@@ -122,6 +125,8 @@ private:
 	static audio_block_float_mono_t *audio_data_blocks_memory_pool;
 	static uint32_t audio_data_blocks_memory_pool_available_mask[];
 	static uint16_t audio_data_blocks_memory_pool_first_mask;
+	// Counts lock-free allocation retries (CAS failures)
+	static uint32_t audio_data_blocks_memory_pool_contention_count;
 	static uint16_t audio_block_size;
 	
 	// period time in us 
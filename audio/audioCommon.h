@@ -14,6 +14,9 @@
 
 #define _AUDIO_MAX_BUF_SIZE				2048
 
+// Audio data arrays alignment (cache line / widest SIMD vector)
+#define _AUDIO_MEMORY_ALIGNMENT			64
+
 // Audio block of mono samples
 typedef struct audio_block_float_mono {
 
@@ -35,7 +38,7 @@ typedef struct shared_memory_audio_block_float_stereo_struct {
 	unsigned int id;
 	unsigned int ref_count;
 	unsigned int size;
-	float data[2][_AUDIO_MAX_BUF_SIZE];  // TODO: NOTE MAX BUFFER SIZE
+	alignas(_AUDIO_MEMORY_ALIGNMENT) float data[2][_AUDIO_MAX_BUF_SIZE];  // TODO: NOTE MAX BUFFER SIZE
 } shared_memory_audio_block_float_stereo_struct_t;
 
 
@@ -0,0 +1,253 @@
+/**
+*	@file		audioDspLoad.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		DSP load of the audio update cycle and voices admission control.
+*/
+
+#include "audioDspLoad.h"
+
+/**
+*   @brief  Create an AudioDspLoad object instance.
+*   @param  num_of_workers	number of voices rendering workers (cores)
+*   @return none
+*/
+AudioDspLoad::AudioDspLoad(int num_of_workers)
+{
+	int i;
+
+	this->num_of_workers = num_of_workers;
+	if (this->num_of_workers < 1)
+	{
+		this->num_of_workers = 1;
+	}
+
+	period_ns = 0;
+	average_ns = 0;
+	peak_ns = 0;
+	reserved_ns[0] = 0;
+	reserved_ns[1] = 0;
+	reserved_index = 0;
+	rejected_voices_count = 0;
+
+	for (i = 0; i < _AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES; i++)
+	{
+		voice_type_cost_ns[i] = _AUDIO_DSP_LOAD_DEFAULT_VOICE_COST_NS;
+	}
+
+	for (i = 0; i < _SYNTH_MAX_NUM_OF_VOICES; i++)
+	{
+		voice_type[i] = -1;
+	}
+}
+
+/**
+*   @brief  Record the render time of an update cycle.
+*   @param  render_ns	cycle render time (ns)
+*   @param	period_ns	period budget (ns)
+*   @return void
+*/
+void AudioDspLoad::record_cycle(uint64_t render_ns, uint64_t period_ns)
+{
+	int64_t average = (int64_t)__atomic_load_n(&average_ns, __ATOMIC_RELAXED);
+	uint64_t peak = __atomic_load_n(&peak_ns, __ATOMIC_RELAXED);
+	int older;
+
+	if ((int64_t)render_ns > average)
+	{
+		average += ((int64_t)render_ns - average) / (1 << _AUDIO_DSP_LOAD_AVERAGE_RISE_SHIFT);
+	}
+	else
+	{
+		average += ((int64_t)render_ns - average) / (1 << _AUDIO_DSP_LOAD_AVERAGE_FALL_SHIFT);
+	}
+
+	peak -= peak >> _AUDIO_DSP_LOAD_PEAK_DECAY_SHIFT;
+	if (render_ns > peak)
+	{
+		peak = render_ns;
+	}
+
+	__atomic_store_n(&average_ns, (uint64_t)average, __ATOMIC_RELAXED);
+	__atomic_store_n(&peak_ns, peak, __ATOMIC_RELAXED);
+	__atomic_store_n(&this->period_ns, period_ns, __ATOMIC_RELAXED);
+
+	// Voices admitted before the previous cycle started are measured now
+	older = 1 - __atomic_load_n(&reserved_index, __ATOMIC_RELAXED);
+	__atomic_store_n(&reserved_ns[older], 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&reserved_index, older, __ATOMIC_RELEASE);
+}
+
+/**
+*   @brief  Record the render cost of a voice rendered by the last update cycle
+*			into its voice type cost estimate.
+*   @param  voice	voice number
+*   @param	cost_ns	voice render time (ns)
+*   @return void
+*/
+void AudioDspLoad::record_voice_cost(int voice, uint64_t cost_ns)
+{
+	int64_t estimate;
+	int type;
+
+	if ((voice < 0) || (voice >= _SYNTH_MAX_NUM_OF_VOICES))
+	{
+		return;
+	}
+
+	type = __atomic_load_n(&voice_type[voice], __ATOMIC_RELAXED);
+	if ((type < 0) || (type >= _AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES))
+	{
+		return;
+	}
+
+	estimate = (int64_t)__atomic_load_n(&voice_type_cost_ns[type], __ATOMIC_RELAXED);
+	estimate += ((int64_t)cost_ns - estimate) / (1 << _AUDIO_DSP_LOAD_VOICE_COST_EWMA_SHIFT);
+	if (estimate < 1)
+	{
+		estimate = 1;
+	}
+
+	__atomic_store_n(&voice_type_cost_ns[type], (uint64_t)estimate, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Set the type of the program a voice is going to play.
+*   @param  voice	voice number
+*   @param	type	voice type 0 to _AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES - 1
+*   @return void
+*/
+void AudioDspLoad::set_voice_type(int voice, int type)
+{
+	if ((voice < 0) || (voice >= _SYNTH_MAX_NUM_OF_VOICES) ||
+		(type < 0) || (type >= _AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES))
+	{
+		return;
+	}
+
+	__atomic_store_n(&voice_type[voice], type, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Decide if another voice of a type can be rendered: the render time
+*			average and peak, with the cost of the voices admitted but not measured
+*			yet and the new voice cost (shared by the workers), must stay within
+*			the period budget limits. An admitted voice cost is reserved until it
+*			is measured.
+*			Callers must be serialized (note on).
+*   @param  type	voice type
+*   @return true if admitted; false if the next periods may miss their deadline
+*/
+bool AudioDspLoad::admit_voice(int type)
+{
+	uint64_t period = __atomic_load_n(&period_ns, __ATOMIC_RELAXED);
+	uint64_t cost, reserved;
+	int index;
+
+	if (period == 0)
+	{
+		// Not measured yet
+		return true;
+	}
+
+	cost = (get_voice_type_cost_ns(type) + num_of_workers - 1) / num_of_workers;
+	reserved = __atomic_load_n(&reserved_ns[0], __ATOMIC_RELAXED) +
+		__atomic_load_n(&reserved_ns[1], __ATOMIC_RELAXED);
+
+	if (((__atomic_load_n(&average_ns, __ATOMIC_RELAXED) + reserved + cost) * 100 >
+			period * _AUDIO_DSP_LOAD_AVERAGE_LIMIT_PERCENT) ||
+		((__atomic_load_n(&peak_ns, __ATOMIC_RELAXED) + reserved + cost) * 100 >
+			period * _AUDIO_DSP_LOAD_PEAK_LIMIT_PERCENT))
+	{
+		__atomic_add_fetch(&rejected_voices_count, 1, __ATOMIC_RELAXED);
+		return false;
+	}
+
+	index = __atomic_load_n(&reserved_index, __ATOMIC_ACQUIRE);
+	__atomic_add_fetch(&reserved_ns[index], cost, __ATOMIC_RELAXED);
+
+	return true;
+}
+
+/**
+*   @brief  Return a voice type render cost estimate.
+*   @param  type	voice type
+*   @return estimated voice render time (ns); the highest estimate if type is out of range
+*/
+uint64_t AudioDspLoad::get_voice_type_cost_ns(int type)
+{
+	uint64_t cost, max_cost = 0;
+	int i;
+
+	if ((type >= 0) && (type < _AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES))
+	{
+		return __atomic_load_n(&voice_type_cost_ns[type], __ATOMIC_RELAXED);
+	}
+
+	for (i = 0; i < _AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES; i++)
+	{
+		cost = __atomic_load_n(&voice_type_cost_ns[i], __ATOMIC_RELAXED);
+		if (cost > max_cost)
+		{
+			max_cost = cost;
+		}
+	}
+
+	return max_cost;
+}
+
+/**
+*   @brief  Return the render time moving average as a percent of the period.
+*   @param  none
+*   @return load percents (may exceed 100); 0 if not measured yet
+*/
+int AudioDspLoad::get_load_percent()
+{
+	uint64_t period = __atomic_load_n(&period_ns, __ATOMIC_RELAXED);
+
+	if (period == 0)
+	{
+		return 0;
+	}
+
+	return (int)(__atomic_load_n(&average_ns, __ATOMIC_RELAXED) * 100 / period);
+}
+
+/**
+*   @brief  Return the render time (decaying) peak as a percent of the period.
+*   @param  none
+*   @return peak load percents (may exceed 100); 0 if not measured yet
+*/
+int AudioDspLoad::get_peak_load_percent()
+{
+	uint64_t period = __atomic_load_n(&period_ns, __ATOMIC_RELAXED);
+
+	if (period == 0)
+	{
+		return 0;
+	}
+
+	return (int)(__atomic_load_n(&peak_ns, __ATOMIC_RELAXED) * 100 / period);
+}
+
+/**
+*   @brief  Return the number of voices that were not admitted since the last reset.
+*   @param  none
+*   @return rejected voices count
+*/
+uint32_t AudioDspLoad::get_rejected_voices_count()
+{
+	return __atomic_load_n(&rejected_voices_count, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Reset the rejected voices counter.
+*   @param  none
+*   @return void
+*/
+void AudioDspLoad::reset_rejected_voices_count()
+{
+	__atomic_store_n(&rejected_voices_count, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,77 @@
+/**
+*	@file		audioDspLoad.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		DSP load of the audio update cycle: the measured render time of
+*				each period (moving average and decaying peak) against the period
+*				budget, and per voice type render cost estimates.
+*				A new voice is admitted only if the next periods, with the added
+*				voice cost, are still expected to meet their deadline.
+*/
+
+#ifndef _AUDIO_DSP_LOAD
+#define _AUDIO_DSP_LOAD
+
+#include <stdint.h>
+
+#include "../libAdjHeartModSynth_2.h"
+
+#define _AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES		8
+// Initial voice cost estimate of a voice type (before it was ever measured)
+#define _AUDIO_DSP_LOAD_DEFAULT_VOICE_COST_NS		20000
+// Render time moving average: avg += (measured - avg) >> shift
+// (rises faster than it falls, so a voice added load is seen within a few periods)
+#define _AUDIO_DSP_LOAD_AVERAGE_RISE_SHIFT			1
+#define _AUDIO_DSP_LOAD_AVERAGE_FALL_SHIFT			3
+// Render time peak decay per period: peak -= peak >> shift
+#define _AUDIO_DSP_LOAD_PEAK_DECAY_SHIFT			6
+// Voice type cost smoothing: est += (measured - est) >> shift
+#define _AUDIO_DSP_LOAD_VOICE_COST_EWMA_SHIFT		4
+// Admission limits (percents of the period budget)
+#define _AUDIO_DSP_LOAD_AVERAGE_LIMIT_PERCENT		80
+#define _AUDIO_DSP_LOAD_PEAK_LIMIT_PERCENT			95
+
+class AudioDspLoad
+{
+public:
+	AudioDspLoad(int num_of_workers = 1);
+
+	// Audio update thread, at the end of each update cycle
+	void record_cycle(uint64_t render_ns, uint64_t period_ns);
+	void record_voice_cost(int voice, uint64_t cost_ns);
+
+	// Note on
+	void set_voice_type(int voice, int type);
+	bool admit_voice(int type);
+
+	uint64_t get_voice_type_cost_ns(int type);
+	int get_load_percent();
+	int get_peak_load_percent();
+	uint32_t get_rejected_voices_count();
+	void reset_rejected_voices_count();
+
+private:
+	// Voices are rendered in parallel by the voices scheduler workers
+	int num_of_workers;
+
+	// Last period budget, render time moving average and decaying peak (ns)
+	uint64_t period_ns;
+	uint64_t average_ns;
+	uint64_t peak_ns;
+
+	// Cost of voices admitted but not measured yet. A voice is applied by the
+	// cycle that follows its note on, so a reservation is kept for 2 cycles.
+	uint64_t reserved_ns[2];
+	int reserved_index;
+
+	// Per voice type render cost estimate (ns)
+	uint64_t voice_type_cost_ns[_AUDIO_DSP_LOAD_MAX_NUM_OF_VOICE_TYPES];
+	// Voice type of each voice (set on note on)
+	int voice_type[_SYNTH_MAX_NUM_OF_VOICES];
+
+	uint32_t rejected_voices_count;
+};
+
+#endif
@@ -0,0 +1,231 @@
+/**
+*	@file		audioLatencyStats.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Lock-free per-stage processing time histograms of the audio
+*				update cycle, and deadline misses counter.
+*				Audio threads only perform relaxed atomic increments (several
+*				voice workers may record the same stage concurrently); a non
+*				real-time thread reads the histograms at any time. A reset while
+*				audio is running may lose a few samples, which is acceptable.
+*/
+
+#include "audioLatencyStats.h"
+
+/**
+*   @brief  Create an AudioLatencyStats object instance.
+*   @param  none
+*   @return none
+*/
+AudioLatencyStats::AudioLatencyStats()
+{
+	reset();
+}
+
+/**
+*   @brief  Return the histogram bucket of a time value.
+*			Values below _AUDIO_LATENCY_SUB_BUCKETS have their own bucket;
+*			above, each power of 2 is split into _AUDIO_LATENCY_SUB_BUCKETS
+*			linear sub-buckets.
+*   @param  time_ns	time in ns
+*   @return bucket index
+*/
+int AudioLatencyStats::get_bucket_index(uint64_t time_ns)
+{
+	int exp;
+
+	if (time_ns < _AUDIO_LATENCY_SUB_BUCKETS)
+	{
+		return (int)time_ns;
+	}
+
+	exp = 63 - __builtin_clzll(time_ns);
+
+	return (exp - _AUDIO_LATENCY_SUB_BUCKETS_BITS + 1) * _AUDIO_LATENCY_SUB_BUCKETS +
+		(int)((time_ns >> (exp - _AUDIO_LATENCY_SUB_BUCKETS_BITS)) & (_AUDIO_LATENCY_SUB_BUCKETS - 1));
+}
+
+/**
+*   @brief  Return the highest time value that falls into a bucket.
+*   @param  index	bucket index
+*   @return time in ns
+*/
+uint64_t AudioLatencyStats::get_bucket_upper_bound_ns(int index)
+{
+	int exp, sub;
+
+	if (index < _AUDIO_LATENCY_SUB_BUCKETS)
+	{
+		return (uint64_t)index;
+	}
+
+	exp = index / _AUDIO_LATENCY_SUB_BUCKETS + _AUDIO_LATENCY_SUB_BUCKETS_BITS - 1;
+	sub = index % _AUDIO_LATENCY_SUB_BUCKETS;
+
+	return (((uint64_t)(_AUDIO_LATENCY_SUB_BUCKETS + sub + 1)) << (exp - _AUDIO_LATENCY_SUB_BUCKETS_BITS)) - 1;
+}
+
+/**
+*   @brief  Record a stage processing time.
+*   @param  stage	_AUDIO_LATENCY_STAGE_START_TASKS ... _AUDIO_LATENCY_STAGE_CYCLE
+*   @param  time_ns	processing time in ns
+*   @return void
+*/
+void AudioLatencyStats::record(int stage, uint64_t time_ns)
+{
+	audio_latency_histogram_t *hist;
+	uint64_t max;
+
+	if ((stage < 0) || (stage >= _AUDIO_LATENCY_NUM_OF_STAGES))
+	{
+		return;
+	}
+
+	hist = &histograms[stage];
+
+	__atomic_add_fetch(&hist->buckets[get_bucket_index(time_ns)], 1, __ATOMIC_RELAXED);
+	__atomic_add_fetch(&hist->count, 1, __ATOMIC_RELAXED);
+
+	max = __atomic_load_n(&hist->max_ns, __ATOMIC_RELAXED);
+	while ((time_ns > max) &&
+		!__atomic_compare_exchange_n(&hist->max_ns, &max, time_ns, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+/**
+*   @brief  Record a complete update cycle processing time and count a deadline
+*			miss if it took longer than the deadline.
+*   @param  time_ns		processing time in ns
+*   @param  deadline_ns	audio period time in ns (0: no deadline check)
+*   @return void
+*/
+void AudioLatencyStats::record_cycle(uint64_t time_ns, uint64_t deadline_ns)
+{
+	record(_AUDIO_LATENCY_STAGE_CYCLE, time_ns);
+
+	if ((deadline_ns > 0) && (time_ns > deadline_ns))
+	{
+		__atomic_add_fetch(&deadline_misses_count, 1, __ATOMIC_RELAXED);
+	}
+}
+
+/**
+*   @brief  Return a percentile of a stage processing time.
+*   @param  stage		_AUDIO_LATENCY_STAGE_START_TASKS ... _AUDIO_LATENCY_STAGE_CYCLE
+*   @param  percentile	0.0 to 100.0
+*   @return time in ns (bucket upper bound, never above the max); -1 param out of range
+*/
+int AudioLatencyStats::get_percentile_ns(int stage, float percentile)
+{
+	audio_latency_histogram_t *hist;
+	uint64_t target, acc = 0, total = 0, max, res = 0;
+	int b;
+
+	if ((stage < 0) || (stage >= _AUDIO_LATENCY_NUM_OF_STAGES) || (percentile < 0.0f) || (percentile > 100.0f))
+	{
+		return -1;
+	}
+
+	hist = &histograms[stage];
+
+	// Buckets may be updated while scanning - use the buckets sum rather than count
+	for (b = 0; b < _AUDIO_LATENCY_NUM_OF_BUCKETS; b++)
+	{
+		total += __atomic_load_n(&hist->buckets[b], __ATOMIC_RELAXED);
+	}
+
+	if (total == 0)
+	{
+		return 0;
+	}
+
+	target = (uint64_t)((double)percentile / 100.0 * (double)total + 0.5);
+	if (target < 1)
+	{
+		target = 1;
+	}
+
+	for (b = 0; b < _AUDIO_LATENCY_NUM_OF_BUCKETS; b++)
+	{
+		acc += __atomic_load_n(&hist->buckets[b], __ATOMIC_RELAXED);
+		if (acc >= target)
+		{
+			res = get_bucket_upper_bound_ns(b);
+			break;
+		}
+	}
+
+	max = __atomic_load_n(&hist->max_ns, __ATOMIC_RELAXED);
+	if ((res > max) || (b == _AUDIO_LATENCY_NUM_OF_BUCKETS))
+	{
+		res = max;
+	}
+
+	return res > 0x7fffffff ? 0x7fffffff : (int)res;
+}
+
+/**
+*   @brief  Return the maximum recorded stage processing time.
+*   @param  stage	_AUDIO_LATENCY_STAGE_START_TASKS ... _AUDIO_LATENCY_STAGE_CYCLE
+*   @return time in ns; -1 param out of range
+*/
+int AudioLatencyStats::get_max_ns(int stage)
+{
+	uint64_t max;
+
+	if ((stage < 0) || (stage >= _AUDIO_LATENCY_NUM_OF_STAGES))
+	{
+		return -1;
+	}
+
+	max = __atomic_load_n(&histograms[stage].max_ns, __ATOMIC_RELAXED);
+
+	return max > 0x7fffffff ? 0x7fffffff : (int)max;
+}
+
+/**
+*   @brief  Return the number of recorded samples of a stage.
+*   @param  stage	_AUDIO_LATENCY_STAGE_START_TASKS ... _AUDIO_LATENCY_STAGE_CYCLE
+*   @return number of samples; -1 param out of range
+*/
+int AudioLatencyStats::get_count(int stage)
+{
+	if ((stage < 0) || (stage >= _AUDIO_LATENCY_NUM_OF_STAGES))
+	{
+		return -1;
+	}
+
+	return (int)__atomic_load_n(&histograms[stage].count, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Return the number of update cycles that missed their deadline.
+*   @param  none
+*   @return deadline misses counter
+*/
+uint32_t AudioLatencyStats::get_deadline_misses_count()
+{
+	return __atomic_load_n(&deadline_misses_count, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Clear all the histograms and the deadline misses counter.
+*   @param  none
+*   @return void
+*/
+void AudioLatencyStats::reset()
+{
+	for (int s = 0; s < _AUDIO_LATENCY_NUM_OF_STAGES; s++)
+	{
+		for (int b = 0; b < _AUDIO_LATENCY_NUM_OF_BUCKETS; b++)
+		{
+			__atomic_store_n(&histograms[s].buckets[b], 0, __ATOMIC_RELAXED);
+		}
+
+		__atomic_store_n(&histograms[s].count, 0, __ATOMIC_RELAXED);
+		__atomic_store_n(&histograms[s].max_ns, 0, __ATOMIC_RELAXED);
+	}
+
+	__atomic_store_n(&deadline_misses_count, 0, __ATOMIC_RELAXED);
+}
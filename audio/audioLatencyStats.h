@@ -0,0 +1,71 @@
+/**
+*	@file		audioLatencyStats.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Lock-free per-stage processing time histograms of the audio
+*				update cycle, and deadline misses counter.
+*/
+
+#ifndef _AUDIO_LATENCY_STATS
+#define _AUDIO_LATENCY_STATS
+
+#include <stdint.h>
+#include <time.h>
+
+#include "../libAdjHeartModSynth_2.h"
+
+// Log-linear (HDR style) buckets: 2^_AUDIO_LATENCY_SUB_BUCKETS_BITS linear
+// sub-buckets per power of 2 (~6% resolution)
+#define _AUDIO_LATENCY_SUB_BUCKETS_BITS			4
+#define _AUDIO_LATENCY_SUB_BUCKETS				(1 << _AUDIO_LATENCY_SUB_BUCKETS_BITS)
+#define _AUDIO_LATENCY_NUM_OF_BUCKETS			((64 - _AUDIO_LATENCY_SUB_BUCKETS_BITS + 1) * _AUDIO_LATENCY_SUB_BUCKETS)
+
+/**
+*   @brief  Return a monotonic timestamp
+*   @param  none
+*   @return time in ns
+*/
+static inline uint64_t audio_latency_now_ns()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+typedef struct audio_latency_histogram
+{
+	uint32_t buckets[_AUDIO_LATENCY_NUM_OF_BUCKETS];
+	uint32_t count;
+	uint64_t max_ns;
+} audio_latency_histogram_t;
+
+class AudioLatencyStats
+{
+public:
+	AudioLatencyStats();
+
+	// Real-time side (any audio thread)
+	void record(int stage, uint64_t time_ns);
+	void record_cycle(uint64_t time_ns, uint64_t deadline_ns);
+
+	// Non real-time side
+	int get_percentile_ns(int stage, float percentile);
+	int get_max_ns(int stage);
+	int get_count(int stage);
+	uint32_t get_deadline_misses_count();
+	void reset();
+
+private:
+	static int get_bucket_index(uint64_t time_ns);
+	static uint64_t get_bucket_upper_bound_ns(int index);
+
+	audio_latency_histogram_t histograms[_AUDIO_LATENCY_NUM_OF_STAGES];
+
+	uint32_t deadline_misses_count;
+};
+
+#endif
@@ -12,9 +12,12 @@
 *	@brief		Manage and control audio system
 */
 
-#include <sys/shm.h>		//Used for shared memory
+#include <sys/mman.h>		//Used for exported audio memory
 #include <sys/time.h>
-#include <omp.h>
+#include <unistd.h>
+#include <string.h>
+#include <new>
+#include <semaphore.h>
 
 #include "audioManager.h"
 #include "audioCommon.h"
@@ -23,24 +26,30 @@
 #include "../commonDefs.h"
 #include "../alsa/alsaAudioHandling.h"
 #include "jackAudioClients.h"
+#include "audioParamsQueue.h"
+#include "audioVoiceEvents.h"
 
 /* A pointer to the singleton AudioManageFloat instance */
 AudioManager *AudioManager::audio_manager_instance = NULL;
 
+int AudioManager::audio_memory_export_mode = _AUDIO_MEMORY_EXPORT_NONE;
+
 func_ptr_void_int_t AudioManager::callback_audio_update_cycle_start_tasks_ptr = NULL;
 func_ptr_void_int_t AudioManager::callback_audio_voice_update_ptr = NULL;
+func_ptr_bool_int_t AudioManager::callback_audio_voice_is_active_ptr = NULL;
 func_ptr_void_int_t AudioManager::callback_audio_update_cycle_end_tasks_ptr = NULL;
 
 /* Mutexs to control polyphonic voices update process */
 pthread_mutex_t update_mutex[_SYNTH_MAX_NUM_OF_VOICES];
 
-// Mutex to controll audio memory blocks allocation 
-extern pthread_mutex_t voice_mem_blocks_allocation_control_mutex;
-
-/* Update thread conditional variable signaling */
-pthread_cond_t update_thread_cv = PTHREAD_COND_INITIALIZER;
-/* Update thread control mutex */
-pthread_mutex_t update_thread_mutex = PTHREAD_MUTEX_INITIALIZER; 
+/* Update thread wake-up signaling (counting - no lost wake-ups, safe to post from RT callbacks) */
+sem_t update_thread_sem;
+/* True while an update cycle is running (update thread or JACK callback in pull mode) */
+bool update_cycle_in_progress = false;
+/* Number of completed update cycles (used to retire data still read by an in-flight cycle) */
+uint64_t update_cycles_count = 0;
+/* Last sampled update cycle utilization [%] of the period time */
+int update_cycle_utilization = 0;
 
 /* True when update thread is running, false otherwise */
 bool update_thread_is_running = false;
@@ -66,7 +75,7 @@ AudioManager *AudioManager::get_instance() {
 
 /**
 *   @brief  Create an AudioManageFloat object instance.
-*   @param  mseed	a random number used for allocating shared memory.
+*   @param  mseed	a positive instance seed number.
 *   @return none
 */
 AudioManager::AudioManager(int mseed)
@@ -88,10 +97,31 @@ AudioManager::AudioManager(int mseed)
 	
 	jack_thread_is_running = false;
 	
+	audio_driver = _DEFAULT_AUDIO_DRIVER;
+	audio_update_mode = _DEFAULT_AUDIO_UPDATE_MODE;
+	output_ring = new AudioOutputRing(_AUDIO_OUTPUT_RING_DEFAULT_NUM_OF_PERIODS);
+	
+	sem_init(&update_thread_sem, 0, 0);
+	
+	// Update cycle stages processing time histograms
+	latency_stats = new AudioLatencyStats();
+	
+	// Persistent voices rendering workers - one per core
+	voice_scheduler = new AudioVoiceScheduler(sysconf(_SC_NPROCESSORS_ONLN));
+	voice_scheduler->set_latency_stats(latency_stats);
+	
+	// Update cycle render time vs. period budget - voices admission control
+	dsp_load = new AudioDspLoad(voice_scheduler->get_num_of_workers());
+	
 	connections_manager = new AudioConnectionsManagerFloat();
 	
-	// Create shared memory blocks for audio data transfer
-	create_audio_shared_memory(mem_seed);
+	// Create the voices and stereo outputs memory blocks
+	if (create_audio_memory_arena() != 0)
+	{
+		// The voices and outputs blocks pointers are not valid - the audio service
+		// can not be started (see is_audio_memory_arena_allocated())
+		fprintf(stderr, "Audio Manager: audio memory arena not allocated\n");
+	}
 	
 	for (int i = 0; i < _SYNTH_MAX_NUM_OF_VOICES; i++) 
 	{
@@ -115,74 +145,148 @@ AudioManager::~AudioManager()
 	{
 		stop_audio_service();
 	}
+	
+	free_audio_memory_arena();
 }
 
 /**
-*   @brief  Allocates shared memory segments for audio transfer.
-*   @param  seed	a random number used for allocating shared memory.
-*   @return 0 if ok
+*   @brief  Allocates the audio memory arena: one contiguous, _AUDIO_MEMORY_ALIGNMENT aligned
+*			block holding all voices outputs (adjacent, in voice order) followed by 
+*			the stereo output. 
+*			The arena is private to the process unless an export mode was set by 
+*			set_audio_memory_export() before the audio manager was created; in 
+*			that case it is mapped from a memfd that an external process can map.
+*   @param  none
+*   @return 0 if ok; -1 if memory could not be allocated
 */
-int AudioManager::create_audio_shared_memory(int seed)
+int AudioManager::create_audio_memory_arena()
 {
-	int voice, err = 0;
+	int voice;
+	void *mem = NULL;
 	
-	for (voice = 0; voice < _MAX_NUM_OF_VOICES; voice++)
+	audio_memory_arena_size = (_MAX_NUM_OF_VOICES + 1) * sizeof(shared_memory_audio_block_float_stereo_struct_t);
+	audio_memory_arena_size = (audio_memory_arena_size + _AUDIO_MEMORY_ALIGNMENT - 1) & ~(size_t)(_AUDIO_MEMORY_ALIGNMENT - 1);
+	audio_memory_export_fd = -1;
+	
+	if (audio_memory_export_mode == _AUDIO_MEMORY_EXPORT_MEMFD)
 	{
-		//fprintf(stderr, "Audio MAnager: Creating voices outputs shared memory %i...\n", voice);
-		audio_shared_mem_voices_output_ids[voice] =
-			shmget((key_t)(38131 + _AUDIO_MAX_BUF_SIZE + 1 + voice + seed), 
-			sizeof(shared_memory_audio_block_float_stereo_struct_t),
-			0666 | IPC_CREAT);
-		if (audio_shared_mem_voices_output_ids[voice] == -1)
+		audio_memory_export_fd = memfd_create("AdjHeartSynth_audio", MFD_CLOEXEC);
+		if ((audio_memory_export_fd >= 0) && (ftruncate(audio_memory_export_fd, audio_memory_arena_size) == 0))
+		{
+			// mmap() is page aligned
+			mem = mmap(NULL, audio_memory_arena_size, PROT_READ | PROT_WRITE, MAP_SHARED, audio_memory_export_fd, 0);
+			if (mem == MAP_FAILED)
+			{
+				mem = NULL;
+			}
+		}
+		
+		if (mem == NULL)
 		{
-			err = errno;
-			fprintf(stderr, "Audio-manager: Shared voices outputs shared memory voice %i shmget() failed err %s\r\n", voice, snd_strerror(err));
-			exit(EXIT_FAILURE);
+			fprintf(stderr, "Audio-manager: audio memory export failed err %s - using a private arena\n", strerror(errno));
+			if (audio_memory_export_fd >= 0)
+			{
+				close(audio_memory_export_fd);
+				audio_memory_export_fd = -1;
+			}
 		}
-
-		//Make the shared memory accessible to the program
-		audio_shared_mem_voices_output_pointers[voice] = shmat(audio_shared_mem_voices_output_ids[voice], (void *)0, 0);
-		if (audio_shared_mem_voices_output_pointers[voice] == (void *) - 1)
+	}
+	
+	if (mem == NULL)
+	{
+		if (posix_memalign(&mem, _AUDIO_MEMORY_ALIGNMENT, audio_memory_arena_size) != 0)
 		{
-			err = errno;
-			fprintf(stderr, "Audio-manager: Shared memory voice %i shmat() failed err %s\r\n", voice, snd_strerror(err));
-			exit(EXIT_FAILURE);
+			fprintf(stderr, "Audio-manager: audio memory arena allocation (%u bytes) failed\n", (unsigned int)audio_memory_arena_size);
+			audio_memory_arena = NULL;
+			for (voice = 0; voice < _MAX_NUM_OF_VOICES; voice++)
+			{
+				audio_block_stereo_float_shared_memory_voices_output[voice] = NULL;
+			}
+			audio_block_stereo_float_shared_memory_outputs = NULL;
+			
+			return -1;
 		}
+	}
+	
+	memset(mem, 0, audio_memory_arena_size);
+	audio_memory_arena = (shared_memory_audio_block_float_stereo_struct_t *)mem;
 	
-		//	fprintf(stderr, "Shared memory %i attached at %i\r\n", voice, (int)audio_shared_mem_voices_output_pointers[voice]);
-		//Assign the shared_memory segment to allocated memory segment
+	for (voice = 0; voice < _MAX_NUM_OF_VOICES; voice++)
+	{
 		audio_block_stereo_float_shared_memory_voices_output[voice] = 
-			(shared_memory_audio_block_float_stereo_struct_t *)audio_shared_mem_voices_output_pointers[voice];
+			new(&audio_memory_arena[voice]) shared_memory_audio_block_float_stereo_struct_t();
 	}
+	
+	audio_block_stereo_float_shared_memory_outputs = 
+		new(&audio_memory_arena[_MAX_NUM_OF_VOICES]) shared_memory_audio_block_float_stereo_struct_t();
+
+	return 0;
+}
 
-	//	fprintf(stderr, "Creating stereo output shared memory %i...\n", voice);
-	audio_shared_mem_stereo_output_id =
-		shmget((key_t)(38151 + _AUDIO_MAX_BUF_SIZE + 1 + voice + seed), 
-				sizeof(shared_memory_audio_block_float_stereo_struct_t),
-				0666 | IPC_CREAT);
-	if (audio_shared_mem_stereo_output_id == -1)
+/**
+*   @brief  Return true if the audio memory arena was allocated (the audio service
+*			and offline rendering can not run without it).
+*   @param  none
+*   @return true if allocated
+*/
+bool AudioManager::is_audio_memory_arena_allocated() { return audio_memory_arena != NULL; }
+
+/**
+*   @brief  Releases the audio memory arena.
+*   @param  none
+*   @return void
+*/
+void AudioManager::free_audio_memory_arena()
+{
+	if (audio_memory_arena == NULL)
 	{
-		err = errno;
-		fprintf(stderr, "Audio-manager Shared stereo output shared memory voice %i shmget() failed err %s\r\n", voice, snd_strerror(err));
-		exit(EXIT_FAILURE);
+		return;
 	}
+	
+	if (audio_memory_export_fd >= 0)
+	{
+		munmap(audio_memory_arena, audio_memory_arena_size);
+		close(audio_memory_export_fd);
+		audio_memory_export_fd = -1;
+	}
+	else
+	{
+		free(audio_memory_arena);
+	}
+	
+	audio_memory_arena = NULL;
+}
 
-	//Make the shared memory accessible to the program
-	audio_shared_mem_stereo_output_pointer = shmat(audio_shared_mem_stereo_output_id, (void *)0, 0);
-	if (audio_shared_mem_stereo_output_pointer == (void *) - 1)
+/**
+*   @brief  Sets the audio memory export mode. Must be called before the 
+*			audio manager instance is created (before the synthesizer is initialized).
+*   @param  mode	_AUDIO_MEMORY_EXPORT_NONE (private in-process arena) or
+*					_AUDIO_MEMORY_EXPORT_MEMFD (arena is mapped from a memfd, see get_audio_memory_export_fd())
+*   @return set mode; -1 param out of range or the audio manager was already created
+*/
+int AudioManager::set_audio_memory_export(int mode)
+{
+	if (((mode != _AUDIO_MEMORY_EXPORT_NONE) && (mode != _AUDIO_MEMORY_EXPORT_MEMFD)) ||
+		audio_manager_instance)
 	{
-		fprintf(stderr, "Audio-manager Sterso output Shared memory voice %i shmat() failed error %s\r\n", voice, snd_strerror(err));
-		exit(EXIT_FAILURE);
+		return -1;
 	}
 	
-	//	fprintf(stderr, "Stereo output Shared memory %i attached at %i\r\n", voice, (int)audio_shared_mem_stereo_output_pointer);
+	audio_memory_export_mode = mode;
 	
-	//Assign the shared_memory segment to allocated memory segment
-	audio_block_stereo_float_shared_memory_outputs = (shared_memory_audio_block_float_stereo_struct_t *)audio_shared_mem_stereo_output_pointer;
-
-	return err;
+	return mode;
 }
 
+/**
+*   @brief  Returns the file descriptor of the exported audio memory arena.
+*			An external process can map it (e.g. through /proc/<pid>/fd/<fd> or
+*			a unix socket) - layout: _MAX_NUM_OF_VOICES voices outputs blocks
+*			followed by the stereo output block.
+*   @param  none
+*   @return memfd file descriptor; -1 if the arena is not exported
+*/
+int AudioManager::get_audio_memory_export_fd() { return audio_memory_export_fd; }
+
 /**
 *	@brief	Sets the sample-rate. Update also period_time
 *	@param	sample  rate: _SAMPLE_RATE_44 (44100Hz) or _SAMPLE_RATE_48 (48000Hz)
@@ -349,18 +453,38 @@ int AudioManager::start_jack_service(int mode, bool auto_start, bool auto_connec
 *	@param	samp_rate	sample  rate: _SAMPLE_RATE_44 (44100Hz) or _SAMPLE_RATE_48 (48000Hz)
 *						if non of the above, sample rate is set to _DEFAULT_SAMPLE_RATE (44100).
 *	@param  block_size	audio block size:_AUDIO_BLOCK_SIZE_256, _AUDIO_BLOCK_SIZE_512, _AUDIO_BLOCK_SIZE_1024
-*   @return 0 if ok
+*   @return 0 if ok; -1 if the audio memory arena was not allocated
 */
 int AudioManager::start_audio_service(int driver, int samp_rate, int block_size)
 {
 	//	startUpdateProcessPeriodicTimer();
 	
+	if (!is_audio_memory_arena_allocated())
+	{
+		fprintf(stderr, "Audio Manager: can not start audio - no audio memory arena\n");
+		return -1;
+	}
+	
+	if (period_time_us < 1000)
+	{
+		// period < 1msec - checked here and not by the (realtime) update cycles
+		fprintf(stderr, "Audio Manager: can not start audio - period < 1msec\n");
+		return -1;
+	}
+	
 	if(audio_service_started)
 	{
 		stop_audio_service();
 	}
 	
-	audio_service_started = true;
+	__atomic_store_n(&audio_service_started, true, __ATOMIC_RELEASE);
+	audio_driver = driver;
+	
+	// Start with an empty output ring
+	output_ring->reset();
+	
+	// Parameters updates are now applied by the audio update cycles
+	AudioParamsQueue::get_instance()->set_active(true);
 
 	start_audio_update_thread();
 	
@@ -391,13 +515,16 @@ int AudioManager::start_audio_service(int driver, int samp_rate, int block_size)
 */
 int AudioManager::stop_audio_service()
 {
-	audio_service_started = false;
+	__atomic_store_n(&audio_service_started, false, __ATOMIC_RELEASE);
 	stop_audio_update_thread();
 	stop_jack_connect_thread();
 	disconnect_jack_audio_ports_out();
 	disconnect_jack_audio_ports_in();
 	stop_alsa_main_thread();
 	
+	// No more update cycles - apply pending parameters updates, and from now on apply directly
+	AudioParamsQueue::get_instance()->set_active(false);
+	
 	return 0;
 }
 
@@ -443,9 +570,114 @@ void AudioManager::start_audio_update_thread()
 */
 void AudioManager::stop_audio_update_thread()
 {
+	if (!update_thread_is_running)
+	{
+		return;
+	}
+	
 	update_thread_is_running = false;
+	// Wake the thread so it can exit, and wait for its last cycle to complete
+	signal_audio_update();
+	pthread_join(update_thread_id, NULL);
+}
+
+/**
+*   @brief  Wake the audio update thread to render the next period(s).
+*			Wait-free - safe to call from the JACK process callback.
+*   @param  none
+*   @return none
+*/
+void AudioManager::signal_audio_update()
+{
+	sem_post(&update_thread_sem);
+}
+
+/**
+*   @brief  Set the audio update mode.
+*   @param  mode	_AUDIO_UPDATE_MODE_PUSH: an update thread renders ahead into the output ring,
+*					woken by the audio driver callback.
+*					_AUDIO_UPDATE_MODE_PULL: the JACK process callback renders each period in place
+*					(one period less latency). Applies to the JACK driver only.
+*   @return set mode; -1 param out of range
+*/
+int AudioManager::set_audio_update_mode(int mode)
+{
+	if ((mode != _AUDIO_UPDATE_MODE_PUSH) && (mode != _AUDIO_UPDATE_MODE_PULL))
+	{
+		return -1;
+	}
+	
+	__atomic_store_n(&audio_update_mode, mode, __ATOMIC_RELEASE);
+	
+	return mode;
 }
 
+/**
+*   @brief  Return the audio update mode.
+*   @param  none
+*   @return _AUDIO_UPDATE_MODE_PUSH or _AUDIO_UPDATE_MODE_PULL
+*/
+int AudioManager::get_audio_update_mode() 
+{ 
+	return __atomic_load_n(&audio_update_mode, __ATOMIC_ACQUIRE); 
+}
+
+/**
+*   @brief  Set the number of periods of the JACK output ring (push mode latency).
+*			Audio service is restarted if running.
+*   @param  num	number of periods (_AUDIO_OUTPUT_RING_MIN_NUM_OF_PERIODS to _AUDIO_OUTPUT_RING_MAX_NUM_OF_PERIODS)
+*   @return set number of periods; -1 param out of range
+*/
+int AudioManager::set_output_ring_num_of_periods(int num)
+{
+	bool restart = audio_service_started;
+	int res;
+	
+	if ((num < _AUDIO_OUTPUT_RING_MIN_NUM_OF_PERIODS) || (num > _AUDIO_OUTPUT_RING_MAX_NUM_OF_PERIODS))
+	{
+		return -1;
+	}
+	
+	if (restart)
+	{
+		stop_audio_service();
+	}
+	
+	res = output_ring->set_num_of_periods(num);
+	
+	if (restart)
+	{
+		start_audio_service(audio_driver, sample_rate, audio_block_size);
+	}
+	
+	return res;
+}
+
+/**
+*   @brief  Return the output ring used by the current configuration.
+*   @param  none
+*   @return a pointer to the output ring when the JACK service runs in push mode; NULL otherwise
+*			(output is written directly to audio_block_stereo_float_shared_memory_outputs)
+*/
+AudioOutputRing *AudioManager::get_active_output_ring()
+{
+	if (audio_service_started && (audio_driver == _AUDIO_JACK) && (get_audio_update_mode() == _AUDIO_UPDATE_MODE_PUSH))
+	{
+		return output_ring;
+	}
+	else
+	{
+		return NULL;
+	}
+}
+
+/**
+*   @brief  Return the output ring.
+*   @param  none
+*   @return a pointer to the output ring
+*/
+AudioOutputRing *AudioManager::get_output_ring() { return output_ring; }
+
 /**
 *   @brief  Start the main ALSA thread.
 *   @param  none
@@ -660,6 +892,84 @@ void AudioManager::register_callback_audio_voice_update(func_ptr_void_int_t ptr)
 	callback_audio_voice_update_ptr = ptr;
 }
 
+/**
+*   @brief  Register a callback function that returns true if a voice has to be
+*			rendered in the current audio update cycle (only these voices are scheduled).
+*			If not registered, all voices are scheduled.
+*   @param  ptr	a pointer to the callback function
+*   @return void
+*/
+void AudioManager::register_callback_audio_voice_is_active(func_ptr_bool_int_t ptr)
+{
+	callback_audio_voice_is_active_ptr = ptr;
+}
+
+/**
+*   @brief  Return the voices rendering scheduler.
+*   @param  none
+*   @return a pointer to the voices scheduler
+*/
+AudioVoiceScheduler *AudioManager::get_voice_scheduler() { return voice_scheduler; }
+
+/**
+*   @brief  Return the update cycle stages processing time histograms.
+*   @param  none
+*   @return a pointer to the AudioLatencyStats object
+*/
+AudioLatencyStats *AudioManager::get_latency_stats() { return latency_stats; }
+
+/**
+*   @brief  Return the update cycle DSP load (voices admission control).
+*   @param  none
+*   @return a pointer to the AudioDspLoad object
+*/
+AudioDspLoad *AudioManager::get_dsp_load() { return dsp_load; }
+
+/**
+*   @brief  Return the number of completed audio update cycles.
+*			Data replaced while a cycle may still read it can be released
+*			once this count advanced past that cycle.
+*   @param  none
+*   @return the number of completed audio update cycles
+*/
+uint64_t AudioManager::get_update_cycles_count()
+{ 
+	return __atomic_load_n(&update_cycles_count, __ATOMIC_ACQUIRE); 
+}
+
+/**
+*   @brief  Return the last sampled update cycle processing time,
+*			in percents of the period time. Sampled by the update cycles
+*			every 40 periods; read by a non realtime thread.
+*   @param  none
+*   @return the update cycle utilization [%]
+*/
+int AudioManager::get_update_cycle_utilization()
+{ 
+	return __atomic_load_n(&update_cycle_utilization, __ATOMIC_RELAXED); 
+}
+
+/**
+*   @brief  Return true while an audio update cycle is running.
+*   @param  none
+*   @return true while an audio update cycle is running
+*/
+bool AudioManager::is_update_cycle_in_progress()
+{ 
+	return __atomic_load_n(&update_cycle_in_progress, __ATOMIC_ACQUIRE); 
+}
+
+/**
+*   @brief  Return true while the real-time audio service is started (false while
+*			the update cycles are run offline, e.g. by an offline render or a benchmark).
+*   @param  none
+*   @return true while the audio service is started
+*/
+bool AudioManager::is_audio_service_started()
+{ 
+	return __atomic_load_n(&audio_service_started, __ATOMIC_ACQUIRE); 
+}
+
 /**
 *   @brief  A callback function that is called at the end of every audio update cycle.
 *			Registered function should be small as possible.
@@ -686,104 +996,131 @@ void AudioManager::register_callback_audio_update_cycle_end_tasks(func_ptr_void_
 }
 
 /**
-*   @brief  Main audio-block processing update thread
+*   @brief  Execute a single audio update cycle: start tasks, all voices, 
+*			end tasks (poly-mixer, reverb, stereo-output).
+*			Called by the update thread (push mode) or directly by the JACK
+*			process callback (pull mode). Only one cycle may run at a time;
+*			a concurrent call returns immediately without rendering.
+*   @param  none
+*   @return 0 if a cycle was executed; -1 if a cycle is already in progress
+*/
+int AudioManager::run_audio_update_cycle()
+{
+	static int count = 0;
+	int utilization, num_of_cycle_voices, i;
+	const int *cycle_voices;
+	uint64_t cycle_start_ns, start_ns, voices_ns, stop_ns;
+	unsigned long period_time_us;
+	
+	if (__atomic_exchange_n(&update_cycle_in_progress, true, __ATOMIC_ACQUIRE))
+	{
+		return -1;
+	}
+	
+	period_time_us = get_period_time_us();
+	
+	cycle_start_ns = audio_latency_now_ns();
+	
+	// Apply parameters updates posted by the control threads since the last cycle,
+	// before any voice or common block is processed.
+	AudioParamsQueue::get_instance()->apply_pending();
+	
+	// Timing reference of the voices note on/off events applied in this cycle
+	AudioVoiceEventsQueue::set_cycle_start_ns(cycle_start_ns);
+	
+	// Activate update cycle start tasks (e.g. ModSynth::update_tasks() )
+	if(AudioManager::callback_audio_update_cycle_start_tasks_ptr)
+	{
+		AudioManager::callback_audio_update_cycle_start_tasks_ptr(0);	// 0 - dummy param
+	}
+
+	start_ns = audio_latency_now_ns();
+
+	// Activate each active voice update on the voices workers pool
+	voice_scheduler->run_cycle(
+		mod_synth_get_synthesizer_num_of_polyphonic_voices(),
+		AudioManager::callback_audio_voice_is_active_ptr,
+		AudioManager::callback_audio_voice_update_ptr);
+	
+	voices_ns = audio_latency_now_ns();
+		
+	// Update common blocks: poly-mixer, reverb, stereo-output	
+	if(AudioManager::callback_audio_update_cycle_end_tasks_ptr)
+	{
+		AudioManager::callback_audio_update_cycle_end_tasks_ptr(0); 	// 0 - dummy param
+	}
+
+	stop_ns = audio_latency_now_ns();
+	
+	latency_stats->record(_AUDIO_LATENCY_STAGE_START_TASKS, start_ns - cycle_start_ns);
+	latency_stats->record(_AUDIO_LATENCY_STAGE_VOICES, voices_ns - start_ns);
+	latency_stats->record_cycle(stop_ns - cycle_start_ns, (uint64_t)period_time_us * 1000);
+	
+	// DSP load and voice types costs for the voices admission control
+	dsp_load->record_cycle(stop_ns - cycle_start_ns, (uint64_t)period_time_us * 1000);
+	num_of_cycle_voices = voice_scheduler->get_cycle_voices(&cycle_voices);
+	for (i = 0; i < num_of_cycle_voices; i++)
+	{
+		dsp_load->record_voice_cost(cycle_voices[i], voice_scheduler->get_voice_cost_ns(cycle_voices[i]));
+	}
+
+	count++;
+	if ((count % 40) == 0)
+	{
+		// Reported to the GUI by a non realtime thread (see get_update_cycle_utilization())
+		utilization = (int)((float)(stop_ns - start_ns) / ((float)period_time_us * 1000.0f) * 100.0f);
+		__atomic_store_n(&update_cycle_utilization, utilization, __ATOMIC_RELAXED);
+		count = 0;
+	}
+	
+	__atomic_add_fetch(&update_cycles_count, 1, __ATOMIC_RELEASE);
+	__atomic_store_n(&update_cycle_in_progress, false, __ATOMIC_RELEASE);
+	
+	return 0;
+}
+
+/**
+*   @brief  Main audio-block processing update thread.
+*			Woken by signal_audio_update(). When an output ring is active
+*			(JACK push mode) it renders ahead until the ring is full;
+*			otherwise it renders a single period per wake-up.
+*			In pull mode the JACK callback does not wake it.
 *   @param  arg a pointer to a void argument (not in use)
 *   @return void*
 */
 void* AUDMNG_update_thread(void *arg)
 {
-	int lockCount = 0, voice, count;
-	int ID;
-	int core, utilization;
-	struct timeval start_ts, prv_start_ts;
-	struct timeval stop_ts;
-	
-	unsigned long period_time_us;
+	AudioManager *manager = AudioManager::get_instance();
+	AudioOutputRing *ring;
 	
 	while (update_thread_is_running)
 	{
+		if (sem_wait(&update_thread_sem) != 0)
+		{
+			// Interrupted (EINTR)
+			continue;
+		}
 		
-		pthread_mutex_lock(&update_thread_mutex);
-		pthread_cond_wait(&update_thread_cv, &update_thread_mutex);
-		pthread_mutex_unlock(&update_thread_mutex);
-			
-		// Activate update cycle start tasks (e.g. ModSynth::update_tasks() )
-		if(AudioManager::callback_audio_update_cycle_start_tasks_ptr)
+		if (!update_thread_is_running)
 		{
-			AudioManager::callback_audio_update_cycle_start_tasks_ptr(0);	// 0 - dummy param
+			break;
 		}
-
-		prv_start_ts.tv_usec = start_ts.tv_usec;
-		gettimeofday(&start_ts, NULL);
-
-		//fprintf(stderr, "Time from last block: %i Time from prev block end time [us]: %i\n", startts.tv_usec- prvStartts.tv_usec, startts.tv_usec - stopts.tv_usec);
-
-		//omp_set_num_threads(4/*Synthesizer::numOfCores*/);
-				
-		int i;
-
-#pragma omp parallel if (AdjSynth::num_of_cores > 1) //private(voice)
+		
+		ring = manager->get_active_output_ring();
+		if (ring)
 		{
-#pragma omp for schedule(static)	
-			for (voice = 0; voice < mod_synth_get_synthesizer_num_of_polyphonic_voices(); voice++)
+			while (update_thread_is_running && (ring->get_num_of_free_periods() > 0))
 			{
-
-////			if(AdjSynth::synth_voice[voice]->audioVoice->isVoiceActive() ||
-////				AdjSynth::synth_voice[voice]->audioVoice->isVoiceWaitForNotActive())
-
+				if (manager->run_audio_update_cycle() != 0)
 				{
-					//ID = omp_get_thread_num();
-					//core = sched_getcpu();
-					// Bellow should be in the callback
-					////AdjSynth::synth_voice[voice]->updateAll();
-
-					// Activate each voice update
-					if(AudioManager::callback_audio_voice_update_ptr)
-					{
-						AudioManager::callback_audio_voice_update_ptr(voice);
-					}
-										
-					//gettimeofday(&stopts, NULL);
-					//printf("Core: %i Th: %i  voice: %i  : %i \n", core, ID, voice, stopts.tv_usec-startts.tv_usec);
+					break;
 				}
 			}
-			
-		}//#pragma omp parallel
-		
-		// Update common blocks: poly-mixer, reverb, stereo-output	
-		if(AudioManager::callback_audio_update_cycle_end_tasks_ptr)
-		{
-			AudioManager::callback_audio_update_cycle_end_tasks_ptr(0); 	// 0 - dummy param
 		}
-		// Below should be in the above callback
-////		AudioBlockFloat *p;
-////		for (p = *AdjSynth::get_instance()->audioPolyMixer->audio_first_update; p; p = p->audio_next_update)
-////		{
-////			p->update();
-////		}
-
-		gettimeofday(&stop_ts, NULL);		
-
-		count++;
-		if ((count % 40) == 0)
+		else
 		{
-			period_time_us = AudioManager::get_instance()->get_period_time_us();
-		
-			if (period_time_us < 1000)
-			{
-				// period < 1msec
-				fprintf(stderr, "Audio update thread: period < 1msec\n");
-				exit(1);
-			}			
-			
-			utilization = (int)(float(stop_ts.tv_usec - start_ts.tv_usec) / (float)period_time_us * 100.0);
-			callback_update_utilization_bar(utilization);
-			//printf("time= %i\n", stopts.tv_usec - startts.tv_usec);
-						count = 0;
+			manager->run_audio_update_cycle();
 		}
-
-		lockCount = 0;
-
 	}
 	
 	return NULL;
@@ -881,12 +1218,7 @@ void *AUDMNG_periodic_update_timer_thread(void *threadid)
 		usleep(period_time_us);
 
 		// Triger update process
-		if(pthread_mutex_trylock(&update_thread_mutex) == 0)
-		{
-			// Signal update thread
-			pthread_cond_signal(&update_thread_cv);
-			pthread_mutex_unlock(&update_thread_mutex);
-		}
+		AudioManager::get_instance()->signal_audio_update();
 	}
 
 	return NULL;
@@ -26,10 +26,17 @@
 
 #include "audioVoice.h"
 #include "audioBlock.h"
+#include "audioOutputRing.h"
+#include "audioVoiceScheduler.h"
+#include "audioDspLoad.h"
+#include "audioLatencyStats.h"
 #include "../libAdjHeartModSynth_2.h"
 
 #include "../alsa/alsaAudioHandling.h"
 
+#define _AUDIO_MEMORY_EXPORT_NONE		0	// Private in-process arena
+#define _AUDIO_MEMORY_EXPORT_MEMFD		1	// Arena mapped from a memfd for external processes
+
 extern pthread_mutex_t update_mutex[_SYNTH_MAX_NUM_OF_VOICES];
 
 class AudioManager {
@@ -39,7 +46,12 @@ public:
 	
 	static AudioManager *get_instance();
 	
-	int create_audio_shared_memory(int seed);
+	int create_audio_memory_arena();
+	void free_audio_memory_arena();
+	bool is_audio_memory_arena_allocated();
+	
+	static int set_audio_memory_export(int mode);
+	int get_audio_memory_export_fd();
 	
 	AudioVoiceFloat *get_audio_voice(int voice_num = 0);
 	
@@ -61,6 +73,14 @@ public:
 	int stop_audio_service();
 	void start_audio_update_thread();
 	void stop_audio_update_thread();	
+	void signal_audio_update();
+	int run_audio_update_cycle();
+	
+	int set_audio_update_mode(int mode);
+	int get_audio_update_mode();
+	int set_output_ring_num_of_periods(int num);
+	AudioOutputRing *get_active_output_ring();
+	AudioOutputRing *get_output_ring();
 	void start_alsa_main_thread();
 	void stop_alsa_main_thread();	
 	void start_jack_connect_thread();
@@ -76,6 +96,15 @@ public:
 	
 	void callback_audio_voice_update(int voice_num);
 	void register_callback_audio_voice_update(func_ptr_void_int_t ptr);
+	void register_callback_audio_voice_is_active(func_ptr_bool_int_t ptr);
+	
+	AudioVoiceScheduler *get_voice_scheduler();
+	AudioLatencyStats *get_latency_stats();
+	AudioDspLoad *get_dsp_load();
+	uint64_t get_update_cycles_count();
+	int get_update_cycle_utilization();
+	bool is_update_cycle_in_progress();
+	bool is_audio_service_started();
 	
 	void callback_audio_update_cycle_end_tasks(int param);
 	void register_callback_audio_update_cycle_end_tasks(func_ptr_void_int_t ptr);
@@ -90,19 +119,15 @@ public:
 //	shared_memory_audio_block_float_stereo_struct_t *audio_block_stereo_float_shared_memory3;
 //	shared_memory_audio_block_float_stereo_struct_t *audio_block_stereo_float_shared_memory4;
 
-	void *audio_shared_mem_voices_output_pointers[_SYNTH_MAX_NUM_OF_VOICES];
-	int audio_shared_mem_voices_output_ids[_SYNTH_MAX_NUM_OF_VOICES];
+	// Voices outputs and stereo output blocks - all in the audio memory arena
 	shared_memory_audio_block_float_stereo_struct_t *audio_block_stereo_float_shared_memory_voices_output[_SYNTH_MAX_NUM_OF_VOICES];
-
-	void *audio_shared_mem_stereo_output_pointer;
-	int audio_shared_mem_stereo_output_id;
-	
 	shared_memory_audio_block_float_stereo_struct_t *audio_block_stereo_float_shared_memory_outputs;
 	
 	AudioConnectionsManagerFloat *connections_manager;
 	
 	static func_ptr_void_int_t callback_audio_update_cycle_start_tasks_ptr;
 	static func_ptr_void_int_t callback_audio_voice_update_ptr;
+	static func_ptr_bool_int_t callback_audio_voice_is_active_ptr;
 	static func_ptr_void_int_t callback_audio_update_cycle_end_tasks_ptr;
 	
 	
@@ -128,11 +153,29 @@ private:
 
 	int mem_seed;
 	
+	// Contiguous aligned memory: _MAX_NUM_OF_VOICES voices outputs followed by the stereo output
+	shared_memory_audio_block_float_stereo_struct_t *audio_memory_arena;
+	size_t audio_memory_arena_size;
+	static int audio_memory_export_mode;
+	int audio_memory_export_fd;
+	
 	int sample_rate;
 	int audio_block_size;
 
 	bool audio_service_started;
 	
+	int audio_driver;
+	// _AUDIO_UPDATE_MODE_PUSH or _AUDIO_UPDATE_MODE_PULL
+	int audio_update_mode;
+	// Rendered periods handed from the update thread to the JACK callback (push mode)
+	AudioOutputRing *output_ring;
+	// Renders the active voices of each update cycle (work stealing, pinned workers)
+	AudioVoiceScheduler *voice_scheduler;
+	// Update cycle stages processing time histograms and deadline misses
+	AudioLatencyStats *latency_stats;
+	// Update cycle render time vs. period budget and voice types costs
+	AudioDspLoad *dsp_load;
+	
 };
 
 // Main thread running audio updates 
@@ -0,0 +1,251 @@
+/**
+*	@file		audioMixKernel.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Vectorized voice summing kernels used by the polyphonic mixer.
+*				Each kernel accumulates one voice 2 channels into the 4 mixer
+*				outputs (L, R, send-L, send-R) in a single pass, using gains
+*				that are constant over the processed segment.
+*/
+
+#include "audioMixKernel.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define _MIX_KERNEL_X86
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define _MIX_KERNEL_ARM_NEON
+#if !defined(__aarch64__)
+#include <sys/auxv.h>
+#ifndef HWCAP_NEON
+#define HWCAP_NEON		(1 << 12)
+#endif
+#endif
+#endif
+
+static func_ptr_mix_kernel_t mix_kernel = audio_mix_kernel_scalar;
+static int mix_kernel_type = _MIX_KERNEL_SCALAR;
+
+/**
+*   @brief  Portable mixing kernel - used as a fallback and for the vector kernels tail.
+*   @param  out_l	left output block (accumulated)
+*   @param  out_r	right output block (accumulated)
+*   @param  send_l	left send output block (accumulated)
+*   @param  send_r	right send output block (accumulated)
+*   @param  in1		voice channel 1 input
+*   @param  in2		voice channel 2 input
+*   @param  gains	_MIX_NUM_OF_GAINS mixing gains
+*   @param  n		number of samples
+*   @return void
+*/
+void audio_mix_kernel_scalar(float *out_l, float *out_r, float *send_l, float *send_r,
+	const float *in1, const float *in2, const float *gains, int n)
+{
+	const float gl1 = gains[_MIX_GAIN_LEFT_1], gl2 = gains[_MIX_GAIN_LEFT_2];
+	const float gr1 = gains[_MIX_GAIN_RIGHT_1], gr2 = gains[_MIX_GAIN_RIGHT_2];
+	const float sl1 = gains[_MIX_GAIN_SEND_LEFT_1], sl2 = gains[_MIX_GAIN_SEND_LEFT_2];
+	const float sr1 = gains[_MIX_GAIN_SEND_RIGHT_1], sr2 = gains[_MIX_GAIN_SEND_RIGHT_2];
+
+	for (int i = 0; i < n; i++)
+	{
+		out_l[i] += in1[i] * gl1 + in2[i] * gl2;
+		out_r[i] += in1[i] * gr1 + in2[i] * gr2;
+		send_l[i] += in1[i] * sl1 + in2[i] * sl2;
+		send_r[i] += in1[i] * sr1 + in2[i] * sr2;
+	}
+}
+
+#ifdef _MIX_KERNEL_X86
+
+/**
+*   @brief  SSE mixing kernel (4 lanes).
+*   @param  see audio_mix_kernel_scalar()
+*   @return void
+*/
+static void audio_mix_kernel_sse(float *out_l, float *out_r, float *send_l, float *send_r,
+	const float *in1, const float *in2, const float *gains, int n)
+{
+	const __m128 gl1 = _mm_set1_ps(gains[_MIX_GAIN_LEFT_1]), gl2 = _mm_set1_ps(gains[_MIX_GAIN_LEFT_2]);
+	const __m128 gr1 = _mm_set1_ps(gains[_MIX_GAIN_RIGHT_1]), gr2 = _mm_set1_ps(gains[_MIX_GAIN_RIGHT_2]);
+	const __m128 sl1 = _mm_set1_ps(gains[_MIX_GAIN_SEND_LEFT_1]), sl2 = _mm_set1_ps(gains[_MIX_GAIN_SEND_LEFT_2]);
+	const __m128 sr1 = _mm_set1_ps(gains[_MIX_GAIN_SEND_RIGHT_1]), sr2 = _mm_set1_ps(gains[_MIX_GAIN_SEND_RIGHT_2]);
+	int i;
+
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		__m128 a = _mm_loadu_ps(in1 + i);
+		__m128 b = _mm_loadu_ps(in2 + i);
+
+		_mm_storeu_ps(out_l + i, _mm_add_ps(_mm_loadu_ps(out_l + i),
+			_mm_add_ps(_mm_mul_ps(a, gl1), _mm_mul_ps(b, gl2))));
+		_mm_storeu_ps(out_r + i, _mm_add_ps(_mm_loadu_ps(out_r + i),
+			_mm_add_ps(_mm_mul_ps(a, gr1), _mm_mul_ps(b, gr2))));
+		_mm_storeu_ps(send_l + i, _mm_add_ps(_mm_loadu_ps(send_l + i),
+			_mm_add_ps(_mm_mul_ps(a, sl1), _mm_mul_ps(b, sl2))));
+		_mm_storeu_ps(send_r + i, _mm_add_ps(_mm_loadu_ps(send_r + i),
+			_mm_add_ps(_mm_mul_ps(a, sr1), _mm_mul_ps(b, sr2))));
+	}
+
+	if (i < n)
+	{
+		audio_mix_kernel_scalar(out_l + i, out_r + i, send_l + i, send_r + i, in1 + i, in2 + i, gains, n - i);
+	}
+}
+
+/**
+*   @brief  AVX + FMA mixing kernel (8 lanes). Only called when the CPU supports it.
+*   @param  see audio_mix_kernel_scalar()
+*   @return void
+*/
+__attribute__((target("avx,fma")))
+static void audio_mix_kernel_avx(float *out_l, float *out_r, float *send_l, float *send_r,
+	const float *in1, const float *in2, const float *gains, int n)
+{
+	const __m256 gl1 = _mm256_set1_ps(gains[_MIX_GAIN_LEFT_1]), gl2 = _mm256_set1_ps(gains[_MIX_GAIN_LEFT_2]);
+	const __m256 gr1 = _mm256_set1_ps(gains[_MIX_GAIN_RIGHT_1]), gr2 = _mm256_set1_ps(gains[_MIX_GAIN_RIGHT_2]);
+	const __m256 sl1 = _mm256_set1_ps(gains[_MIX_GAIN_SEND_LEFT_1]), sl2 = _mm256_set1_ps(gains[_MIX_GAIN_SEND_LEFT_2]);
+	const __m256 sr1 = _mm256_set1_ps(gains[_MIX_GAIN_SEND_RIGHT_1]), sr2 = _mm256_set1_ps(gains[_MIX_GAIN_SEND_RIGHT_2]);
+	int i;
+
+	for (i = 0; i + 8 <= n; i += 8)
+	{
+		__m256 a = _mm256_loadu_ps(in1 + i);
+		__m256 b = _mm256_loadu_ps(in2 + i);
+
+		_mm256_storeu_ps(out_l + i, _mm256_fmadd_ps(b, gl2, _mm256_fmadd_ps(a, gl1, _mm256_loadu_ps(out_l + i))));
+		_mm256_storeu_ps(out_r + i, _mm256_fmadd_ps(b, gr2, _mm256_fmadd_ps(a, gr1, _mm256_loadu_ps(out_r + i))));
+		_mm256_storeu_ps(send_l + i, _mm256_fmadd_ps(b, sl2, _mm256_fmadd_ps(a, sl1, _mm256_loadu_ps(send_l + i))));
+		_mm256_storeu_ps(send_r + i, _mm256_fmadd_ps(b, sr2, _mm256_fmadd_ps(a, sr1, _mm256_loadu_ps(send_r + i))));
+	}
+
+	if (i < n)
+	{
+		audio_mix_kernel_sse(out_l + i, out_r + i, send_l + i, send_r + i, in1 + i, in2 + i, gains, n - i);
+	}
+}
+
+#endif
+
+#ifdef _MIX_KERNEL_ARM_NEON
+
+/**
+*   @brief  NEON mixing kernel (4 lanes, multiply-accumulate).
+*   @param  see audio_mix_kernel_scalar()
+*   @return void
+*/
+static void audio_mix_kernel_neon(float *out_l, float *out_r, float *send_l, float *send_r,
+	const float *in1, const float *in2, const float *gains, int n)
+{
+	const float32x4_t gl1 = vdupq_n_f32(gains[_MIX_GAIN_LEFT_1]), gl2 = vdupq_n_f32(gains[_MIX_GAIN_LEFT_2]);
+	const float32x4_t gr1 = vdupq_n_f32(gains[_MIX_GAIN_RIGHT_1]), gr2 = vdupq_n_f32(gains[_MIX_GAIN_RIGHT_2]);
+	const float32x4_t sl1 = vdupq_n_f32(gains[_MIX_GAIN_SEND_LEFT_1]), sl2 = vdupq_n_f32(gains[_MIX_GAIN_SEND_LEFT_2]);
+	const float32x4_t sr1 = vdupq_n_f32(gains[_MIX_GAIN_SEND_RIGHT_1]), sr2 = vdupq_n_f32(gains[_MIX_GAIN_SEND_RIGHT_2]);
+	int i;
+
+	for (i = 0; i + 4 <= n; i += 4)
+	{
+		float32x4_t a = vld1q_f32(in1 + i);
+		float32x4_t b = vld1q_f32(in2 + i);
+
+		vst1q_f32(out_l + i, vmlaq_f32(vmlaq_f32(vld1q_f32(out_l + i), a, gl1), b, gl2));
+		vst1q_f32(out_r + i, vmlaq_f32(vmlaq_f32(vld1q_f32(out_r + i), a, gr1), b, gr2));
+		vst1q_f32(send_l + i, vmlaq_f32(vmlaq_f32(vld1q_f32(send_l + i), a, sl1), b, sl2));
+		vst1q_f32(send_r + i, vmlaq_f32(vmlaq_f32(vld1q_f32(send_r + i), a, sr1), b, sr2));
+	}
+
+	if (i < n)
+	{
+		audio_mix_kernel_scalar(out_l + i, out_r + i, send_l + i, send_r + i, in1 + i, in2 + i, gains, n - i);
+	}
+}
+
+#endif
+
+/**
+*   @brief  Select the best mixing kernel supported by the running CPU.
+*			Should be called once at startup (before audio is running).
+*   @param  none
+*   @return the selected kernel
+*/
+func_ptr_mix_kernel_t audio_mix_kernel_select()
+{
+	mix_kernel = audio_mix_kernel_scalar;
+	mix_kernel_type = _MIX_KERNEL_SCALAR;
+
+#ifdef _MIX_KERNEL_X86
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("fma"))
+	{
+		mix_kernel = audio_mix_kernel_avx;
+		mix_kernel_type = _MIX_KERNEL_AVX;
+	}
+	else if (__builtin_cpu_supports("sse"))
+	{
+		mix_kernel = audio_mix_kernel_sse;
+		mix_kernel_type = _MIX_KERNEL_SSE;
+	}
+#endif
+
+#ifdef _MIX_KERNEL_ARM_NEON
+#if defined(__aarch64__)
+	mix_kernel = audio_mix_kernel_neon;
+	mix_kernel_type = _MIX_KERNEL_NEON;
+#else
+	if (getauxval(AT_HWCAP) & HWCAP_NEON)
+	{
+		mix_kernel = audio_mix_kernel_neon;
+		mix_kernel_type = _MIX_KERNEL_NEON;
+	}
+#endif
+#endif
+
+	return mix_kernel;
+}
+
+/**
+*   @brief  Return the selected mixing kernel.
+*   @param  none
+*   @return the selected kernel
+*/
+func_ptr_mix_kernel_t audio_mix_kernel_get()
+{
+	return mix_kernel;
+}
+
+/**
+*   @brief  Return the selected mixing kernel type.
+*   @param  none
+*   @return _MIX_KERNEL_SCALAR, _MIX_KERNEL_SSE, _MIX_KERNEL_AVX or _MIX_KERNEL_NEON
+*/
+int audio_mix_kernel_get_type()
+{
+	return mix_kernel_type;
+}
+
+/**
+*   @brief  Return the selected mixing kernel name.
+*   @param  none
+*   @return kernel name string
+*/
+const char *audio_mix_kernel_get_name()
+{
+	switch (mix_kernel_type)
+	{
+		case _MIX_KERNEL_SSE:
+			return "SSE";
+
+		case _MIX_KERNEL_AVX:
+			return "AVX";
+
+		case _MIX_KERNEL_NEON:
+			return "NEON";
+
+		default:
+			return "scalar";
+	}
+}
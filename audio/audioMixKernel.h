@@ -0,0 +1,44 @@
+/**
+*	@file		audioMixKernel.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Vectorized voice summing kernels used by the polyphonic mixer.
+*				A scalar, SSE, AVX (x86) and NEON (ARM) variant are provided;
+*				the best supported one is selected once at startup.
+*/
+
+#ifndef _AUDIO_MIX_KERNEL
+#define _AUDIO_MIX_KERNEL
+
+/* Mixing gains index (per control segment) */
+#define _MIX_GAIN_LEFT_1				0
+#define _MIX_GAIN_LEFT_2				1
+#define _MIX_GAIN_RIGHT_1				2
+#define _MIX_GAIN_RIGHT_2				3
+#define _MIX_GAIN_SEND_LEFT_1			4
+#define _MIX_GAIN_SEND_LEFT_2			5
+#define _MIX_GAIN_SEND_RIGHT_1			6
+#define _MIX_GAIN_SEND_RIGHT_2			7
+
+#define _MIX_NUM_OF_GAINS				8
+
+#define _MIX_KERNEL_SCALAR				0
+#define _MIX_KERNEL_SSE					1
+#define _MIX_KERNEL_AVX					2
+#define _MIX_KERNEL_NEON				3
+
+/* Accumulate a voice 2 channels (in1, in2) into L, R, send-L and send-R using gains[_MIX_NUM_OF_GAINS] */
+typedef void(*func_ptr_mix_kernel_t)(float *out_l, float *out_r, float *send_l, float *send_r,
+	const float *in1, const float *in2, const float *gains, int n);
+
+func_ptr_mix_kernel_t audio_mix_kernel_select();
+func_ptr_mix_kernel_t audio_mix_kernel_get();
+int audio_mix_kernel_get_type();
+const char *audio_mix_kernel_get_name();
+
+void audio_mix_kernel_scalar(float *out_l, float *out_r, float *send_l, float *send_r,
+	const float *in1, const float *in2, const float *gains, int n);
+
+#endif
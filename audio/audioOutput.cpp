@@ -15,8 +15,6 @@
 #include "audioManager.h"
 #include "../commonDefs.h"
 
-extern pthread_mutex_t voice_mem_blocks_allocation_control_mutex;
-
 AudioManager *_oaudio_manager = NULL;
 
 /**
@@ -107,16 +105,46 @@ void AudioOutputFloat::update(void) {
 	audio_block_float_mono_t *in[2];
 	volatile  unsigned int i;
 	static unsigned int id = 0;
+	shared_memory_audio_block_float_stereo_struct_t *out;
+	AudioOutputRing *ring;
 
 	//	fprintf(stderr, "Update Output\n");
 	
+	if (_oaudio_manager == NULL)
+	{
+		_oaudio_manager = AudioManager::get_instance();
+	}
+	
+	// JACK push mode: the main stereo output renders into the next free period of the output ring
+	// (per voice outputs always write their own shared memory block)
+	ring = NULL;
+	if (audio_block_stereo_float_shared_memory == _oaudio_manager->audio_block_stereo_float_shared_memory_outputs)
+	{
+		ring = _oaudio_manager->get_active_output_ring();
+	}
+	
+	if (ring)
+	{
+		out = ring->get_write_period();
+		if (out == NULL)
+		{
+			// Ring full (overrun counted by the ring) - period is dropped
+			out = audio_block_stereo_float_shared_memory;
+			ring = NULL;
+		}
+	}
+	else
+	{
+		out = audio_block_stereo_float_shared_memory;
+	}
+	
 	// Get input samples
 	in[_LEFT] = receive_audio_block_read_only(_LEFT);
 	if (in[_LEFT]) 
 	{
 		for (i = 0; i < audio_block_size; i++) 
 		{
-			audio_block_stereo_float_shared_memory->data[_LEFT][i] = in[_LEFT]->data[i] * master_gain;
+			out->data[_LEFT][i] = in[_LEFT]->data[i] * master_gain;
 		}
 	}
 	else 
@@ -124,7 +152,7 @@ void AudioOutputFloat::update(void) {
 		for (i = 0; i < audio_block_size; i++) 
 		{
 			// No input - fill with silence.
-			audio_block_stereo_float_shared_memory->data[_LEFT][i] = 0;
+			out->data[_LEFT][i] = 0;
 		}
 	}
 	
@@ -133,7 +161,7 @@ void AudioOutputFloat::update(void) {
 	{
 		for (i = 0; i < audio_block_size; i++) 
 		{
-			audio_block_stereo_float_shared_memory->data[_RIGHT][i] = in[_RIGHT]->data[i] * master_gain;
+			out->data[_RIGHT][i] = in[_RIGHT]->data[i] * master_gain;
 		}
 	}
 	else 
@@ -141,18 +169,23 @@ void AudioOutputFloat::update(void) {
 		for (i = 0; i < audio_block_size; i++) 
 		{
 			// No input - fill with silence.
-			audio_block_stereo_float_shared_memory->data[_RIGHT][i] = 0;
+			out->data[_RIGHT][i] = 0;
 		}
 	}
 
 	//printf("out  %x ", (int)audio_block_stereo_float_shared_memory);
 	
-	audio_block_stereo_float_shared_memory->id = id;
+	out->id = id;
 	id++;
+	
+	if (ring)
+	{
+		// Publish the period to the audio driver callback
+		ring->commit_write_period();
+	}
 	//	if ((id % (int)(10000000/_PERIOD_TIME_USEC)) == 0)
 	//		printf("#transfers: %u  %i sec \n\r", id, (id / (1000000/_PERIOD_TIME_USEC)));
 
-		pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);	
 	if (in[_LEFT])
 	{		
 		release_audio_block(in[_LEFT]);
@@ -161,7 +194,6 @@ void AudioOutputFloat::update(void) {
 	{		
 		release_audio_block(in[_RIGHT]);
 	}			
-	pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 	//	fprintf(stderr, "RO %i\n", in[channel]->memory_pool_index);	
 }
 
@@ -0,0 +1,192 @@
+/**
+*	@file		audioOutputRing.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A wait-free single-producer/single-consumer ring of output periods
+*				used to hand rendered audio from the update thread to the
+*				JACK process callback.
+*				The producer only advances write_index and the consumer only
+*				advances read_index, so neither side ever blocks or writes a
+*				period the other side is using.
+*/
+
+#include <string.h>
+
+#include "audioOutputRing.h"
+
+/**
+*   @brief  Create an AudioOutputRing object instance.
+*   @param  num_of_periods	number of periods in the ring
+*							(_AUDIO_OUTPUT_RING_MIN_NUM_OF_PERIODS to _AUDIO_OUTPUT_RING_MAX_NUM_OF_PERIODS)
+*   @return none
+*/
+AudioOutputRing::AudioOutputRing(int num_of_periods)
+{
+	this->num_of_periods = _AUDIO_OUTPUT_RING_DEFAULT_NUM_OF_PERIODS;
+	set_num_of_periods(num_of_periods);
+	reset();
+	reset_counters();
+}
+
+/**
+*   @brief  Set the number of periods in the ring. The ring is reset.
+*			Must not be called while the producer or the consumer are active.
+*   @param  num	number of periods
+*   @return set number of periods; -1 param out of range
+*/
+int AudioOutputRing::set_num_of_periods(int num)
+{
+	if ((num < _AUDIO_OUTPUT_RING_MIN_NUM_OF_PERIODS) || (num > _AUDIO_OUTPUT_RING_MAX_NUM_OF_PERIODS))
+	{
+		return -1;
+	}
+
+	num_of_periods = num;
+	reset();
+
+	return num_of_periods;
+}
+
+/**
+*   @brief  Return the number of periods in the ring.
+*   @param  none
+*   @return number of periods
+*/
+int AudioOutputRing::get_num_of_periods() { return num_of_periods; }
+
+/**
+*   @brief  Empty the ring and clear all periods to silence.
+*			Must not be called while the producer or the consumer are active.
+*   @param  none
+*   @return void
+*/
+void AudioOutputRing::reset()
+{
+	for (int p = 0; p < _AUDIO_OUTPUT_RING_MAX_NUM_OF_PERIODS; p++)
+	{
+		memset(periods[p].data, 0, sizeof(periods[p].data));
+		periods[p].id = 0;
+		periods[p].ref_count = 0;
+		periods[p].size = _AUDIO_MAX_BUF_SIZE;
+	}
+
+	__atomic_store_n(&write_index, 0, __ATOMIC_RELEASE);
+	__atomic_store_n(&read_index, 0, __ATOMIC_RELEASE);
+}
+
+/**
+*   @brief  Producer: get the next free period to render into.
+*   @param  none
+*   @return a pointer to the period; NULL if the ring is full (overrun)
+*/
+shared_memory_audio_block_float_stereo_struct_t *AudioOutputRing::get_write_period()
+{
+	uint32_t wr = __atomic_load_n(&write_index, __ATOMIC_RELAXED);
+	uint32_t rd = __atomic_load_n(&read_index, __ATOMIC_ACQUIRE);
+
+	if ((wr - rd) >= (uint32_t)num_of_periods)
+	{
+		__atomic_add_fetch(&overruns_count, 1, __ATOMIC_RELAXED);
+		return NULL;
+	}
+
+	return &periods[wr % num_of_periods];
+}
+
+/**
+*   @brief  Producer: publish the period obtained by get_write_period().
+*   @param  none
+*   @return void
+*/
+void AudioOutputRing::commit_write_period()
+{
+	__atomic_add_fetch(&write_index, 1, __ATOMIC_RELEASE);
+}
+
+/**
+*   @brief  Producer: return the number of periods that can be rendered ahead.
+*   @param  none
+*   @return number of free periods
+*/
+int AudioOutputRing::get_num_of_free_periods()
+{
+	uint32_t wr = __atomic_load_n(&write_index, __ATOMIC_RELAXED);
+	uint32_t rd = __atomic_load_n(&read_index, __ATOMIC_ACQUIRE);
+
+	return num_of_periods - (int)(wr - rd);
+}
+
+/**
+*   @brief  Consumer: get the oldest ready period.
+*   @param  none
+*   @return a pointer to the period; NULL if the ring is empty (underrun)
+*/
+shared_memory_audio_block_float_stereo_struct_t *AudioOutputRing::get_read_period()
+{
+	uint32_t rd = __atomic_load_n(&read_index, __ATOMIC_RELAXED);
+	uint32_t wr = __atomic_load_n(&write_index, __ATOMIC_ACQUIRE);
+
+	if (wr == rd)
+	{
+		__atomic_add_fetch(&underruns_count, 1, __ATOMIC_RELAXED);
+		return NULL;
+	}
+
+	return &periods[rd % num_of_periods];
+}
+
+/**
+*   @brief  Consumer: return the period obtained by get_read_period() to the producer.
+*   @param  none
+*   @return void
+*/
+void AudioOutputRing::release_read_period()
+{
+	__atomic_add_fetch(&read_index, 1, __ATOMIC_RELEASE);
+}
+
+/**
+*   @brief  Consumer: return the number of ready periods.
+*   @param  none
+*   @return number of ready periods
+*/
+int AudioOutputRing::get_num_of_ready_periods()
+{
+	uint32_t rd = __atomic_load_n(&read_index, __ATOMIC_RELAXED);
+	uint32_t wr = __atomic_load_n(&write_index, __ATOMIC_ACQUIRE);
+
+	return (int)(wr - rd);
+}
+
+/**
+*   @brief  Return the number of underruns (consumer found no ready period).
+*   @param  none
+*   @return underruns counter
+*/
+uint32_t AudioOutputRing::get_underruns_count()
+{
+	return __atomic_load_n(&underruns_count, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Return the number of overruns (producer found no free period).
+*   @param  none
+*   @return overruns counter
+*/
+uint32_t AudioOutputRing::get_overruns_count()
+{
+	return __atomic_load_n(&overruns_count, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Reset the underruns and overruns counters.
+*   @param  none
+*   @return void
+*/
+void AudioOutputRing::reset_counters()
+{
+	__atomic_store_n(&underruns_count, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&overruns_count, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,62 @@
+/**
+*	@file		audioOutputRing.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A wait-free single-producer/single-consumer ring of output periods
+*				used to hand rendered audio from the update thread to the
+*				JACK process callback.
+*/
+
+#ifndef _AUDIO_OUTPUT_RING
+#define _AUDIO_OUTPUT_RING
+
+#include <stdint.h>
+
+#include "audioCommon.h"
+
+#define _AUDIO_OUTPUT_RING_MIN_NUM_OF_PERIODS		2
+#define _AUDIO_OUTPUT_RING_MAX_NUM_OF_PERIODS		8
+#define _AUDIO_OUTPUT_RING_DEFAULT_NUM_OF_PERIODS	2
+
+class AudioOutputRing
+{
+public:
+	AudioOutputRing(int num_of_periods = _AUDIO_OUTPUT_RING_DEFAULT_NUM_OF_PERIODS);
+
+	int set_num_of_periods(int num);
+	int get_num_of_periods();
+
+	void reset();
+
+	// Producer side (update thread)
+	shared_memory_audio_block_float_stereo_struct_t *get_write_period();
+	void commit_write_period();
+	int get_num_of_free_periods();
+
+	// Consumer side (audio driver callback)
+	shared_memory_audio_block_float_stereo_struct_t *get_read_period();
+	void release_read_period();
+	int get_num_of_ready_periods();
+
+	uint32_t get_underruns_count();
+	uint32_t get_overruns_count();
+	void reset_counters();
+
+private:
+	shared_memory_audio_block_float_stereo_struct_t periods[_AUDIO_OUTPUT_RING_MAX_NUM_OF_PERIODS];
+
+	int num_of_periods;
+
+	// Free running indexes; slot = index % num_of_periods
+	uint32_t write_index;
+	uint32_t read_index;
+
+	// Consumer found no ready period
+	uint32_t underruns_count;
+	// Producer found no free period
+	uint32_t overruns_count;
+};
+
+#endif
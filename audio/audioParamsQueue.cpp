@@ -0,0 +1,226 @@
+/**
+*	@file		audioParamsQueue.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A lock-free queue of parameters updates applied by the audio update thread.
+*
+*				A bounded multi-producer queue: each cell holds a sequence number that
+*				tells whether it is free for the producer of a position or ready for
+*				the consumer. Producers claim positions by a compare-and-swap; the
+*				single consumer (the audio update thread) never blocks.
+*/
+
+#include <stdio.h>
+#include <unistd.h>
+
+#include "audioParamsQueue.h"
+
+AudioParamsQueue *AudioParamsQueue::audio_params_queue_instance = NULL;
+
+/**
+*   @brief  Create an AudioParamsQueue object instance.
+*   @param  none
+*   @return none
+*/
+AudioParamsQueue::AudioParamsQueue()
+{
+	for (uint32_t i = 0; i < _AUDIO_PARAMS_QUEUE_SIZE; i++)
+	{
+		cells[i].sequence = i;
+	}
+
+	enqueue_position = 0;
+	dequeue_position = 0;
+	active = false;
+	overflows_count = 0;
+}
+
+/**
+*   @brief  Return the AudioParamsQueue instance (created on first call).
+*   @param  none
+*   @return a pointer to the AudioParamsQueue instance
+*/
+AudioParamsQueue *AudioParamsQueue::get_instance()
+{
+	if (audio_params_queue_instance == NULL)
+	{
+		audio_params_queue_instance = new AudioParamsQueue();
+	}
+
+	return audio_params_queue_instance;
+}
+
+/**
+*   @brief  Activate or deactivate updates posting. Set active while audio update
+*			cycles are running; when deactivated, pending updates are applied
+*			on the calling thread (audio update cycles must be stopped).
+*   @param  act	true to activate
+*   @return void
+*/
+void AudioParamsQueue::set_active(bool act)
+{
+	__atomic_store_n(&active, act, __ATOMIC_RELEASE);
+
+	if (!act)
+	{
+		apply_pending();
+	}
+}
+
+/**
+*   @brief  Return true if updates are posted to the queue.
+*   @param  none
+*   @return true if active
+*/
+bool AudioParamsQueue::is_active() { return __atomic_load_n(&active, __ATOMIC_ACQUIRE); }
+
+/**
+*   @brief  Post an update to be applied on the next audio update cycle.
+*			Lock-free; may be called by any number of threads.
+*   @param  update	a pointer to the update (copied)
+*   @return true if posted; false if the queue is not active or full
+*			(see post_wait())
+*/
+bool AudioParamsQueue::post(const audio_param_update_t *update)
+{
+	queue_cell_t *cell;
+	uint32_t position, sequence;
+	int32_t diff;
+
+	if ((update == NULL) || !is_active())
+	{
+		return false;
+	}
+
+	position = __atomic_load_n(&enqueue_position, __ATOMIC_RELAXED);
+
+	while (true)
+	{
+		cell = &cells[position & (_AUDIO_PARAMS_QUEUE_SIZE - 1)];
+		sequence = __atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE);
+		diff = (int32_t)(sequence - position);
+
+		if (diff == 0)
+		{
+			// Cell is free for this position - claim it
+			if (__atomic_compare_exchange_n(&enqueue_position, &position, position + 1,
+					true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+			{
+				break;
+			}
+			// position was reloaded by the failed exchange
+		}
+		else if (diff < 0)
+		{
+			// Full
+			__atomic_add_fetch(&overflows_count, 1, __ATOMIC_RELAXED);
+			return false;
+		}
+		else
+		{
+			position = __atomic_load_n(&enqueue_position, __ATOMIC_RELAXED);
+		}
+	}
+
+	cell->update = *update;
+	// Ready for the consumer
+	__atomic_store_n(&cell->sequence, position + 1, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+/**
+*   @brief  Post an update to be applied on the next audio update cycle; while the
+*			queue is full, retry with an increasing back-off until the audio update
+*			thread frees entries. Must not be called by the audio update thread.
+*   @param  update	a pointer to the update (copied)
+*   @return true if posted; false if the queue is not active, or no update was applied
+*			for _AUDIO_PARAMS_QUEUE_STALL_TIMEOUT_MS (update cycles are not running) -
+*			the caller should then apply the update directly
+*/
+bool AudioParamsQueue::post_wait(const audio_param_update_t *update)
+{
+	uint32_t dequeued, last_dequeued = __atomic_load_n(&dequeue_position, __ATOMIC_ACQUIRE);
+	int backoff_us = _AUDIO_PARAMS_QUEUE_MIN_BACKOFF_US, stalled_us = 0;
+
+	while (!post(update))
+	{
+		if ((update == NULL) || !is_active())
+		{
+			return false;
+		}
+
+		usleep(backoff_us);
+
+		dequeued = __atomic_load_n(&dequeue_position, __ATOMIC_ACQUIRE);
+		if (dequeued != last_dequeued)
+		{
+			// The audio update thread is consuming - keep waiting
+			last_dequeued = dequeued;
+			stalled_us = 0;
+		}
+		else
+		{
+			stalled_us += backoff_us;
+			if (stalled_us >= _AUDIO_PARAMS_QUEUE_STALL_TIMEOUT_MS * 1000)
+			{
+				fprintf(stderr, "Audio parameters queue: update cycles are not running\n");
+				return false;
+			}
+		}
+
+		backoff_us *= 2;
+		if (backoff_us > _AUDIO_PARAMS_QUEUE_MAX_BACKOFF_US)
+		{
+			backoff_us = _AUDIO_PARAMS_QUEUE_MAX_BACKOFF_US;
+		}
+	}
+
+	return true;
+}
+
+/**
+*   @brief  Apply all the posted updates, in posting order.
+*			Called by the audio update thread at the start of each update cycle.
+*   @param  none
+*   @return number of applied updates
+*/
+int AudioParamsQueue::apply_pending()
+{
+	queue_cell_t *cell;
+	uint32_t position = dequeue_position;
+	int count = 0;
+
+	while (true)
+	{
+		cell = &cells[position & (_AUDIO_PARAMS_QUEUE_SIZE - 1)];
+		if (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) != position + 1)
+		{
+			// Empty (or the next update is still being written)
+			break;
+		}
+
+		if (cell->update.apply != NULL)
+		{
+			cell->update.apply(&cell->update);
+		}
+
+		// Free for the producer of the position one round ahead
+		__atomic_store_n(&cell->sequence, position + _AUDIO_PARAMS_QUEUE_SIZE, __ATOMIC_RELEASE);
+		position++;
+		count++;
+	}
+
+	__atomic_store_n(&dequeue_position, position, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+/**
+*   @brief  Return the number of posts that found the queue full.
+*   @param  none
+*   @return overflows count
+*/
+uint32_t AudioParamsQueue::get_overflows_count() { return __atomic_load_n(&overflows_count, __ATOMIC_RELAXED); }
@@ -0,0 +1,90 @@
+/**
+*	@file		audioParamsQueue.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A lock-free queue of parameters updates, posted by the control
+*				(MIDI, GUI) threads and applied by the audio update thread at the
+*				start of each audio update cycle, before the voices are processed.
+*				This way, DSP objects fields are never modified while an audio block
+*				is being processed.
+*/
+
+#ifndef _AUDIO_PARAMS_QUEUE
+#define _AUDIO_PARAMS_QUEUE
+
+#include <stdint.h>
+
+// Number of queue entries (must be a power of 2); holds several full patches
+// (one entry per parameter, ~300 parameters) posted between two update cycles
+#define _AUDIO_PARAMS_QUEUE_SIZE			2048
+// post_wait() back-off while the queue is full (usec)
+#define _AUDIO_PARAMS_QUEUE_MIN_BACKOFF_US	100
+#define _AUDIO_PARAMS_QUEUE_MAX_BACKOFF_US	2000
+// post_wait() gives up if no update was applied for this time (no update cycles are running)
+#define _AUDIO_PARAMS_QUEUE_STALL_TIMEOUT_MS	500
+
+typedef struct _audio_param_update audio_param_update_t;
+
+/* Applies an update (called on the audio update thread) */
+typedef void (*audio_param_update_apply_t)(const audio_param_update_t *update);
+/* A generic update target function pointer (cast to the actual target type by apply) */
+typedef void (*audio_param_update_target_t)(void);
+
+struct _audio_param_update
+{
+	audio_param_update_apply_t apply;
+	audio_param_update_target_t target;
+	int index_start;
+	int index_stop;
+	int prog;
+	union
+	{
+		int int_value;
+		double float_value;
+		bool bool_value;
+	} value;
+};
+
+class AudioParamsQueue
+{
+public:
+	static AudioParamsQueue *get_instance();
+
+	void set_active(bool act);
+	bool is_active();
+
+	// Any control thread
+	bool post(const audio_param_update_t *update);
+	bool post_wait(const audio_param_update_t *update);
+
+	// Audio update thread only
+	int apply_pending();
+
+	uint32_t get_overflows_count();
+
+private:
+	AudioParamsQueue();
+
+	typedef struct
+	{
+		uint32_t sequence;
+		audio_param_update_t update;
+	} queue_cell_t;
+
+	static AudioParamsQueue *audio_params_queue_instance;
+
+	queue_cell_t cells[_AUDIO_PARAMS_QUEUE_SIZE];
+
+	// Free running positions; cell = position % _AUDIO_PARAMS_QUEUE_SIZE
+	uint32_t enqueue_position;
+	uint32_t dequeue_position;
+
+	// Updates are posted only while audio update cycles are running
+	bool active;
+	// Posts that found the queue full
+	uint32_t overflows_count;
+};
+
+#endif
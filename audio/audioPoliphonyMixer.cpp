@@ -11,8 +11,11 @@
 *	@brief		Mix audio ch1 and ch2 of all voicesinto stereo Left and Right output signals 
 */
 
+#include <string.h>
+
 #include "audioPoliphonyMixer.h"
 #include "audioManager.h"
+#include "audioMixKernel.h"
 
 #include "../libAdjHeartModSynth_2.h"
 #include "../commonDefs.h"
@@ -21,8 +24,6 @@
 
 //#include "..//Synthesizer/adjSynth.h"
 
-extern pthread_mutex_t voice_mem_blocks_allocation_control_mutex;
-
 AudioManager *poly_mixer_manager; // = AudioManager::get_instance();
 
 /* Used to set individual output level/pan for non program operation*/
@@ -64,6 +65,8 @@ AudioPolyMixerFloat::AudioPolyMixerFloat(int stage,
 	
 	poly_mixer_manager = AudioManager::get_instance();
 	
+	mix_kernel = audio_mix_kernel_select();
+	
 	inputs = num_of_voices;
 	if (inputs > mod_synth_get_synthesizer_num_of_polyphonic_voices())
 	{	
@@ -86,6 +89,9 @@ AudioPolyMixerFloat::AudioPolyMixerFloat(int stage,
 		preserved_send_1[i] = send1[i];
 		preserved_send_2[i] = send2[i];
 		
+		smoothed_gain_1[i] = smoothed_gain_2[i] = 0.5f;
+		smoothed_pan_1[i] = smoothed_pan_2[i] = 0.f;
+		
 		voice_active[i] = false;
 		voice_wait_for_not_active[i] = false;
 	}
@@ -846,8 +852,71 @@ void AudioPolyMixerFloat::set_voice_send_2_ptr(int voice, int prog)
 	if ((voice >= 0) && (voice < mod_synth_get_synthesizer_num_of_polyphonic_voices()) &&
 		(prog >= 0) && (prog < mod_synth_get_synthesizer_num_of_programs()))
 	{
-		send1[voice] = &program_send_2[prog];
+		send2[voice] = &program_send_2[prog];
+	}
+}
+
+/* Audio parameters update: bind a voice mixer gain/pan/send to a program */
+void AudioPolyMixerFloat::apply_voice_program_binding_update(const audio_param_update_t *update)
+{
+	audio_poly_mixer_instance->apply_voice_program_binding(update->index_start, update->prog);
+}
+
+/**
+*   @brief  Bind a voice gains, pans and sends to a program levels, pans and sends
+*			(when a voice is allocated to a program).
+*			While the audio update cycles are running, the binding is posted to the
+*			audio parameters updates queue and applied by the audio update thread
+*			before the next update cycle, so that the pointers are never changed
+*			while the voices are mixed.
+*	@param	voice	voice number 0 to _SYNTH_MAX_NUM_OF_VOICES
+*   @param  prog	program number 0 to _SYNTH_NUM_OF_PROGRAMS
+*   @return void
+*/
+void AudioPolyMixerFloat::bind_voice_program(int voice, int prog)
+{
+	audio_param_update_t update;
+
+	update.apply = apply_voice_program_binding_update;
+	update.target = NULL;
+	update.index_start = voice;
+	update.index_stop = voice;
+	update.prog = prog;
+	update.value.int_value = 0;
+
+	if (!AudioParamsQueue::get_instance()->post_wait(&update))
+	{
+		// No update cycles are running
+		apply_voice_program_binding(voice, prog);
+	}
+}
+
+/**
+*   @brief  Bind a voice gains, pans and sends to a program now (the previous binding 
+*			is preserved). Gain and pan smoothing restarts from the program values.
+*	@param	voice	voice number 0 to _SYNTH_MAX_NUM_OF_VOICES
+*   @param  prog	program number 0 to _SYNTH_NUM_OF_PROGRAMS
+*   @return void
+*/
+void AudioPolyMixerFloat::apply_voice_program_binding(int voice, int prog)
+{
+	if ((voice < 0) || (voice >= mod_synth_get_synthesizer_num_of_polyphonic_voices()))
+	{
+		return;
 	}
+	
+	preserve_gain_pan(voice);
+	set_voice_gain_1_ptr(voice, prog);
+	set_voice_gain_2_ptr(voice, prog);
+	set_voice_pan_1_ptr(voice, prog);
+	set_voice_pan_2_ptr(voice, prog);
+	set_voice_send_1_ptr(voice, prog);
+	set_voice_send_2_ptr(voice, prog);
+	
+	smoothed_gain_1[voice] = *gain1[voice];
+	smoothed_gain_2[voice] = *gain2[voice];
+	smoothed_pan_1[voice] = *pan1[voice];
+	smoothed_pan_2[voice] = *pan2[voice];
 }
 
 /**
@@ -1497,12 +1566,10 @@ void AudioPolyMixerFloat::update()
 	if (active)
 	{
 		// Allocate output blocks
-		pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 		block_out_L = allocate_audio_block();
 		block_out_R = allocate_audio_block();
 		block_send_L = allocate_audio_block();
 		block_send_R = allocate_audio_block();
-		pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 
 		float left_gain_1, left_gain_2, right_gain_1, right_gain_2;
 		float left_send_1, left_send_2, right_send_1, right_send_2;
@@ -1511,7 +1578,6 @@ void AudioPolyMixerFloat::update()
 		if (!block_out_L || !block_out_R || !block_send_L || !block_send_R)
 		{
 			// unable to allocate memory, so we'll send nothing
-			pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 			if (block_out_L)
 			{
 				release_audio_block(block_out_L);
@@ -1529,119 +1595,82 @@ void AudioPolyMixerFloat::update()
 			{
 				release_audio_block(block_send_R);
 			}
-			pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 
 			return;
 		}
 
-		j = 0;
-		
-		// voice 0
-		if(voice_is_active(0) || voice_waits_for_not_active(0))
+		float *out_l = block_out_L->data;
+		float *out_r = block_out_R->data;
+		float *snd_l = block_send_L->data;
+		float *snd_r = block_send_R->data;
+		float gains[_MIX_NUM_OF_GAINS];
+		float voice_scale, *in1, *in2;
+		int seg_len;
+
+		memset(out_l, 0, audio_block_size * sizeof(float));
+		memset(out_r, 0, audio_block_size * sizeof(float));
+		memset(snd_l, 0, audio_block_size * sizeof(float));
+		memset(snd_r, 0, audio_block_size * sizeof(float));
+
+		// Send gains do not depend on the voice - calculate once per cycle
+		if (midi_mapping_mode == _MIDI_MAPPING_MODE_MAPPING)
 		{
-			for (i = 0; i < audio_block_size; i++) 
-			{
-				// Update modulation factors
-				if((i % _CONTROL_SUB_SAMPLING) == 0)
-				{
-					left_gain_1 = *gain1[0] * (1 - *pan1[0]) * (1 - amp_1_pan_mod_samp[j]) * master_level_1 * 0.1f;
-					left_gain_2 = *gain2[0] * (1 - *pan2[0]) * (1 - amp_2_pan_mod_samp[j]) * master_level_2 * 0.1f;
-					right_gain_1 = *gain1[0] * (1 + *pan1[0]) * (1 + amp_1_pan_mod_samp[j]) * master_level_1 * 0.1f;
-					right_gain_2 = *gain2[0] * (1 + *pan2[0]) * (1 + amp_2_pan_mod_samp[j]) * master_level_2 * 0.1f;
-
-					if (midi_mapping_mode == _MIDI_MAPPING_MODE_MAPPING)
-					{
-						left_send_1 = *send1[0] * (1 - *pan1[0]) * (1 - amp_1_pan_mod) * master_level_1 * 0.1f;
-						left_send_2 = *send2[0] * (1 - *pan2[0]) * (1 - amp_2_pan_mod) * master_level_2 * 0.1f;
-						right_send_1 = *send1[0] * (1 + *pan1[0]) * (1 + amp_1_pan_mod) * master_send_1 * 0.1f;
-						right_send_2 = *send2[0] * (1 + *pan2[0]) * (1 + amp_2_pan_mod) * master_send_2 * 0.1f;
-					}
-					else
-					{
-						left_send_1 = master_send_1 * (1 - master_pan_1) * (1 - amp_1_pan_mod) * 0.1f;
-						left_send_2 = master_send_2 * (1 - master_pan_2) * (1 - amp_2_pan_mod) * 0.1f;
-						right_send_1 = master_send_1 * (1 + master_pan_1) * (1 + amp_1_pan_mod) * 0.1f;
-						right_send_2 = master_send_2 * (1 + master_pan_2) * (1 + amp_2_pan_mod) * 0.1f;
-					}
-					
-					j++;
-				}
-				
-				block_out_L->data[i] =
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_LEFT][i] * left_gain_1 +
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_RIGHT][i] * left_gain_2;
-				block_out_R->data[i] =
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_LEFT][i] * right_gain_1 +
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_RIGHT][i] * right_gain_2;
-
-				block_send_L->data[i] =
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_LEFT][i] * left_send_1 +
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_RIGHT][i] * left_send_2;
-				block_send_R->data[i] =
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_LEFT][i] * right_send_1 +
-					poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[0]->data[_RIGHT][i] * right_send_2;
-			}
+			left_send_1 = *send1[0] * (1 - *pan1[0]) * (1 - amp_1_pan_mod) * master_level_1 * 0.1f;
+			left_send_2 = *send2[0] * (1 - *pan2[0]) * (1 - amp_2_pan_mod) * master_level_2 * 0.1f;
+			right_send_1 = *send1[0] * (1 + *pan1[0]) * (1 + amp_1_pan_mod) * master_send_1 * 0.1f;
+			right_send_2 = *send2[0] * (1 + *pan2[0]) * (1 + amp_2_pan_mod) * master_send_2 * 0.1f;
 		}
 		else
 		{
-			// voice not active - zero values output
-			for (i = 0; i < audio_block_size; i++)
-			{
-				block_out_L->data[i] = 0;
-				block_out_R->data[i] = 0;
-				block_send_L->data[i] = 0;
-				block_send_R->data[i] = 0;
-			}
+			left_send_1 = master_send_1 * (1 - master_pan_1) * (1 - amp_1_pan_mod) * 0.1f;
+			left_send_2 = master_send_2 * (1 - master_pan_2) * (1 - amp_2_pan_mod) * 0.1f;
+			right_send_1 = master_send_1 * (1 + master_pan_1) * (1 + amp_1_pan_mod) * 0.1f;
+			right_send_2 = master_send_2 * (1 + master_pan_2) * (1 + amp_2_pan_mod) * 0.1f;
 		}
-		
-		// All other voices: accumulate samples values to voice[0] samples or to 0 if voice[0] was not active.
-		for (voice = 1; voice < inputs; voice++)
+
+		gains[_MIX_GAIN_SEND_LEFT_1] = left_send_1;
+		gains[_MIX_GAIN_SEND_LEFT_2] = left_send_2;
+		gains[_MIX_GAIN_SEND_RIGHT_1] = right_send_1;
+		gains[_MIX_GAIN_SEND_RIGHT_2] = right_send_2;
+
+		// Accumulate all active voices; gains are updated once per control segment
+		for (voice = 0; voice < inputs; voice++)
 		{
-			j = 0;
-			if (voice_is_active(voice) || voice_waits_for_not_active(voice))
+			if (!voice_is_active(voice) && !voice_waits_for_not_active(voice))
 			{
-				for(i = 0 ; i < audio_block_size ; i++)
+				continue;
+			}
+
+			in1 = poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_LEFT];
+			in2 = poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_RIGHT];
+			// Voice 0 is mixed at half the level of all other voices (legacy levels)
+			voice_scale = (voice == 0) ? 0.1f : 0.2f;
+
+			for (i = 0, j = 0; i < audio_block_size; i += _CONTROL_SUB_SAMPLING, j++)
+			{
+				// Glide toward the program gain/pan to avoid zipper noise on level changes
+				smoothed_gain_1[voice] += (*gain1[voice] - smoothed_gain_1[voice]) * _MIXER_GAIN_PAN_SMOOTHING_FACTOR;
+				smoothed_gain_2[voice] += (*gain2[voice] - smoothed_gain_2[voice]) * _MIXER_GAIN_PAN_SMOOTHING_FACTOR;
+				smoothed_pan_1[voice] += (*pan1[voice] - smoothed_pan_1[voice]) * _MIXER_GAIN_PAN_SMOOTHING_FACTOR;
+				smoothed_pan_2[voice] += (*pan2[voice] - smoothed_pan_2[voice]) * _MIXER_GAIN_PAN_SMOOTHING_FACTOR;
+				
+				left_gain_1 = smoothed_gain_1[voice] * (1 - smoothed_pan_1[voice]) * (1 - amp_1_pan_mod_samp[j]) * master_level_1 * voice_scale;
+				left_gain_2 = smoothed_gain_2[voice] * (1 - smoothed_pan_2[voice]) * (1 - amp_2_pan_mod_samp[j]) * master_level_2 * voice_scale;
+				right_gain_1 = smoothed_gain_1[voice] * (1 + smoothed_pan_1[voice]) * (1 + amp_1_pan_mod_samp[j]) * master_level_1 * voice_scale;
+				right_gain_2 = smoothed_gain_2[voice] * (1 + smoothed_pan_2[voice]) * (1 + amp_2_pan_mod_samp[j]) * master_level_2 * voice_scale;
+
+				gains[_MIX_GAIN_LEFT_1] = left_gain_1;
+				gains[_MIX_GAIN_LEFT_2] = left_gain_2;
+				gains[_MIX_GAIN_RIGHT_1] = right_gain_1;
+				gains[_MIX_GAIN_RIGHT_2] = right_gain_2;
+
+				seg_len = audio_block_size - i;
+				if (seg_len > _CONTROL_SUB_SAMPLING)
 				{
-					// Update modulation factors
-					if((i % _CONTROL_SUB_SAMPLING) == 0)
-					{
-						left_gain_1 = *gain1[voice] * (1 - *pan1[voice]) * (1 - amp_1_pan_mod_samp[j]) * master_level_1 * 0.2f;
-						left_gain_2 = *gain2[voice] * (1 - *pan2[voice]) * (1 - amp_2_pan_mod_samp[j]) * master_level_2 * 0.2f;
-						right_gain_1 = *gain1[voice] * (1 + *pan1[voice]) * (1 + amp_1_pan_mod_samp[j]) * master_level_1 * 0.2f;
-						right_gain_2 = *gain2[voice] * (1 + *pan2[voice]) * (1 + amp_2_pan_mod_samp[j]) * master_level_2 * 0.2f;
-
-						if (midi_mapping_mode == _MIDI_MAPPING_MODE_MAPPING)
-						{
-							left_send_1 = *send1[0] * (1 - *pan1[0]) * (1 - amp_1_pan_mod) * master_level_1 * 0.1f;
-							left_send_2 = *send2[0] * (1 - *pan2[0]) * (1 - amp_2_pan_mod) * master_level_2 * 0.1f;
-							right_send_1 = *send1[0] * (1 + *pan1[0]) * (1 + amp_1_pan_mod) * master_send_1 * 0.1f;
-							right_send_2 = *send2[0] * (1 + *pan2[0]) * (1 + amp_2_pan_mod) * master_send_2 * 0.1f;
-						}
-						else
-						{
-							left_send_1 = master_send_1 * (1 - master_pan_1) * (1 - amp_1_pan_mod) * 0.1f;
-							left_send_2 = master_send_2 * (1 - master_pan_2) * (1 - amp_2_pan_mod) * 0.1f;
-							right_send_1 = master_send_1 * (1 + master_pan_1) * (1 + amp_1_pan_mod) * 0.1f;
-							right_send_2 = master_send_2 * (1 + master_pan_2) * (1 + amp_2_pan_mod) * 0.1f;
-						}
-
-						j++;
-					}
-					
-					block_out_L->data[i] +=
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_LEFT][i] * left_gain_1 +
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_RIGHT][i] * left_gain_2;
-					block_out_R->data[i] +=
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_LEFT][i] * right_gain_1 +
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_RIGHT][i] * right_gain_2;
-
-					block_send_L->data[i] +=
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_LEFT][i] * left_send_1 +
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_RIGHT][i] * left_send_2;
-					block_send_R->data[i] +=
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_LEFT][i] * right_send_1 +
-						poly_mixer_manager->audio_block_stereo_float_shared_memory_voices_output[voice]->data[_RIGHT][i] * right_send_2;
+					seg_len = _CONTROL_SUB_SAMPLING;
 				}
+
+				mix_kernel(out_l + i, out_r + i, snd_l + i, snd_r + i, in1 + i, in2 + i, gains, seg_len);
 			}
 		}
 // Recording TODO:
@@ -1665,12 +1694,10 @@ void AudioPolyMixerFloat::update()
 		transmit_audio_block(block_out_R, _RIGHT);
 		transmit_audio_block(block_send_L, _SEND_LEFT);
 		transmit_audio_block(block_send_R, _SEND_RIGHT);
-		pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 		release_audio_block(block_out_L);
 		release_audio_block(block_out_R);
 		release_audio_block(block_send_L);
 		release_audio_block(block_send_R);
-		pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 	}
 }
 
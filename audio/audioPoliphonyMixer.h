@@ -17,9 +17,14 @@
 #define _AUDIO_POLY_MIXER
 
 #include "audioBlock.h"
+#include "audioMixKernel.h"
+#include "audioParamsQueue.h"
 #include "../libAdjHeartModSynth_2.h"
 #include "../dsp/dspOsc.h"		// for LFOs
 
+// One pole smoothing factor of the voices gain/pan, applied once per control segment
+#define _MIXER_GAIN_PAN_SMOOTHING_FACTOR	0.25f
+
 //#include "audioFloatMultiCore.h"
 //#include "audioBlockFloatMultiCore.h"
 //#include "defs.h"
@@ -94,7 +99,8 @@ public:
 	void set_voice_pan_2_ptr(int voice, int prog);
 	void set_voice_send_1_ptr(int voice, int prog);
 	void set_voice_send_2_ptr(int voice, int prog);
-
+	
+	void bind_voice_program(int voice, int prog);
 
 	float *get_voice_gain_1_ptr(int voice);
 	float *get_voice_gain_2_ptr(int voice);
@@ -160,6 +166,11 @@ private:
 		AudioBlockFloat** audio_first_update_ptr = NULL);
 
 	int inputs;
+	
+	func_ptr_mix_kernel_t mix_kernel;
+	
+	void apply_voice_program_binding(int voice, int prog);
+	static void apply_voice_program_binding_update(const audio_param_update_t *update);
 
 	float *gain1[_SYNTH_MAX_NUM_OF_VOICES];
 	float *gain2[_SYNTH_MAX_NUM_OF_VOICES];
@@ -174,6 +185,12 @@ private:
 	float *preserved_pan_2[_SYNTH_MAX_NUM_OF_VOICES];	
 	float *preserved_send_1[_SYNTH_MAX_NUM_OF_VOICES];
 	float *preserved_send_2[_SYNTH_MAX_NUM_OF_VOICES];
+	
+	// Smoothed values of *gain1[], *gain2[], *pan1[], *pan2[] (audio update thread only)
+	float smoothed_gain_1[_SYNTH_MAX_NUM_OF_VOICES];
+	float smoothed_gain_2[_SYNTH_MAX_NUM_OF_VOICES];
+	float smoothed_pan_1[_SYNTH_MAX_NUM_OF_VOICES];
+	float smoothed_pan_2[_SYNTH_MAX_NUM_OF_VOICES];
 
 	float lfo_1_actual_freq, lfo_2_actual_freq, lfo_3_actual_freq, lfo_4_actual_freq, lfo_5_actual_freq;
 	float lfo_out[5];
@@ -1,8 +1,12 @@
 /**
 *	@file		audioVoice.cpp
 *	@author		Nahum Budin
-*	@date		29_Jan-2021
-*	@version	1.1 
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. Note on/off events are applied at their frame offset inside
+*					   the audio block (sample-accurate scheduling).
+*
+*	@version	1.1		29_Jan-2021
 *					1. Code refactoring and notaion.
 *					2. Adding sample-rate and bloc-size settings
 *					
@@ -19,9 +23,6 @@
 #include "../commonDefs.h"
 #include "../synthesizer/adjSynth.h"
 
-// Mutex to controll audio memory blocks allocation 
-extern pthread_mutex_t voice_mem_blocks_allocation_control_mutex;
-
 //func_ptr_void_int_bool_t free_voice_callback = NULL;
 
 
@@ -132,6 +133,8 @@ void AudioVoiceFloat::init_poly()
 	wait_for_not_active = false;
 	timestamp = 0;
 	note = -1;
+	note_frequency = 0.0f;
+	pitch_bend_factor = 1.0f;
 	if (dsp_voice)
 	{
 		dsp_voice->reset_wait_for_not_active();
@@ -330,17 +333,124 @@ float AudioVoiceFloat::get_magnitude()
 	return magnitude; 
 }
 
+/**
+*   @brief  Post a timestamped note on/off or pitch bend event, applied by the voice
+*			update at the event frame offset inside the audio block.
+*			Called by the MIDI thread (under the voices management mutex).
+*   @param  event	a pointer to the event (copied)
+*   @return true if posted; false if the queue is full - the caller should then
+*			apply the event directly (apply_event())
+*/
+bool AudioVoiceFloat::post_event(const audio_voice_event_t *event)
+{
+	return events_queue.post(event);
+}
+
+/**
+*   @brief  Return true if note on/off events were posted and not applied yet
+*			(e.g. a voice that was allocated but did not start playing yet).
+*			Called by the audio update thread (not while the voice is updated).
+*   @param  none
+*   @return true if events are pending
+*/
+bool AudioVoiceFloat::has_pending_events()
+{
+	return events_queue.get_next_event() != NULL;
+}
+
+/**
+*   @brief  Apply a note on/off or pitch bend event to the voice DSP objects.
+*   @param  event	a pointer to the event
+*   @return void
+*/
+void AudioVoiceFloat::apply_event(const audio_voice_event_t *event)
+{
+	if (!dsp_voice || !event)
+	{
+		return;
+	}
+	
+	if (event->type == _AUDIO_VOICE_EVENT_NOTE_ON)
+	{
+		note_frequency = event->frequency;
+		pitch_bend_factor = event->pitch_factor;
+		dsp_voice->set_voice_frequency(note_frequency * pitch_bend_factor);
+
+		dsp_voice->filter1->set_kbd_freq(event->frequency);
+		dsp_voice->filter2->set_kbd_freq(event->frequency);
+
+		set_magnitude(event->magnitude);
+		dsp_voice->karplus1->note_on(event->note, event->magnitude);
+
+		dsp_voice->adsr_note_on(dsp_voice->adsr1);
+		dsp_voice->adsr_note_on(dsp_voice->adsr2);
+		dsp_voice->adsr_note_on(dsp_voice->adsr3);
+		dsp_voice->adsr_note_on(dsp_voice->adsr4);
+		dsp_voice->adsr_note_on(dsp_voice->adsr5);
+	}
+	else if (event->type == _AUDIO_VOICE_EVENT_NOTE_OFF)
+	{
+		dsp_voice->adsr_note_off(dsp_voice->adsr1);
+		dsp_voice->adsr_note_off(dsp_voice->adsr2);
+		dsp_voice->adsr_note_off(dsp_voice->adsr3);
+		dsp_voice->adsr_note_off(dsp_voice->adsr4);
+		dsp_voice->adsr_note_off(dsp_voice->adsr5);
+		dsp_voice->karplus1->note_off();
+	}
+	else if (event->type == _AUDIO_VOICE_EVENT_PITCH_BEND)
+	{
+		pitch_bend_factor = event->pitch_factor;
+		if (note_frequency > 0.0f)
+		{
+			dsp_voice->set_voice_frequency(note_frequency * pitch_bend_factor);
+		}
+	}
+}
+
+/**
+*   @brief  Render a segment of the voice output block and apply the voice magnitude.
+*   @param  ch1		a pointer to channel 1 output block
+*   @param  ch2		a pointer to channel 2 output block
+*   @param	offset	segment first sample offset in the block
+*   @param  n		number of samples
+*   @return void
+*/
+void AudioVoiceFloat::render_segment(float *ch1, float *ch2, int offset, int n)
+{
+	int i;
+	
+	if (n <= 0)
+	{
+		return;
+	}
+	
+	ch1 += offset;
+	ch2 += offset;
+	
+	// Render the segment; control sub-blocks stay aligned to the block start
+	dsp_voice->render_block(ch1, ch2, n, voice_num, offset);
+
+	// magnitude - Note scaled volume (see kbd)
+	for (i = 0; i < n; i++) 
+	{
+		ch1[i] *= magnitude;
+		ch2[i] *= magnitude; 
+	}
+}
+
 /**
 *   @brief  Execute an update cycle - generate the voice audio block and 
 *			send it to next audio block stage.
+*			Pending note on/off and pitch bend events split the block: the block is rendered up
+*			to each event frame offset, and the event is applied there.
 *   @param  none
 *   @return void
 */
 void AudioVoiceFloat::update()
 {
 	audio_block_float_mono_t *block_out1, *block_out2; 
-	volatile int i, j = 0;
-	float samp1, samp2;
+	audio_voice_event_t *event;
+	int offset, event_offset;
 	
 	// Verify
 	if(!dsp_voice)
@@ -354,52 +464,51 @@ void AudioVoiceFloat::update()
 	}
 	
 	// Get audio out blocks
-	pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 	block_out1 = allocate_audio_block();
 	block_out2 = allocate_audio_block();
-	pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 	if (!block_out1 || !block_out2) 
 	{
 		// unable to allocate memory, so we'll send nothing
 		if(block_out1)
 		{
-			pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 			release_audio_block(block_out1);
-			pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 		}
 		if (block_out2)
 		{
-			pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 			release_audio_block(block_out2);
-			pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 		}
 		// Unfortuneatlly, that's it
 		return;
 	}
 
 	dsp_voice->calc_next_modulation_values();
-
-	for (i = 0; i < audio_block_size; i++) 
+	
+	offset = 0;
+	event = events_queue.get_next_event();
+	while (event)
 	{
-		// Update modulation factors
-		if((i % _CONTROL_SUB_SAMPLING) == 0)
+		event_offset = AudioVoiceEventsQueue::get_frame_offset(event->timestamp_ns, audio_block_size);
+		if (event_offset < 0)
 		{
-			dsp_voice->calc_next_modulation_values();
-			dsp_voice->update_voice_modulation(voice_num);
+			// Arrived after this cycle started - next cycle
+			break;
 		}
-
-		dsp_voice->calc_next_oscilators_output_value();
-
-		// magnitude - Note scaled volume (see kbd)
 		
-		block_out1->data[i] = dsp_voice->get_next_output_value_ch1() * magnitude;
-		block_out2->data[i] = dsp_voice->get_next_output_value_ch2() * magnitude; 
+		if (event_offset > offset)
+		{
+			render_segment(block_out1->data, block_out2->data, offset, event_offset - offset);
+			offset = event_offset;
+		}
+		
+		apply_event(event);
+		events_queue.release_next_event();
+		event = events_queue.get_next_event();
 	}
+	
+	render_segment(block_out1->data, block_out2->data, offset, audio_block_size - offset);
 		
 	transmit_audio_block(block_out1, _SYNTH_VOICE_OUT_1);	
 	transmit_audio_block(block_out2, _SYNTH_VOICE_OUT_2);
-	pthread_mutex_lock(&voice_mem_blocks_allocation_control_mutex);
 	release_audio_block(block_out1);
 	release_audio_block(block_out2);
-	pthread_mutex_unlock(&voice_mem_blocks_allocation_control_mutex);
 }
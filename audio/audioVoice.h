@@ -1,8 +1,12 @@
 /**
 *	@file		audioVoice.h
 *	@author		Nahum Budin
-*	@date		29_Jan-2021
-*	@version	1.1 
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. Note on/off and pitch bend events are applied at their frame
+*					   offset inside the audio block (sample-accurate scheduling).
+*
+*	@version	1.1		29_Jan-2021
 *					1. Code refactoring and notaion.
 *					2. Adding sample-rate and bloc-size settings
 *					
@@ -15,6 +19,7 @@
 #define _AUDIO_VOICE
 
 #include "audioBlock.h"
+#include "audioVoiceEvents.h"
 #include "../dsp/dspVoice.h"
 
 #include "../libAdjHeartModSynth_2.h"
@@ -72,12 +77,23 @@ public:
 	void set_magnitude(float mag);
 	float get_magnitude();
 	
+	bool post_event(const audio_voice_event_t *event);
+	void apply_event(const audio_voice_event_t *event);
+	bool has_pending_events();
+	
 	virtual void update(void);
 	
 private:
 	
+	void render_segment(float *ch1, float *ch2, int offset, int n);
+	
+	// Timed note on/off and pitch bend events (MIDI thread to voice update)
+	AudioVoiceEventsQueue events_queue;
+	
 	int voice_num;
 	float magnitude;
+	// The played note frequency (not bent) and the pitch bend factor
+	float note_frequency, pitch_bend_factor;
 	bool active, wait_for_not_active;
 	int note;
 	uint64_t timestamp;
@@ -0,0 +1,135 @@
+/**
+*	@file		audioVoiceEvents.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A wait-free single-producer/single-consumer time-ordered queue of
+*				timestamped voice events (note on/off, pitch bend).
+*/
+
+#include "audioVoiceEvents.h"
+
+uint64_t AudioVoiceEventsQueue::cycle_start_ns = 0;
+uint64_t AudioVoiceEventsQueue::previous_cycle_start_ns = 0;
+
+/**
+*   @brief  Create an AudioVoiceEventsQueue object instance.
+*   @param  none
+*   @return none
+*/
+AudioVoiceEventsQueue::AudioVoiceEventsQueue()
+{
+	last_timestamp_ns = 0;
+}
+
+/**
+*   @brief  Post an event to be applied by the voice update.
+*			Events are kept in time order: an event older than the last posted
+*			one is scheduled at the last posted event time.
+*   @param  event	a pointer to the event (copied)
+*   @return true if posted; false if the queue is full - the caller should then
+*			apply the event directly
+*/
+bool AudioVoiceEventsQueue::post(const audio_voice_event_t *event)
+{
+	audio_voice_event_t *slot;
+
+	if (event == NULL)
+	{
+		return false;
+	}
+
+	slot = events.get_write_slot();
+	if (slot == NULL)
+	{
+		return false;
+	}
+
+	*slot = *event;
+	if (slot->timestamp_ns < last_timestamp_ns)
+	{
+		slot->timestamp_ns = last_timestamp_ns;
+	}
+	last_timestamp_ns = slot->timestamp_ns;
+
+	// Publish the event
+	events.commit_write_slot();
+
+	return true;
+}
+
+/**
+*   @brief  Return the oldest pending event without removing it.
+*   @param  none
+*   @return a pointer to the event; NULL if none
+*/
+audio_voice_event_t *AudioVoiceEventsQueue::get_next_event() { return events.get_read_slot(); }
+
+/**
+*   @brief  Remove the oldest pending event (after it was applied).
+*   @param  none
+*   @return void
+*/
+void AudioVoiceEventsQueue::release_next_event()
+{
+	if (events.get_read_slot() != NULL)
+	{
+		// Free the slot for the producer
+		events.release_read_slot();
+	}
+}
+
+/**
+*   @brief  Return the number of posts that found the queue full.
+*   @param  none
+*   @return overflows count
+*/
+uint32_t AudioVoiceEventsQueue::get_overflows_count() { return events.get_overflows_count(); }
+
+/**
+*   @brief  Set the start time of the update cycle that is about to run.
+*			Must be called before the voices are updated.
+*   @param  start_ns	cycle start time (CLOCK_MONOTONIC ns)
+*   @return void
+*/
+void AudioVoiceEventsQueue::set_cycle_start_ns(uint64_t start_ns)
+{
+	__atomic_store_n(&previous_cycle_start_ns, __atomic_load_n(&cycle_start_ns, __ATOMIC_RELAXED), __ATOMIC_RELAXED);
+	__atomic_store_n(&cycle_start_ns, start_ns, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Return the frame offset inside the current audio block of an event.
+*			The previous cycle period is mapped onto the current block, so events
+*			keep their relative timing with a constant one period delay.
+*   @param  timestamp_ns	event time (CLOCK_MONOTONIC ns)
+*   @param	block_size		audio block size (samples)
+*   @return frame offset 0 to block_size - 1 (late events: 0); -1 if the event
+*			arrived after the current cycle started (apply in the next cycle)
+*/
+int AudioVoiceEventsQueue::get_frame_offset(uint64_t timestamp_ns, int block_size)
+{
+	uint64_t start = __atomic_load_n(&cycle_start_ns, __ATOMIC_RELAXED);
+	uint64_t previous_start = __atomic_load_n(&previous_cycle_start_ns, __ATOMIC_RELAXED);
+	int offset;
+
+	if (timestamp_ns >= start)
+	{
+		return -1;
+	}
+
+	if ((previous_start == 0) || (start <= previous_start) || (timestamp_ns <= previous_start))
+	{
+		// First cycle or a late event
+		return 0;
+	}
+
+	offset = (int)((timestamp_ns - previous_start) * (uint64_t)block_size / (start - previous_start));
+	if (offset >= block_size)
+	{
+		offset = block_size - 1;
+	}
+
+	return offset;
+}
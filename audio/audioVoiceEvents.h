@@ -0,0 +1,80 @@
+/**
+*	@file		audioVoiceEvents.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A wait-free single-producer/single-consumer time-ordered queue of
+*				timestamped voice events (note on/off, pitch bend), posted by the MIDI thread and
+*				applied by the voice update at the event frame offset inside the
+*				audio block.
+*
+*				The queue is an SpscRing (lockFreeRings.h) that keeps the posted
+*				events in time order.
+*
+*				Events are scheduled with a constant delay of one audio period: an
+*				event that arrived during the previous update cycle period is applied
+*				at the same relative position inside the current block.
+*/
+
+#ifndef _AUDIO_VOICE_EVENTS
+#define _AUDIO_VOICE_EVENTS
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../utils/lockFreeRings.h"
+
+// Number of queue entries (must be a power of 2)
+#define _AUDIO_VOICE_EVENTS_QUEUE_SIZE			32
+
+#define _AUDIO_VOICE_EVENT_NOTE_ON				1
+#define _AUDIO_VOICE_EVENT_NOTE_OFF				2
+#define _AUDIO_VOICE_EVENT_PITCH_BEND			3
+
+typedef struct audio_voice_event
+{
+	// Arrival time (CLOCK_MONOTONIC ns)
+	uint64_t timestamp_ns;
+	int type;
+	int note;
+	// Note on only
+	float frequency;
+	// Note on only: scaled velocity 0.0 to 1.0
+	float magnitude;
+	// Note on and pitch bend: pitch bend frequency factor
+	float pitch_factor;
+} audio_voice_event_t;
+
+class AudioVoiceEventsQueue
+{
+public:
+	AudioVoiceEventsQueue();
+
+	// Producer side (MIDI thread; producers must be serialized by the caller)
+	bool post(const audio_voice_event_t *event);
+
+	// Consumer side (voice update)
+	audio_voice_event_t *get_next_event();
+	void release_next_event();
+
+	uint32_t get_overflows_count();
+
+	// Audio update thread, at the start of each update cycle
+	static void set_cycle_start_ns(uint64_t start_ns);
+	// Voices update (any worker)
+	static int get_frame_offset(uint64_t timestamp_ns, int block_size);
+
+private:
+	// Posts that find the ring full are counted as overflows (applied directly by the poster)
+	SpscRing<audio_voice_event_t, _AUDIO_VOICE_EVENTS_QUEUE_SIZE> events;
+
+	// Keeps posted timestamps in order
+	uint64_t last_timestamp_ns;
+
+	// Start times of the current and the previous update cycles
+	static uint64_t cycle_start_ns;
+	static uint64_t previous_cycle_start_ns;
+};
+
+#endif
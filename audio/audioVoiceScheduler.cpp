@@ -0,0 +1,532 @@
+/**
+*	@file		audioVoiceScheduler.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Work-stealing scheduler that renders the active voices of an
+*				audio update cycle on a persistent pool of pinned real-time
+*				worker threads.
+*
+*				Each cycle only the active voices are scheduled. They are sorted
+*				by their measured render cost and dealt to the per-core deques
+*				heaviest first, each one to the least loaded core (LPT). Every
+*				worker renders its own deque from the head; a worker that runs
+*				out of work steals from the tail of the deque with the largest
+*				remaining estimated cost. The thread that runs the cycle
+*				(update thread or JACK callback) acts as worker 0.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <sched.h>
+
+#include "audioVoiceScheduler.h"
+#include "../misc/priorities.h"
+
+/**
+*   @brief  Create an AudioVoiceScheduler object instance and start its workers.
+*   @param  num_of_cores	number of cpu cores (one worker per core)
+*   @return none
+*/
+AudioVoiceScheduler::AudioVoiceScheduler(int num_of_cores)
+{
+	num_of_workers = num_of_cores;
+	if (num_of_workers < 1)
+	{
+		num_of_workers = 1;
+	}
+	else if (num_of_workers > _SYNTH_MAX_NUM_OF_CORES)
+	{
+		num_of_workers = _SYNTH_MAX_NUM_OF_CORES;
+	}
+
+	for (int v = 0; v < _SYNTH_MAX_NUM_OF_VOICES; v++)
+	{
+		voice_cost_ns[v] = _VOICE_SCHED_DEFAULT_VOICE_COST_NS;
+	}
+
+	for (int w = 0; w < _SYNTH_MAX_NUM_OF_CORES; w++)
+	{
+		deques[w].range = 0;
+		deques[w].remaining_cost = 0;
+	}
+
+	update_voice_ptr = NULL;
+	latency_stats = NULL;
+	num_of_cycle_voices = 0;
+	voices_done = 0;
+	workers_busy = 0;
+	steals_count = 0;
+	workers_running = false;
+
+	start_workers();
+}
+
+AudioVoiceScheduler::~AudioVoiceScheduler()
+{
+	stop_workers();
+}
+
+/**
+*   @brief  Start the worker threads (worker 1 to num_of_workers - 1),
+*			each pinned to its own core and running at the update thread
+*			real-time priority.
+*   @param  none
+*   @return void
+*/
+void AudioVoiceScheduler::start_workers()
+{
+	int ret;
+	pthread_attr_t tattr;
+	struct sched_param params;
+	cpu_set_t cpuset;
+	char name[16];
+
+	workers_running = true;
+
+	for (int w = 1; w < num_of_workers; w++)
+	{
+		workers[w].scheduler = this;
+		workers[w].index = w;
+		sem_init(&workers[w].wake_sem, 0, 0);
+
+		ret = pthread_attr_init(&tattr);
+		ret = pthread_attr_getschedparam(&tattr, &params);
+		params.sched_priority = sched_get_priority_max(SCHED_RR) - _THREAD_PRIORITY_UPDATE;
+		ret = pthread_attr_setinheritsched(&tattr, PTHREAD_EXPLICIT_SCHED);
+		ret = pthread_attr_setschedpolicy(&tattr, SCHED_RR);
+		ret = pthread_attr_setschedparam(&tattr, &params);
+		if (ret != 0)
+		{
+			fprintf(stderr, "Voice scheduler: Unsuccessful in setting worker %i realtime prio\n", w);
+		}
+
+		CPU_ZERO(&cpuset);
+		CPU_SET(w, &cpuset);
+		pthread_attr_setaffinity_np(&tattr, sizeof(cpu_set_t), &cpuset);
+
+		ret = pthread_create(&workers[w].thread_id, &tattr, worker_thread, &workers[w]);
+		pthread_attr_destroy(&tattr);
+		
+		if (ret != 0)
+		{
+			// No RT permissions (or core not available) - run unpinned with default scheduling
+			fprintf(stderr, "Voice scheduler: worker %i runs without realtime prio/affinity\n", w);
+			ret = pthread_create(&workers[w].thread_id, NULL, worker_thread, &workers[w]);
+		}
+
+		if (ret != 0)
+		{
+			fprintf(stderr, "Voice scheduler: Unable to create worker %i\n", w);
+			num_of_workers = w;
+			break;
+		}
+
+		snprintf(name, sizeof(name), "aud_voice_wrk_%i", w);
+		pthread_setname_np(workers[w].thread_id, name);
+	}
+}
+
+/**
+*   @brief  Stop and join the worker threads.
+*   @param  none
+*   @return void
+*/
+void AudioVoiceScheduler::stop_workers()
+{
+	if (!workers_running)
+	{
+		return;
+	}
+
+	__atomic_store_n(&workers_running, false, __ATOMIC_RELEASE);
+
+	for (int w = 1; w < num_of_workers; w++)
+	{
+		sem_post(&workers[w].wake_sem);
+		pthread_join(workers[w].thread_id, NULL);
+		sem_destroy(&workers[w].wake_sem);
+	}
+}
+
+/**
+*   @brief  Worker thread - sleeps until woken for a cycle, renders and steals
+*			voices until no work is left.
+*   @param  arg	a pointer to the worker voice_sched_worker_t
+*   @return void*
+*/
+void *AudioVoiceScheduler::worker_thread(void *arg)
+{
+	voice_sched_worker_t *worker = (voice_sched_worker_t *)arg;
+	AudioVoiceScheduler *scheduler = worker->scheduler;
+
+	while (true)
+	{
+		if (sem_wait(&worker->wake_sem) != 0)
+		{
+			// Interrupted (EINTR)
+			continue;
+		}
+
+		if (!__atomic_load_n(&scheduler->workers_running, __ATOMIC_ACQUIRE))
+		{
+			break;
+		}
+
+		scheduler->process(worker->index);
+
+		__atomic_sub_fetch(&scheduler->workers_busy, 1, __ATOMIC_RELEASE);
+	}
+
+	return NULL;
+}
+
+/**
+*   @brief  Render all active voices of one update cycle. Returns when all
+*			of them were rendered.
+*   @param  num_of_voices	number of voices
+*   @param	voice_is_active	returns true if a voice has to be rendered
+*   @param	update_voice	renders a voice
+*   @return void
+*/
+void AudioVoiceScheduler::run_cycle(int num_of_voices, func_ptr_bool_int_t voice_is_active, func_ptr_void_int_t update_voice)
+{
+	int *active_voices = cycle_voices;
+	uint32_t load[_SYNTH_MAX_NUM_OF_CORES];
+	int count[_SYNTH_MAX_NUM_OF_CORES];
+	int num_of_active = 0, num_of_used_workers, voice, i, j, w, min_w;
+	int spins = 0;
+
+	num_of_cycle_voices = 0;
+
+	if ((update_voice == NULL) || (num_of_voices <= 0))
+	{
+		return;
+	}
+
+	if (num_of_voices > _SYNTH_MAX_NUM_OF_VOICES)
+	{
+		num_of_voices = _SYNTH_MAX_NUM_OF_VOICES;
+	}
+
+	// Collect the active voices, sorted by estimated cost - heaviest first
+	for (voice = 0; voice < num_of_voices; voice++)
+	{
+		if (voice_is_active && !voice_is_active(voice))
+		{
+			continue;
+		}
+
+		for (i = num_of_active; (i > 0) && (voice_cost_ns[active_voices[i - 1]] < voice_cost_ns[voice]); i--)
+		{
+			active_voices[i] = active_voices[i - 1];
+		}
+
+		active_voices[i] = voice;
+		num_of_active++;
+	}
+
+	num_of_cycle_voices = num_of_active;
+
+	if (num_of_active == 0)
+	{
+		return;
+	}
+
+	update_voice_ptr = update_voice;
+
+	num_of_used_workers = num_of_workers;
+	if (num_of_used_workers > num_of_active)
+	{
+		num_of_used_workers = num_of_active;
+	}
+
+	if (num_of_used_workers == 1)
+	{
+		// Nothing to share
+		for (i = 0; i < num_of_active; i++)
+		{
+			render_voice(active_voices[i]);
+		}
+
+		return;
+	}
+
+	// Deal voices to the least loaded worker (longest processing time first)
+	for (w = 0; w < num_of_used_workers; w++)
+	{
+		load[w] = 0;
+		count[w] = 0;
+	}
+
+	for (i = 0; i < num_of_active; i++)
+	{
+		min_w = 0;
+		for (j = 1; j < num_of_used_workers; j++)
+		{
+			if (load[j] < load[min_w])
+			{
+				min_w = j;
+			}
+		}
+
+		deques[min_w].voices[count[min_w]++] = active_voices[i];
+		load[min_w] += voice_cost_ns[active_voices[i]];
+	}
+
+	for (w = 0; w < num_of_workers; w++)
+	{
+		if (w < num_of_used_workers)
+		{
+			__atomic_store_n(&deques[w].remaining_cost, load[w], __ATOMIC_RELAXED);
+			__atomic_store_n(&deques[w].range, (uint32_t)count[w] << 16, __ATOMIC_RELAXED);
+		}
+		else
+		{
+			__atomic_store_n(&deques[w].remaining_cost, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&deques[w].range, 0, __ATOMIC_RELAXED);
+		}
+	}
+
+	__atomic_store_n(&voices_done, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&workers_busy, num_of_used_workers - 1, __ATOMIC_RELEASE);
+
+	for (w = 1; w < num_of_used_workers; w++)
+	{
+		sem_post(&workers[w].wake_sem);
+	}
+
+	// The cycle owner is worker 0
+	process(0);
+
+	// Wait for the last voices to complete and for all workers to leave the deques
+	while ((__atomic_load_n(&voices_done, __ATOMIC_ACQUIRE) < num_of_active) ||
+		   (__atomic_load_n(&workers_busy, __ATOMIC_ACQUIRE) > 0))
+	{
+		if (++spins >= _VOICE_SCHED_WAIT_SPINS)
+		{
+			sched_yield();
+			spins = 0;
+		}
+	}
+}
+
+/**
+*   @brief  Render voices from the worker own deque, then steal from others
+*			until there is no more work.
+*   @param  worker	worker index
+*   @return void
+*/
+void AudioVoiceScheduler::process(int worker)
+{
+	int voice;
+
+	while (true)
+	{
+		voice = claim_own_voice(worker);
+		if (voice < 0)
+		{
+			voice = steal_voice(worker);
+			if (voice < 0)
+			{
+				break;
+			}
+		}
+
+		render_voice(voice);
+		__atomic_add_fetch(&voices_done, 1, __ATOMIC_RELEASE);
+	}
+}
+
+/**
+*   @brief  Claim the next voice from the head of the worker own deque.
+*   @param  worker	worker index
+*   @return voice number; -1 if deque is empty
+*/
+int AudioVoiceScheduler::claim_own_voice(int worker)
+{
+	voice_sched_deque_t *dq = &deques[worker];
+	uint32_t range = __atomic_load_n(&dq->range, __ATOMIC_ACQUIRE);
+	uint32_t head, tail;
+	int voice;
+
+	while (true)
+	{
+		head = range & 0xffff;
+		tail = range >> 16;
+		if (head >= tail)
+		{
+			return -1;
+		}
+
+		if (__atomic_compare_exchange_n(&dq->range, &range, (tail << 16) | (head + 1),
+				true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			voice = dq->voices[head];
+			__atomic_sub_fetch(&dq->remaining_cost, voice_cost_ns[voice], __ATOMIC_RELAXED);
+			return voice;
+		}
+	}
+}
+
+/**
+*   @brief  Steal a voice from the tail of the deque with the largest remaining
+*			estimated cost.
+*   @param  worker	the stealing worker index
+*   @return voice number; -1 if all deques are empty
+*/
+int AudioVoiceScheduler::steal_voice(int worker)
+{
+	voice_sched_deque_t *dq;
+	uint32_t range, head, tail, cost, max_cost;
+	int w, victim, voice;
+
+	while (true)
+	{
+		victim = -1;
+		max_cost = 0;
+
+		for (w = 0; w < num_of_workers; w++)
+		{
+			if (w == worker)
+			{
+				continue;
+			}
+
+			range = __atomic_load_n(&deques[w].range, __ATOMIC_ACQUIRE);
+			if ((range & 0xffff) >= (range >> 16))
+			{
+				// Empty
+				continue;
+			}
+
+			cost = __atomic_load_n(&deques[w].remaining_cost, __ATOMIC_RELAXED);
+			if ((victim < 0) || (cost > max_cost))
+			{
+				victim = w;
+				max_cost = cost;
+			}
+		}
+
+		if (victim < 0)
+		{
+			return -1;
+		}
+
+		dq = &deques[victim];
+		range = __atomic_load_n(&dq->range, __ATOMIC_ACQUIRE);
+		head = range & 0xffff;
+		tail = range >> 16;
+		if (head >= tail)
+		{
+			// Emptied meanwhile - look again
+			continue;
+		}
+
+		if (__atomic_compare_exchange_n(&dq->range, &range, ((tail - 1) << 16) | head,
+				false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		{
+			voice = dq->voices[tail - 1];
+			__atomic_sub_fetch(&dq->remaining_cost, voice_cost_ns[voice], __ATOMIC_RELAXED);
+			__atomic_add_fetch(&steals_count, 1, __ATOMIC_RELAXED);
+			return voice;
+		}
+	}
+}
+
+/**
+*   @brief  Render a voice and update its cost estimate.
+*   @param  voice	voice number
+*   @return void
+*/
+void AudioVoiceScheduler::render_voice(int voice)
+{
+	uint64_t start_ns = audio_latency_now_ns();
+	int64_t measured, estimate;
+
+	update_voice_ptr(voice);
+
+	measured = (int64_t)(audio_latency_now_ns() - start_ns);
+	estimate = voice_cost_ns[voice];
+	estimate += (measured - estimate) / (1 << _VOICE_SCHED_COST_EWMA_SHIFT);
+	if (estimate < 1)
+	{
+		estimate = 1;
+	}
+
+	voice_cost_ns[voice] = (uint32_t)estimate;
+
+	if (latency_stats)
+	{
+		latency_stats->record(_AUDIO_LATENCY_STAGE_VOICE, (uint64_t)measured);
+	}
+}
+
+/**
+*   @brief  Set the latency statistics that voices render times are recorded into.
+*   @param  stats	a pointer to an AudioLatencyStats object (NULL: not recorded)
+*   @return void
+*/
+void AudioVoiceScheduler::set_latency_stats(AudioLatencyStats *stats)
+{
+	latency_stats = stats;
+}
+
+/**
+*   @brief  Return the number of workers (including the cycle owner thread).
+*   @param  none
+*   @return number of workers
+*/
+int AudioVoiceScheduler::get_num_of_workers() { return num_of_workers; }
+
+/**
+*   @brief  Return a voice render cost estimate.
+*   @param  voice	voice number
+*   @return estimated render time (ns); 0 if voice is out of range
+*/
+uint32_t AudioVoiceScheduler::get_voice_cost_ns(int voice)
+{
+	if ((voice < 0) || (voice >= _SYNTH_MAX_NUM_OF_VOICES))
+	{
+		return 0;
+	}
+
+	return voice_cost_ns[voice];
+}
+
+/**
+*   @brief  Return the voices rendered by the last update cycle.
+*			Valid on the cycle owner thread until the next cycle starts.
+*   @param  voices	set to point to the voices numbers
+*   @return number of voices
+*/
+int AudioVoiceScheduler::get_cycle_voices(const int **voices)
+{
+	if (voices)
+	{
+		*voices = cycle_voices;
+	}
+
+	return num_of_cycle_voices;
+}
+
+/**
+*   @brief  Return the number of stolen voices since the last reset.
+*   @param  none
+*   @return steals counter
+*/
+uint32_t AudioVoiceScheduler::get_steals_count()
+{
+	return __atomic_load_n(&steals_count, __ATOMIC_RELAXED);
+}
+
+/**
+*   @brief  Reset the stolen voices counter.
+*   @param  none
+*   @return void
+*/
+void AudioVoiceScheduler::reset_steals_count()
+{
+	__atomic_store_n(&steals_count, 0, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,101 @@
+/**
+*	@file		audioVoiceScheduler.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Work-stealing scheduler that renders the active voices of an
+*				audio update cycle on a persistent pool of pinned real-time
+*				worker threads.
+*/
+
+#ifndef _AUDIO_VOICE_SCHEDULER
+#define _AUDIO_VOICE_SCHEDULER
+
+#include <stdint.h>
+#include <pthread.h>
+#include <semaphore.h>
+
+#include "audioLatencyStats.h"
+#include "../libAdjHeartModSynth_2.h"
+
+// Initial voice render cost estimate (before it was ever measured)
+#define _VOICE_SCHED_DEFAULT_VOICE_COST_NS		20000
+// Cost estimate smoothing: est += (measured - est) >> shift
+#define _VOICE_SCHED_COST_EWMA_SHIFT			2
+// Spins before the cycle owner yields the cpu while waiting for workers
+#define _VOICE_SCHED_WAIT_SPINS					2000
+
+// Per worker (core) voices deque - claimed from the head by its owner and
+// stolen from the tail by other workers
+typedef struct alignas(64) voice_sched_deque
+{
+	// head (low 16 bits) | tail (high 16 bits), updated by CAS
+	uint32_t range;
+	// Estimated cost of not yet claimed voices
+	uint32_t remaining_cost;
+	int voices[_SYNTH_MAX_NUM_OF_VOICES];
+} voice_sched_deque_t;
+
+class AudioVoiceScheduler;
+
+typedef struct voice_sched_worker
+{
+	AudioVoiceScheduler *scheduler;
+	int index;
+	pthread_t thread_id;
+	sem_t wake_sem;
+} voice_sched_worker_t;
+
+class AudioVoiceScheduler
+{
+public:
+	AudioVoiceScheduler(int num_of_cores);
+	~AudioVoiceScheduler();
+
+	void run_cycle(int num_of_voices, func_ptr_bool_int_t voice_is_active, func_ptr_void_int_t update_voice);
+
+	void set_latency_stats(AudioLatencyStats *stats);
+
+	int get_num_of_workers();
+	uint32_t get_voice_cost_ns(int voice);
+	int get_cycle_voices(const int **voices);
+	uint32_t get_steals_count();
+	void reset_steals_count();
+
+private:
+	void start_workers();
+	void stop_workers();
+
+	void process(int worker);
+	int claim_own_voice(int worker);
+	int steal_voice(int worker);
+	void render_voice(int voice);
+
+	static void *worker_thread(void *arg);
+
+	// Workers including the cycle owner thread (worker 0)
+	int num_of_workers;
+	bool workers_running;
+
+	voice_sched_deque_t deques[_SYNTH_MAX_NUM_OF_CORES];
+	voice_sched_worker_t workers[_SYNTH_MAX_NUM_OF_CORES];
+
+	// Per voice render cost estimate (ns)
+	uint32_t voice_cost_ns[_SYNTH_MAX_NUM_OF_VOICES];
+
+	// Voices rendered by the last cycle (heaviest first)
+	int cycle_voices[_SYNTH_MAX_NUM_OF_VOICES];
+	int num_of_cycle_voices;
+
+	func_ptr_void_int_t update_voice_ptr;
+
+	AudioLatencyStats *latency_stats;
+
+	int voices_done;
+	int workers_busy;
+
+	uint32_t steals_count;
+};
+
+#endif
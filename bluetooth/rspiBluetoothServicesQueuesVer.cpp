@@ -1,8 +1,12 @@
 /**
 * @file		rspiBluetoothServicesQueuesVer.h
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.2
+*	@date		17-Oct-2026
+*	@version	1.3
+*					1. Data is transferred through preallocated lock-free rings of fixed-size
+*					   records instead of SafeQueue (no allocations); a tx ring per channel.
+*
+*	@version	1.2		6-Feb-2021
 *					1. Code refactoring and notaion.
 *
 *	@brief		Bluetooth thered using thread-safe message queues for transferring data.
@@ -38,11 +42,8 @@ uint8_t Raspi3BluetoothQ::num_of_used_channels;
 
 Raspi3BluetoothQ *Raspi3BluetoothQ::raspi_bluetooth_instance;
 
-SafeQueue<bt_chan_data_t*> Raspi3BluetoothQ::bt_rx_queue_alsa;
-SafeQueue<bt_chan_data_t*> Raspi3BluetoothQ::bt_rx_queue_raw;
-SafeQueue<bt_chan_data_t*> Raspi3BluetoothQ::bt_tx_queue;
-
-bt_chan_data_t *tx_channel_data;
+bt_rx_ring_t Raspi3BluetoothQ::bt_rx_queue_alsa;
+bt_tx_ring_t Raspi3BluetoothQ::bt_tx_queue[_NUMBER_OF_BT_CONNECTIONS];
 
 Raspi3BluetoothQ::Raspi3BluetoothQ()
 {
@@ -405,6 +406,8 @@ bt_chan_data_t* Raspi3BluetoothQ::get_channel_data(int channel)
 int Raspi3BluetoothQ::send_data_client(int channel, char *data, int len)
 {
 	int i, result = _BT_RESULT_OK;
+	bt_queue_record_t *tx_record;
+	uint32_t position;
 
 	if ((channel < 0) || (channel >= _NUMBER_OF_BT_CONNECTIONS))
 	{
@@ -425,20 +428,26 @@ int Raspi3BluetoothQ::send_data_client(int channel, char *data, int len)
 	}
 	else
 	{
-		// Put data into the Tx queue
-		// Allocate channel data structure. Don't forget to relase when poping out of Q.
-		tx_channel_data = new bt_chan_data();
-		tx_channel_data->channel_id = bt_channels_data[channel].channel_id;
-		tx_channel_data->client_id = bt_channels_data[channel].client_id;
-		tx_channel_data->rem_addr = bt_channels_data[channel].rem_addr;
-		// Copy data
-		tx_channel_data->message->mssg_len = len;
-		for (i = 0; i < len; i++)
+		// Put data into the channel Tx ring
+		tx_record = bt_tx_queue[channel].get_write_slot(&position);
+		if (tx_record == NULL)
 		{
-			tx_channel_data->message->data[i] = *(data + i);
+			result = _BT_RESULT_TX_QUEUE_FULL;
+		}
+		else
+		{
+			tx_record->channel_id = bt_channels_data[channel].channel_id;
+			tx_record->client_id = bt_channels_data[channel].client_id;
+			tx_record->rem_addr = bt_channels_data[channel].rem_addr;
+			// Copy data
+			tx_record->message.mssg_len = len;
+			for (i = 0; i < len; i++)
+			{
+				tx_record->message.data[i] = *(data + i);
+			}
+			// Publish
+			bt_tx_queue[channel].commit_write_slot(position);
 		}
-		// Push into queue
-		bt_tx_queue.enqueue(tx_channel_data);
 	}
 
 	return result;
@@ -598,11 +607,10 @@ void *Raspi3BluetoothQ::bt_main_thread(void *threadid)
 */
 void *Raspi3BluetoothQ::connected_thread(void *threadid)
 {
-	bool loop = true, timeout;
+	bool loop = true;
 	int bytes_read, i, rc, on = 1, err = 1;
-	bt_chan_data_t *tx_channel;
-	bt_chan_data_t *rx_channel_alsa, *rx_channel_raw;
-	char data[_NUM_OF_RX_BYTES];
+	bt_queue_record_t *tx_record;
+	bt_queue_record_t rx_record;
 
 	// Get thread id = channel
 	int tid = (int)threadid;
@@ -627,13 +635,13 @@ void *Raspi3BluetoothQ::connected_thread(void *threadid)
 	while ((connected_thread_is_running[tid]) && loop)
 	{
 		// Wait for a new Tx message or a timeout of 5msec.
-		tx_channel = bt_tx_queue.dequeue(5, &timeout);
-		if (!timeout)
+		if (bt_tx_queue[tid].wait_for_data(5))
 		{
-			// Exit not on timeout - New tx data is available - send it
+			// New tx data is available - send it
+			tx_record = bt_tx_queue[tid].get_read_slot();
 			rc = send(bt_channels_data[tid].client_id,
-				tx_channel->message->data,
-				tx_channel->message->mssg_len, 0);
+				tx_record->message.data,
+				tx_record->message.mssg_len, 0);
 			err = errno;
 			if (rc < 0)
 			{
@@ -641,45 +649,26 @@ void *Raspi3BluetoothQ::connected_thread(void *threadid)
 				fprintf(stderr, "BT connected thread: send() failed");
 				// TODO
 			}
-			delete tx_channel;
+			bt_tx_queue[tid].release_read_slot();
 		}		
 
 		// read data from the client
-		bytes_read = read(bt_channels_data[tid].client_id, data, sizeof(data));
+		bytes_read = read(bt_channels_data[tid].client_id, rx_record.message.data, sizeof(rx_record.message.data));
 		err = errno;
 		if (bytes_read > 0)
 		{
-			// New data received - Create a new channel object (Don't forget to free after processing!!!)
-			rx_channel_alsa = new bt_chan_data_t;
-			rx_channel_alsa->channel_id = bt_channels_data[tid].channel_id; // = tid!!!???
-			rx_channel_alsa->client_id = bt_channels_data[tid].client_id;
-			rx_channel_alsa->rem_addr = bt_channels_data[tid].rem_addr;
-			rx_channel_alsa->message->mssg_len = bytes_read;
-			// Copy received data
-			for(i = 0 ; i < bytes_read ; i++)
-			{
-				rx_channel_alsa->message->data[i] = data[i];
-			}
-			// Push into ALSA queue
-			bt_rx_queue_alsa.enqueue(rx_channel_alsa);
-			// New data received - Create a new channel object (Don't forget to free after processing!!!)
-			rx_channel_raw = new bt_chan_data_t;
-			rx_channel_raw->channel_id = bt_channels_data[tid].channel_id;
-			rx_channel_raw->client_id = bt_channels_data[tid].client_id;
-			rx_channel_raw->rem_addr = bt_channels_data[tid].rem_addr;
-			rx_channel_raw->message->mssg_len = bytes_read;
-			// Copy received data
-			for(i = 0 ; i < bytes_read ; i++)
-			{
-				rx_channel_raw->message->data[i] = data[i];
-			}
-			// Push into ALSA queue
-			bt_rx_queue_alsa.enqueue(rx_channel_raw);
+			// New data received
+			rx_record.channel_id = bt_channels_data[tid].channel_id; // = tid!!!???
+			rx_record.client_id = bt_channels_data[tid].client_id;
+			rx_record.rem_addr = bt_channels_data[tid].rem_addr;
+			rx_record.message.mssg_len = bytes_read;
+			// Push into the ALSA ring (dropped if full)
+			bt_rx_queue_alsa.push(rx_record);
 
 			printf("BT connected thread: ch%i:  ", tid);
 			for (i = 0; i < bytes_read; i++)
 			{
-				printf("%x ", rx_channel_alsa->message->data[i]);
+				printf("%x ", rx_record.message.data[i]);
 			}
 			printf("\n");
 		}
@@ -1,8 +1,12 @@
 /**
 * @file		rspiBluetoothServicesQueuesVer.h
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.2
+*	@date		17-Oct-2026
+*	@version	1.3
+*					1. Data is transferred through preallocated lock-free rings of fixed-size
+*					   records instead of SafeQueue (no allocations); a tx ring per channel.
+*
+*	@version	1.2		6-Feb-2021
 *					1. Code refactoring and notaion.
 *
 *	@brief		Bluetooth thered using thread-safe message queues for transferring data.
@@ -25,7 +29,7 @@
 #include <bluetooth/hci_lib.h>
 #include <bluetooth/rfcomm.h>
 
-#include "../utils/safeQueues.h"
+#include "../utils/lockFreeRings.h"
 
 /* Defines the max number of simultaneous RFCOMM connections */
 #define _NUMBER_OF_BT_CONNECTIONS	4//5
@@ -40,6 +44,10 @@ Error must be smaller than 8
 /* Defines the number of bytes in transmit buffer */
 #define _NUM_OF_TX_BYTES	_NUM_OF_RX_BYTES
 
+/* Number of records in each data ring (must be a power of 2) */
+#define _BT_RX_RING_SIZE	64
+#define _BT_TX_RING_SIZE	16
+
 #define _BT_CHAN_0							0
 #define _BT_CHAN_1							1
 #define _BT_CHAN_2							2
@@ -54,6 +62,7 @@ Error must be smaller than 8
 #define _BT_RESULT_CHANNEL_NOT_CONNECTED	-5
 #define _BT_RESULT_TX_MSSG_TOO_LONG			-6
 #define _BT_RESULT_TX_NO_DATA				-7
+#define _BT_RESULT_TX_QUEUE_FULL			-8
 
 #define _BT_RESULT_CHANNEL_IS_FREE			true
 #define _BT_RESULT_CHANNEL_IS_USED			false
@@ -93,6 +102,22 @@ typedef struct bt_chan_data
 	bt_data_t *message;
 } bt_chan_data_t;
 
+/* A structure used for transferring a channel data message through the data rings */
+typedef struct bt_queue_record
+{
+	bt_queue_record() : channel_id(-1), client_id(-1) {}
+	
+	int channel_id;
+	int client_id;
+	sockaddr_rc rem_addr;
+	bt_data_t message;
+} bt_queue_record_t;
+
+/* Rx: written by all the connected threads */
+typedef MpscRing<bt_queue_record_t, _BT_RX_RING_SIZE> bt_rx_ring_t;
+/* Tx: written by any sending thread, read by the channel connected thread */
+typedef MpscRing<bt_queue_record_t, _BT_TX_RING_SIZE> bt_tx_ring_t;
+
 
 class Raspi3BluetoothQ
 {
@@ -111,12 +136,10 @@ public:
 
 	static int send_data_client(int channel, char *data, int len);
 
-	/* A queue used to send the incoming BT data as ALSA midi events */
-	static SafeQueue<bt_chan_data_t*> bt_rx_queue_alsa;
-	/* A queue used to send the incoming BT data raw data */
-	static SafeQueue<bt_chan_data_t*> bt_rx_queue_raw;
-	/* A queue to hold Tx data */
-	static SafeQueue<bt_chan_data_t*> bt_tx_queue;
+	/* A ring used to send the incoming BT data as ALSA midi events */
+	static bt_rx_ring_t bt_rx_queue_alsa;
+	/* Rings to hold each channel Tx data */
+	static bt_tx_ring_t bt_tx_queue[_NUMBER_OF_BT_CONNECTIONS];
 
 private:
 	
@@ -106,3 +106,20 @@ float DSP_Distortion::get_next_output_val(float in)
 
 	return output;
 }
+
+/**
+*	@brief	Process a block of samples in place
+*	@param	buf	a pointer to a buffer of n samples
+*	@param	n	number of samples
+*	@return void
+*/
+void DSP_Distortion::process_block(float *buf, int n)
+{
+	float amp = drive * range;
+	float gain = (auto_gain && (amp > 4.f)) ? 0.25f : 1.f;
+	
+	for (int i = 0; i < n; i++)
+	{
+		buf[i] = ((((2.f / M_PI) * atan(buf[i] * amp)) * blend) + (buf[i] * (1.f - blend))) * gain;
+	}
+}
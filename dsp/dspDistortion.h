@@ -24,6 +24,7 @@ public:
 	void set_range(float rng);
 	void set_blend(float bln);
 	float get_next_output_val(float in);
+	void process_block(float *buf, int n);
 	void enable_auto_gain() { auto_gain = true; }	
 	void disable_auto_gain() { auto_gain = false; }
 
@@ -50,6 +50,7 @@ void DSP_Filter::clear()
 	state_input_prev = 0.0f;
 	state_lowpass = 0.0f;
 	state_bandpass = 0.0f;
+	state_fmult = -1.0f;
 }
 
 /**
@@ -225,7 +226,7 @@ float DSP_Filter::filter_output(float input, float fmod)
 	int i;	
 	float input_prev;
 	float lowpass, bandpass, highpass;
-	float lowpass_tmp, bandpasstmp, highpass_tmp;
+	float lowpass_tmp, bandpass_tmp, highpass_tmp;
 	float fmult, damp, modulate, out;
 
 	if (filter_band == _FILTER_BAND_PASS_ALL)
@@ -233,13 +234,14 @@ float DSP_Filter::filter_output(float input, float fmod)
 		return input;
 	}
 
-	modulate = setting_fmult * pow(2.0, (double)(setting_octave_mult + fmod));
+	modulate = setting_fmult * fast_exp2f(setting_octave_mult + fmod);
 	
 	fmult = modulate + setting_kbd_fmult;
 	if (fmult > max_setting_fmult)
 	{
 		fmult = max_setting_fmult;
 	}
+	state_fmult = fmult;
 
 	
 	// TODO: fmult(mod)
@@ -274,7 +276,7 @@ float DSP_Filter::filter_output(float input, float fmod)
 		break;
 					
 	case _FILTER_BAND_BPF:
-		out = bandpasstmp;
+		out = bandpass_tmp;
 		break;
 	}
 		
@@ -285,6 +287,86 @@ float DSP_Filter::filter_output(float input, float fmod)
 	return out;
 }
 
+/**
+*	@brief	Filter a block of samples in place.
+*			The modulated corner frequency is calculated once for the whole block
+*			(control sub-block); the frequency multiplier is linearly ramped from
+*			the previous block value to avoid zipper noise.
+*	@param	buf a pointer to a buffer of n input samples that will hold the output samples
+*	@param	n	number of samples
+*	@param	fmod frequency modulation factor (same as filter_output())
+*	@return void
+*/
+void DSP_Filter::filter_output_block(float *buf, int n, float fmod)
+{
+	float input, input_prev;
+	float lowpass, bandpass, highpass;
+	float lowpass_tmp, bandpass_tmp, highpass_tmp;
+	float fmult, fmult_target, fmult_step, damp;
+
+	if ((filter_band == _FILTER_BAND_PASS_ALL) || (n <= 0))
+	{
+		return;
+	}
+
+	fmult_target = setting_fmult * fast_exp2f(setting_octave_mult + fmod) + setting_kbd_fmult;
+	if (fmult_target > max_setting_fmult)
+	{
+		fmult_target = max_setting_fmult;
+	}
+	
+	if (state_fmult < 0.0f)
+	{
+		// First block - no ramp
+		state_fmult = fmult_target;
+	}
+	
+	fmult_step = (fmult_target - state_fmult) / (float)n;
+	fmult = state_fmult;
+	
+	damp = setting_damp;
+	input_prev = state_input_prev;
+	lowpass = state_lowpass;
+	bandpass = state_bandpass;
+	
+	for (int i = 0; i < n; i++)
+	{
+		input = buf[i];
+		fmult += fmult_step;
+		
+		lowpass = lowpass + fmult * bandpass;
+		highpass = ((input + input_prev) / 2.0f) - lowpass - damp * bandpass;
+		input_prev = input;
+		bandpass = bandpass + fmult * highpass;
+		lowpass_tmp = lowpass;
+		bandpass_tmp = bandpass;
+		highpass_tmp = highpass;
+		lowpass = lowpass + fmult * bandpass;
+		highpass = input - lowpass - damp * bandpass;
+		bandpass = bandpass + fmult * highpass;
+		
+		switch (filter_band)
+		{				
+		case _FILTER_BAND_LPF:
+			buf[i] = lowpass + lowpass_tmp;
+			break;
+					
+		case _FILTER_BAND_HPF:
+			buf[i] = highpass + highpass_tmp;
+			break;
+					
+		case _FILTER_BAND_BPF:
+			buf[i] = bandpass + bandpass_tmp;
+			break;
+		}
+	}
+	
+	state_input_prev = input_prev;
+	state_lowpass = lowpass;
+	state_bandpass = bandpass;
+	state_fmult = fmult_target;
+}
+
 /**
 *	@brief	Sets fliter sample-rate
 *	@param	sample  rate: _SAMPLE_RATE_44 (44100Hz) or _SAMPLE_RATE_48 (48000Hz)
@@ -44,6 +44,7 @@ public:
 	float get_filter_max_center_frequency();
 	
 	float filter_output(float input, float fmod = 1.0f);
+	void filter_output_block(float *buf, int n, float fmod = 1.0f);
 	
 	
 private:
@@ -59,6 +60,9 @@ private:
 	float state_lowpass;
 	float state_highpass;
 	float state_bandpass;
+	// Corner frequency multiplier applied at the last processed sample
+	// (filter_output_block() ramps from it); negative - no ramp
+	float state_fmult;
 	float setting_kbd_fcenter;
 	float setting_kbd_fmult;
 	float kbd_track;
@@ -20,8 +20,6 @@
 #include "../commonDefs.h"
 #include "../utils/utils.h"
 
-uint16_t DSP_KarplusStrong::instance_count = 0;
-
 /**
 *	@brief	Creates a Karplus Strong generator instance
 *	@param	voice unique id number
@@ -35,8 +33,8 @@ DSP_KarplusStrong::DSP_KarplusStrong(int Voice, int samp_rate)
 	
 	voice = Voice;
 	
-	seed = 1 + instance_count++;
-	srand(seed);
+	prng.set_stream((uint32_t)voice);
+	reset_filters_states();
 	excitation_waveform_type = _KARPLUS_STRONG_EXCITATION_WHITE_NOISE;
 	string_dumping_calculation_mode = _KARPLUS_STRONG_STRING_DAMPING_CALC_DIRECT;
 	state = _KARPLUS_STRONG_STATE_STEADY_OUTPUT;
@@ -515,6 +513,8 @@ void DSP_KarplusStrong::note_on(int notenum, float velocity)
 	buffer_index = 0;	
 	active_decay = on_decay;
 	
+	// A new pluck does not depend on the previous notes
+	reset_filters_states();
 	init_excitation_samples();
 	state = _KARPLUS_STRONG_STATE_STEADY_BEGIN_NEXT;
 }	
@@ -547,7 +547,7 @@ int DSP_KarplusStrong::get_buffer_max_size()
 */
 float DSP_KarplusStrong::get_next_white_noise_val()
 {
-	return (float)rand() / (float)RAND_MAX * 1.95 - 1.0;
+	return prng.next_unipolar() * 1.95f - 1.0f;
 }
 
 /**
@@ -559,27 +559,19 @@ float DSP_KarplusStrong::get_next_pink_noise_val()
 {
 	float out;
 
-	static float b0 = 0;
-	static float b1 = 0;
-	static float b2 = 0;
-	static float b3 = 0;
-	static float b4 = 0;
-	static float b5 = 0;
-	static float b6 = 0;
-
 	float white = get_next_white_noise_val();
 
-	b0 = 0.99886 * b0 + white * 0.0555179;
-	b1 = 0.99332 * b1 + white * 0.0750759;
-	b2 = 0.96900 * b2 + white * 0.1538520;
-	b3 = 0.86650 * b3 + white * 0.3104856;
-	b4 = 0.55000 * b4 + white * 0.5329522;
-	b5 = -0.7616 * b5 - white * 0.0168980;
+	pink_b[0] = 0.99886 * pink_b[0] + white * 0.0555179;
+	pink_b[1] = 0.99332 * pink_b[1] + white * 0.0750759;
+	pink_b[2] = 0.96900 * pink_b[2] + white * 0.1538520;
+	pink_b[3] = 0.86650 * pink_b[3] + white * 0.3104856;
+	pink_b[4] = 0.55000 * pink_b[4] + white * 0.5329522;
+	pink_b[5] = -0.7616 * pink_b[5] - white * 0.0168980;
 
-	out =  b0 + b1 + b2 + b3 + b4 + b5 + b6 + white * 0.5362;
+	out =  pink_b[0] + pink_b[1] + pink_b[2] + pink_b[3] + pink_b[4] + pink_b[5] + pink_b[6] + white * 0.5362;
 	out *= 0.2;  //0.11;     // (roughly) compensate for gain
 
-	b6 = white * 0.115926;
+	pink_b[6] = white * 0.115926;
 
 	return out;
 }
@@ -592,11 +584,10 @@ float DSP_KarplusStrong::get_next_pink_noise_val()
 float DSP_KarplusStrong::get_next_brown_noise_val()
 {
 	float out;
-	static float lastOut = 0.0f;	
 	float white = get_next_white_noise_val();
 
-	out = (lastOut + (0.02 * white)) / 1.02;
-	lastOut = out;
+	out = (brown_last_out + (0.02 * white)) / 1.02;
+	brown_last_out = out;
 	out *= 5.5; //3.5;     // (roughly) compensate for gain
 
 	return out;
@@ -751,7 +742,7 @@ float DSP_KarplusStrong::calc_pluck_damping_coefficient()
 	pluck_damping_variation_difference =
 	    pluck_damping_variation_max - pluck_damping_variation_min;
 	pluck_damping_coefficient =
-	    pluck_damping_variation_min + ((float)rand() / (float)RAND_MAX) * pluck_damping_variation_difference;
+	    pluck_damping_variation_min + prng.next_unipolar() * pluck_damping_variation_difference;
 
 	return pluck_damping_coefficient;
 }
@@ -772,7 +763,7 @@ float DSP_KarplusStrong::calc_lpf_smoothing_factor(int noteNum)
 		// this is copied verbatim from the flash one
 		// is magical, don't know how it works
 		lpf_smoothing_factor = string_damping + pow(noteNum / 44.0, 0.5) * (1 - string_damping) * 0.5 +
-		    (1 - string_damping) * (float)rand() / (float)RAND_MAX * string_damping_variation;
+		    (1 - string_damping) * prng.next_unipolar() * string_damping_variation;
 	}
 
 	return lpf_smoothing_factor;
@@ -838,6 +829,39 @@ float DSP_KarplusStrong::get_next_output_value()
 	return out * 4.f;	
 }
 
+/**
+*	@brief	Generate a block of output samples
+*	@param	out	a pointer to an output buffer of at least n samples
+*	@param	n	number of samples to generate
+*	@return none
+*/
+void DSP_KarplusStrong::get_next_output_block(float *out, int n)
+{
+	float in, samp;
+	float prior = prior_samp;
+	float nrg = energy;
+	int index = buffer_index;
+	
+	for (int i = 0; i < n; i++)
+	{
+		in = buffer[index];
+		samp = low_pass(prior, in, lpf_smoothing_factor);
+		buffer[index] = samp * active_decay;
+		if (++index >= buffer_len)
+		{
+			index = 0;
+		}
+
+		prior = in;
+		nrg = 0.999f * nrg + 0.001f * samp * samp;
+		out[i] = samp * 4.f;
+	}
+	
+	prior_samp = prior;
+	energy = nrg;
+	buffer_index = index;
+}
+
 /**
 *	@brief	Resonate
 *	@param	none
@@ -850,43 +874,57 @@ void DSP_KarplusStrong::resonate()
 	const float r0 = 0.98;
 	const float r1 = 0.98;
 	
-	static float r00 = 0.0;
-	static float f00 = 0.0;
-	static float r10 = 0.0;
-	static float f10 = 0.0;
-	static float f0 = 0.0;
-	static float resonated_sample = 0.0;
-	static float resonated_sample_post_high_pass = 0.0;
+	float resonated_sample;
+	float resonated_sample_post_high_pass;
 	// by making the smoothing factor large, we make the cutoff
 	// frequency very low, acting as just an offset remover
 	const float highPassSmoothingFactor = 0.97;
-	static float lastOutput = 0.0;
-	static float lastInput = 0.0;
 	
-	r00 *= r0;
-	r00 += (f0 - f00) * c0;
-	f00 += r00;
-	f00 -= f00 * f00 * f00 * 0.166666666666666;
-	r10 *= r1;
-	r10 += (f0 - f10) * c1;
-	f10 += r10;
-	f10 -= f10 * f10 * f10 * 0.166666666666666;
-	f0 = buffer[buffer_index];
-	resonated_sample = f0 + (f00 + f10) * 2.0;
+	resonate_r00 *= r0;
+	resonate_r00 += (resonate_f0 - resonate_f00) * c0;
+	resonate_f00 += resonate_r00;
+	resonate_f00 -= resonate_f00 * resonate_f00 * resonate_f00 * 0.166666666666666;
+	resonate_r10 *= r1;
+	resonate_r10 += (resonate_f0 - resonate_f10) * c1;
+	resonate_f10 += resonate_r10;
+	resonate_f10 -= resonate_f10 * resonate_f10 * resonate_f10 * 0.166666666666666;
+	resonate_f0 = buffer[buffer_index];
+	resonated_sample = resonate_f0 + (resonate_f00 + resonate_f10) * 2.0;
 
 	// I'm not sure why, but the resonating process plays
 	// havok with the DC offset - it jumps around everywhere.
 	// We put it back to zero DC offset by adding a high-pass
 	// filter with a super low cutoff frequency.
 	resonated_sample_post_high_pass = resonated_sample; //highPass(
-	//	    lastOutput,
-	//		lastInput,
+	//	    resonate_last_output,
+	//		resonate_last_input,
 	//		resonatedSample,
 	//		highPassSmoothingFactor);
 		buffer[buffer_index] = resonated_sample_post_high_pass;
 
-	lastOutput = resonated_sample_post_high_pass;
-	lastInput = resonated_sample;
+	resonate_last_output = resonated_sample_post_high_pass;
+	resonate_last_input = resonated_sample;
+}
+
+/**
+*	@brief	Reset the excitation noise filters and the resonator states
+*	@param	none
+*	@return none
+*/
+void DSP_KarplusStrong::reset_filters_states()
+{
+	for (int i = 0; i < 7; i++)
+	{
+		pink_b[i] = 0.0f;
+	}
+	brown_last_out = 0.0f;
+	resonate_r00 = 0.0f;
+	resonate_f00 = 0.0f;
+	resonate_r10 = 0.0f;
+	resonate_f10 = 0.0f;
+	resonate_f0 = 0.0f;
+	resonate_last_output = 0.0f;
+	resonate_last_input = 0.0f;
 }
 
 /**
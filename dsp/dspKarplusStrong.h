@@ -18,6 +18,7 @@
 
 #include <stdint.h>
 
+#include "dspPrng.h"
 #include "../libAdjHeartModSynth_2.h"
 	
 #define _KARPLUS_STRONG_STATE_STEADY_OUTPUT				0
@@ -102,6 +103,7 @@ public:
 	void init_excitation_samples();
 	
 	float get_next_output_value();
+	void get_next_output_block(float *out, int n);
 	float get_energy();	
 	
 	
@@ -123,6 +125,7 @@ private:
 	float get_next_excitation_val(int pos);
 	
 	void resonate();
+	void reset_filters_states();
 	
 	float low_pass(float last_output, float current_input, float smoothing_factor);
 	float high_pass(float last_output, float last_iInput, float current_input, float smoothing_factor);
@@ -157,8 +160,14 @@ private:
 	
 	float energy;
 	
-	uint32_t seed;     // must start at 1
-	static uint16_t instance_count;
+	// Per generator random numbers (voices are rendered in parallel)
+	DSP_Prng prng;
+	// Pink and brown noise excitation filters states
+	float pink_b[7];
+	float brown_last_out;
+	// Resonator states
+	float resonate_r00, resonate_f00, resonate_r10, resonate_f10, resonate_f0;
+	float resonate_last_output, resonate_last_input;
 	float *buffer;
 	
 	int sample_rate;
@@ -129,6 +129,18 @@ int DSP_MorphingSinusOscWTAB::init_waveform_tables(int samp_rate)
 	return 0;
 }
 
+/**
+*	@brief	Switch to a new (already calculated) morphed waveform table.
+*			The replaced table may still be played until the next audio cycles,
+*			so it is returned to the caller to be freed later.
+*	@param	wtab	a pointer to the new morphed waveform table
+*	@return a pointer to the replaced morphed waveform table
+*/
+DSP_WaveformTab *DSP_MorphingSinusOscWTAB::publish_morphed_waveform_tab(DSP_WaveformTab *wtab)
+{
+	return __atomic_exchange_n(&morphed_waveform_tab, wtab, __ATOMIC_ACQ_REL);
+}
+
 /**
 *	@brief	Set a segment position
 *	@param	pos (enPositions) which position
@@ -514,6 +526,19 @@ DSP_MorphingSinusOsc::DSP_MorphingSinusOsc(
 	wtab = lutptr;
 }
 
+/**
+*	@brief	Sets the DSP_MorphingSinusOscWTAB wavetable object (e.g. when a voice is bound to another program).
+*	@param	wtab_ptr	a pointer to a DSP_MorphingSinusOscWTAB wavetable object
+*	@return void
+*/
+void DSP_MorphingSinusOsc::set_wavetable(DSP_MorphingSinusOscWTAB *wtab_ptr)
+{
+	if (wtab_ptr)
+	{
+		wtab = wtab_ptr;
+	}
+}
+
 /**
 *	@brief	Returns a pointer to the DSP_MorphingSinusOscWTAB wavetable object.
 *	@param	none
@@ -533,32 +558,61 @@ DSP_MorphingSinusOscWTAB *DSP_MorphingSinusOsc::get_wavetable()
 float DSP_MorphingSinusOsc::get_next_mso_wtab_val(float freq, int offset)
 {
 	float ofst_index, val;
+	// The morphed table may be replaced by the PAD generator
+	DSP_WaveformTab *morphed_tab = __atomic_load_n(&wtab->morphed_waveform_tab, __ATOMIC_ACQUIRE);
 	
 	wtab_index += freq  / wtab->get_fundemental_frequency();
 	// Wrap
-	while((int)wtab_index >= wtab->morphed_waveform_tab->get_wtab_length()) 
+	while((int)wtab_index >= morphed_tab->get_wtab_length()) 
 	{
-		wtab_index -= wtab->morphed_waveform_tab->get_wtab_length();
+		wtab_index -= morphed_tab->get_wtab_length();
 	}
 
 	if (offset > 0)
 	{
 		ofst_index = wtab_index + (float)offset;
 		// Wrap
-		while((int)ofst_index >= wtab->morphed_waveform_tab->get_wtab_length()) 
+		while((int)ofst_index >= morphed_tab->get_wtab_length()) 
 		{
-			ofst_index -= wtab->morphed_waveform_tab->get_wtab_length();
+			ofst_index -= morphed_tab->get_wtab_length();
 		}
-		val = wtab->morphed_waveform_tab->get_wtab_val((int)ofst_index);
+		val = morphed_tab->get_wtab_val((int)ofst_index);
 	}
 	else
 	{
-		val = wtab->morphed_waveform_tab->get_wtab_val((int)wtab_index);
+		val = morphed_tab->get_wtab_val((int)wtab_index);
 	}	
 
 	return val * magnitude;
 }
 
+/**
+*	@brief	Generate a block of MSO LUT samples at a fixed frequency
+*	@param	out		a pointer to an output buffer of at least n samples
+*	@param	n		number of samples to generate
+*	@param	freq	MSO frequency (Hz)
+*	@return void
+*/
+void DSP_MorphingSinusOsc::get_next_mso_wtab_block(float *out, int n, float freq)
+{
+	float step = freq / wtab->get_fundemental_frequency();
+	// The morphed table may be replaced by the PAD generator
+	DSP_WaveformTab *morphed_tab = __atomic_load_n(&wtab->morphed_waveform_tab, __ATOMIC_ACQUIRE);
+	int length = morphed_tab->get_wtab_length();
+	
+	for (int i = 0; i < n; i++)
+	{
+		wtab_index += step;
+		// Wrap
+		while ((int)wtab_index >= length) 
+		{
+			wtab_index -= length;
+		}
+		
+		out[i] = morphed_tab->get_wtab_val((int)wtab_index) * magnitude;
+	}
+}
+
 /**
 *	@brief	Return MSO id number
 *	@param	none
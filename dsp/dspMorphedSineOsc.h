@@ -104,8 +104,9 @@ public:
 	int get_morphing_symetry();
 	void calc_segments_lengths(st_segments_length *seglens, st_positions *positions);
 	int calc_wtab(DSP_WaveformTab *wtab, st_segments_length *seglens, st_positions *position);
+	DSP_WaveformTab *publish_morphed_waveform_tab(DSP_WaveformTab *wtab);
 
-	// Waveform tables
+	// Waveform tables (the morphed table is replaced by publish_morphed_waveform_tab())
 	DSP_WaveformTab *base_waveform_tab, *morphed_waveform_tab;
 	// Holds the position of each segment of the base waveform
 	st_positions base_segment_positions;
@@ -150,6 +151,7 @@ friend class SynthVoice;
 		float mag = 1.0f);
 
 	float get_next_mso_wtab_val(float freq, int offset = 0);
+	void get_next_mso_wtab_block(float *out, int n, float freq);
 
 	int get_id();
 
@@ -181,6 +183,7 @@ friend class SynthVoice;
 	float get_send_level_1();
 	float get_send_level_2();
 	
+	void set_wavetable(DSP_MorphingSinusOscWTAB *wtab_ptr);
 	DSP_MorphingSinusOscWTAB *get_wavetable();
 
 private:
@@ -12,13 +12,9 @@
 *	// https://noisehack.com/generate-noise-web-audio-api/	
 */
 
-#include <stdlib.h> // srand
-
 #include "dspNoise.h"
 #include "../libAdjHeartModSynth_2.h"
 
-uint16_t DSP_Noise::instance_count = 0;
-
 /**
 *	@brief	Creates a noise generator object instance
 *	@param id unique noise generator id number
@@ -28,9 +24,13 @@ DSP_Noise::DSP_Noise(int Voice)
 {
 	voice = Voice;
 	level = 0.0f;	
-	seed = 1 + instance_count++;
-	srand(seed);
+	prng.set_stream((uint32_t)voice);
 	noise_type = _WHITE_NOISE;
+	for (int i = 0; i < 7; i++)
+	{
+		pink_b[i] = 0.0f;
+	}
+	brown_last_out = 0.0f;
 }
 
 /**
@@ -91,7 +91,7 @@ int DSP_Noise::get_noise_type() { return noise_type; }
 */
 float DSP_Noise::get_next_white_noise_val()
 {
-	return (float)rand() / (float)RAND_MAX * 2.0 - 1.0;
+	return prng.next_bipolar();
 }
 
 /**
@@ -103,27 +103,19 @@ float DSP_Noise::get_next_pink_noise_val()
 {
 	float out;
 	
-	static float b0 = 0;
-	static float b1 = 0;
-	static float b2 = 0;
-	static float b3 = 0;
-	static float b4 = 0;
-	static float b5 = 0;
-	static float b6 = 0;
-	
 	float white = get_next_white_noise_val();
 	
-	b0 = 0.99886 * b0 + white * 0.0555179;
-	b1 = 0.99332 * b1 + white * 0.0750759;
-	b2 = 0.96900 * b2 + white * 0.1538520;
-	b3 = 0.86650 * b3 + white * 0.3104856;
-	b4 = 0.55000 * b4 + white * 0.5329522;
-	b5 = -0.7616 * b5 - white * 0.0168980;
+	pink_b[0] = 0.99886 * pink_b[0] + white * 0.0555179;
+	pink_b[1] = 0.99332 * pink_b[1] + white * 0.0750759;
+	pink_b[2] = 0.96900 * pink_b[2] + white * 0.1538520;
+	pink_b[3] = 0.86650 * pink_b[3] + white * 0.3104856;
+	pink_b[4] = 0.55000 * pink_b[4] + white * 0.5329522;
+	pink_b[5] = -0.7616 * pink_b[5] - white * 0.0168980;
 	
-	out =  b0 + b1 + b2 + b3 + b4 + b5 + b6 + white * 0.5362;
+	out =  pink_b[0] + pink_b[1] + pink_b[2] + pink_b[3] + pink_b[4] + pink_b[5] + pink_b[6] + white * 0.5362;
 	out *= 0.11;   // (roughly) compensate for gain
 	
-	b6 = white * 0.115926;
+	pink_b[6] = white * 0.115926;
 	
 	return out;
 }
@@ -136,11 +128,10 @@ float DSP_Noise::get_next_pink_noise_val()
 float DSP_Noise::get_next_brown_noise_val()
 {
 	float out;
-	static float lastOut = 0.0f;	
 	float white = get_next_white_noise_val();
 	
-	out = (lastOut + (0.02 * white)) / 1.02;
-	lastOut = out;
+	out = (brown_last_out + (0.02 * white)) / 1.02;
+	brown_last_out = out;
 	out *= 3.5;   // (roughly) compensate for gain
 	
 	return out;
@@ -172,3 +163,42 @@ float DSP_Noise::get_next_noise_val()
 	
 	return val * level;
 }
+
+/**
+*	@brief	Generate a block of noise generator output samples
+*	@param	out	a pointer to an output buffer of at least n samples
+*	@param	n	number of samples to generate
+*	@return void
+*/
+void DSP_Noise::get_next_noise_block(float *out, int n)
+{
+	int i;
+	
+	switch (noise_type)
+	{		
+		case _WHITE_NOISE:
+			prng.fill_bipolar(out, n, level);
+			break;
+				
+		case _PINK_NOISE:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = get_next_pink_noise_val() * level;
+			}
+			break;
+				
+		case _BROWN_NOISE:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = get_next_brown_noise_val() * level;
+			}
+			break;
+			
+		default:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = 0.0f;
+			}
+			break;
+	}
+}
@@ -17,6 +17,8 @@
 
 #include <stdint.h>
 
+#include "dspPrng.h"
+
 class DSP_Noise
 {
 public:
@@ -31,13 +33,17 @@ public:
 	float get_next_pink_noise_val();
 	float get_next_brown_noise_val();
 	float get_next_noise_val();
+	void get_next_noise_block(float *out, int n);
 	
 private:
 	int voice;
 	float level;
-	uint32_t seed;    // must start at 1
-	static uint16_t instance_count;
 	int noise_type;
+	// Per generator random numbers (voices are rendered in parallel)
+	DSP_Prng prng;
+	// Pink and brown noise filters states
+	float pink_b[7];
+	float brown_last_out;
 };
 
 #endif
@@ -65,7 +65,7 @@ DSP_Osc::DSP_Osc(int iD,
 	sine_wave = new DSP_SineWaveGenerator(sample_rate, audio_block_size);
 	triangle_wave = new DSP_TriangleWaveGenerator(sample_rate, (float)pwmDc / 100.0f);
 	square_wave = new DSP_SquareWaveGenerator(sample_rate, (float)pwmDc / 100.0f);
-	sample_hold_wave = new DSP_SampleHoldWaveGenerator(sample_rate);
+	sample_hold_wave = new DSP_SampleHoldWaveGenerator(sample_rate, iD);
 	
 	id = iD;
 	res = set_waveform(form);
@@ -493,6 +493,57 @@ float DSP_Osc::get_next_output_val(float freq)
 	return val * magnitude;
 }
 
+/**
+*	@brief	Generate a block of output samples at a fixed frequency
+*			(the waveform is selected once per block, not per sample).
+*	@param	out		a pointer to an output buffer of at least n samples
+*	@param	n		number of samples to generate
+*	@param	freq	output frequency
+*	@return void
+*/
+void DSP_Osc::get_next_output_block(float *out, int n, float freq)
+{
+	int i;
+	
+	switch (waveform) {		
+		case _OSC_WAVEFORM_SQUARE:					
+		case _OSC_WAVEFORM_PULSE:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = square_wave->get_next_square_gen_out_val(freq) * magnitude;
+			}
+			break;
+					
+		case _OSC_WAVEFORM_TRIANGLE:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = triangle_wave->get_next_triangle_gen_out_val(freq) * magnitude;
+			}
+			break;
+						
+		case _OSC_WAVEFORM_SINE:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = sine_wave->get_next_sine_wtab_val(freq) * magnitude;
+			}
+			break;
+			
+		case _OSC_WAVEFORM_SAMPHOLD:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = sample_hold_wave->get_next_sample_hold_gen_out_val(freq) * magnitude;
+			}
+			break;
+			
+		default:
+			for (i = 0; i < n; i++)
+			{
+				out[i] = 0.0f;
+			}
+			break;
+	}
+}
+
 /**
 *	@brief Force a Sync (on a higher pitch Osc) by reseting the phase of the Osc
 *		(usually by a lower pitch Osc)
@@ -78,6 +78,7 @@ public:
 	bool get_track_state();
 	
 	float get_next_output_val(float freq);
+	void get_next_output_block(float *out, int n, float freq);
 	
 	float set_harmonies_detune(float det);
 	float set_harmonies_detune(int det);
@@ -0,0 +1,132 @@
+/**
+*	@file		dspPrng.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Per generator pseudo random numbers generator (PCG32).
+*				http://www.pcg-random.org - XSH RR output function.
+*				A generator is re-seeded (lazily, on its next use) whenever the
+*				global seed is set or all generators are restarted.
+*/
+
+#include "dspPrng.h"
+
+uint32_t DSP_Prng::global_seed = _DSP_PRNG_DEFAULT_GLOBAL_SEED;
+uint32_t DSP_Prng::global_epoch = 0;
+
+/**
+*	@brief	Creates a random numbers generator object instance
+*	@param	strm	unique stream id (e.g. generator id based on the voice number)
+*	@return none
+*/
+DSP_Prng::DSP_Prng(uint32_t strm)
+{
+	set_stream(strm);
+}
+
+/**
+*	@brief	Set the generator stream id and restart its sequence
+*	@param	strm	unique stream id
+*	@return void
+*/
+void DSP_Prng::set_stream(uint32_t strm)
+{
+	stream = strm;
+	restart();
+}
+
+/**
+*	@brief	Restart the generator sequence from the global seed and the stream id
+*	@param	none
+*	@return void
+*/
+void DSP_Prng::restart()
+{
+	uint64_t seed;
+
+	epoch = __atomic_load_n(&global_epoch, __ATOMIC_RELAXED);
+	seed = __atomic_load_n(&global_seed, __ATOMIC_RELAXED);
+
+	// Different stream (increment) per generator, state mixed with the stream id
+	inc = ((uint64_t)stream << 1) | 1u;
+	state = 0;
+	step();
+	state += (seed << 32) ^ seed ^ ((uint64_t)stream * 0x9e3779b97f4a7c15ULL);
+	step();
+}
+
+/**
+*	@brief	Advance the generator state
+*	@param	none
+*	@return void
+*/
+void DSP_Prng::step()
+{
+	state = state * 6364136223846793005ULL + inc;
+}
+
+/**
+*	@brief	Fill a block with random numbers -level to +level
+*	@param	out		a pointer to an output buffer of at least n samples
+*	@param	n		number of samples
+*	@param	level	output level
+*	@return void
+*/
+void DSP_Prng::fill_bipolar(float *out, int n, float level)
+{
+	const float scale = level * (1.0f / 2147483648.0f);
+	uint64_t st, old;
+	uint32_t xorshifted, rot, rnd;
+
+	if (epoch != __atomic_load_n(&global_epoch, __ATOMIC_RELAXED))
+	{
+		restart();
+	}
+
+	st = state;
+
+	for (int i = 0; i < n; i++)
+	{
+		old = st;
+		st = old * 6364136223846793005ULL + inc;
+		xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+		rot = (uint32_t)(old >> 59);
+		rnd = (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+
+		out[i] = (float)(int32_t)rnd * scale;
+	}
+
+	state = st;
+}
+
+/**
+*	@brief	Set the global seed. All generators restart their sequences.
+*	@param	seed	global seed
+*	@return void
+*/
+void DSP_Prng::set_global_seed(uint32_t seed)
+{
+	__atomic_store_n(&global_seed, seed, __ATOMIC_RELAXED);
+	restart_all();
+}
+
+/**
+*	@brief	Return the global seed
+*	@param	none
+*	@return global seed
+*/
+uint32_t DSP_Prng::get_global_seed()
+{
+	return __atomic_load_n(&global_seed, __ATOMIC_RELAXED);
+}
+
+/**
+*	@brief	Restart all generators sequences (each one on its next use)
+*	@param	none
+*	@return void
+*/
+void DSP_Prng::restart_all()
+{
+	__atomic_add_fetch(&global_epoch, 1, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,90 @@
+/**
+*	@file		dspPrng.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Per generator pseudo random numbers generator (PCG32).
+*				Each generator owns its state, so voices rendered in parallel
+*				never share (or lock) a random state, and the sequence is
+*				determined by the generator stream id and the global seed only.
+*/
+
+#ifndef _DSP_PRNG
+#define _DSP_PRNG
+
+#include <stdint.h>
+
+#define _DSP_PRNG_DEFAULT_GLOBAL_SEED		0x853c49e6
+
+class DSP_Prng
+{
+public:
+	DSP_Prng(uint32_t strm = 0);
+
+	void set_stream(uint32_t strm);
+	void restart();
+
+	/**
+	*	@brief	Return the next random number
+	*	@param	none
+	*	@return 32 bits random number
+	*/
+	inline uint32_t next_uint32()
+	{
+		uint64_t old = state;
+		uint32_t xorshifted, rot;
+
+		if (epoch != __atomic_load_n(&global_epoch, __ATOMIC_RELAXED))
+		{
+			restart();
+			old = state;
+		}
+
+		state = old * 6364136223846793005ULL + inc;
+		xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+		rot = (uint32_t)(old >> 59);
+
+		return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+	}
+
+	/**
+	*	@brief	Return the next random number 0.0 to 1.0
+	*	@param	none
+	*	@return random number [0.0, 1.0)
+	*/
+	inline float next_unipolar()
+	{
+		return (float)(next_uint32() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	/**
+	*	@brief	Return the next random number -1.0 to 1.0
+	*	@param	none
+	*	@return random number [-1.0, 1.0)
+	*/
+	inline float next_bipolar()
+	{
+		return (float)(int32_t)next_uint32() * (1.0f / 2147483648.0f);
+	}
+
+	void fill_bipolar(float *out, int n, float level = 1.0f);
+
+	static void set_global_seed(uint32_t seed);
+	static uint32_t get_global_seed();
+	static void restart_all();
+
+private:
+	void step();
+
+	uint64_t state;
+	uint64_t inc;
+	uint32_t stream;
+	// Global seed generation this generator was seeded with
+	uint32_t epoch;
+
+	static uint32_t global_seed;
+	static uint32_t global_epoch;
+};
+
+#endif
@@ -11,19 +11,19 @@
 *	@brief		Generates random samples -0.8 to +0.8.
 */
 
-#include <stdlib.h> // rand
-
 #include "dspSampleHoldWaveGenerator.h"
 #include "../libAdjHeartModSynth_2.h"
 #include "../utils/utils.h"
 
 /**
  *	@brief	Creates a Sample and Hold generator object instance
- *	@param	none
+ *	@param	samp_rate	sample rate
+ *	@param	iD			unique id (random numbers stream)
  *	@return	none
 */
-DSP_SampleHoldWaveGenerator::DSP_SampleHoldWaveGenerator(int samp_rate)
+DSP_SampleHoldWaveGenerator::DSP_SampleHoldWaveGenerator(int samp_rate, int iD)
 {
+	prng.set_stream((uint32_t)iD);
 	set_sample_rate(samp_rate);
 }
 
@@ -77,7 +77,7 @@ float DSP_SampleHoldWaveGenerator::get_next_sample_hold_gen_out_val(float freq)
 		pos -= 1;
 		if (pos < freqStep)
 		{
-			sample = -0.8f + 1.6f * (float)(rand() % 99999) / 100000.0f;
+			sample = -0.8f + 1.6f * prng.next_unipolar();
 		}
 		cycle_restarted = true;
 	}
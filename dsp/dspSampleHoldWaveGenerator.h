@@ -14,11 +14,12 @@
 #ifndef _DSP_SAMP_HOLD_GEN
 #define _DSP_SAMP_HOLD_GEN
 
+#include "dspPrng.h"
 
 class DSP_SampleHoldWaveGenerator
 {
 public:	
-	DSP_SampleHoldWaveGenerator(int samp_rate);
+	DSP_SampleHoldWaveGenerator(int samp_rate, int iD = 0);
 	
 	int set_sample_rate(int samp_rate);
 	int get_sample_rate();
@@ -38,6 +39,9 @@ private:
 	bool cycle_restarted;
 	
 	int sample_rate;
+	
+	// Per generator random numbers (voices are rendered in parallel)
+	DSP_Prng prng;
 };
 
 #endif
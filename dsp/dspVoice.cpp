@@ -647,6 +647,28 @@ void DSP_Voice::register_voice_end_event_callback(func_ptr_void_int_t func_ptr)
 	voice_end_event_callback_ptr = func_ptr;
 }
 
+/**
+*   @brief  Set the MSO and PAD wavetables the voice plays (the bound program wavetables).
+*   @param  mso_wtab				a pointer to a DSP_MorphingSinusOscWTAB MSO wavetable object
+*   @param	synth_pad_wavetable_source	a pointer to the published PAD wavetable pointer
+*			(the played table follows it when the wavetable is regenerated)
+*   @return void
+*/
+void DSP_Voice::set_wavetables(DSP_MorphingSinusOscWTAB *mso_wtab, Wavetable **synth_pad_wavetable_source)
+{
+	if (mso_wtab)
+	{
+		mso_wtab1 = mso_wtab;
+		mso1->set_wavetable(mso_wtab1);
+	}
+
+	if (synth_pad_wavetable_source)
+	{
+		wavetable1->set_wavetable_source(synth_pad_wavetable_source);
+		pad_wavetable = *synth_pad_wavetable_source;
+	}
+}
+
 /**
 *   @brief  initialize lfo delay times (0, 500, 1000, 1500, 2000ms) sub sampling count   
 *   @param  none
@@ -1543,9 +1565,6 @@ void DSP_Voice::update_voice_modulation(int voice)
 
 		AdjSynth::get_instance()->synth_voice[voice]->audio_voice->set_inactive();
 		AdjSynth::get_instance()->synth_voice[voice]->audio_voice->reset_wait_for_not_active();
-		AdjSynth::get_instance()->synth_voice[voice]->assign_dsp_voice(AdjSynth::get_instance()->get_original_main_dsp_voices(voice));
-		AdjSynth::get_instance()->synth_voice[voice]->mso_wtab = original_mso_wtab1;	
-		AdjSynth::get_instance()->synth_voice[voice]->pad_wavetable = original_pad_wavetable;
 		AdjSynth::get_instance()->audio_poly_mixer->restore_gain_pan(voice);
 
 	}
@@ -1669,6 +1688,182 @@ float DSP_Voice::get_next_output_value_ch2()
 	return filterOut;
 }
 
+/**
+*	@brief	Add a generator sub-block to the 2 voice channels using the send levels as gains
+*	@param	ch1		a pointer to channel 1 buffer
+*	@param	ch2		a pointer to channel 2 buffer
+*	@param	in1		a pointer to the generator channel 1 samples
+*	@param	in2		a pointer to the generator channel 2 samples
+*	@param	gain1	channel 1 gain
+*	@param	gain2	channel 2 gain
+*	@param	n		number of samples
+*	@return void
+*/
+static inline void mix_sub_block(float *ch1, float *ch2, const float *in1, const float *in2, float gain1, float gain2, int n)
+{
+	for (int i = 0; i < n; i++)
+	{
+		ch1[i] += in1[i] * gain1;
+		ch2[i] += in2[i] * gain2;
+	}
+}
+
+/**
+*	@brief	Render a block (or a segment of a block) of voice output samples.
+*			Modulation values are updated once every _CONTROL_SUB_SAMPLING samples of
+*			the audio block, and each active generator, distortion and filter processes
+*			a whole control sub-block at a time. A block rendered in several segments 
+*			(e.g. split by timed note events) is updated at the same block offsets as
+*			a block rendered at once.
+*	@param	ch1		a pointer to channel 1 output buffer of at least n samples
+*	@param	ch2		a pointer to channel 2 output buffer of at least n samples
+*	@param	n		number of samples
+*	@param	voice	voice number to be updated
+*	@param	block_offset	offset of the first sample in the audio block
+*	@return void
+*/
+void DSP_Voice::render_block(float *ch1, float *ch2, int n, int voice, int block_offset)
+{
+	int offset, len, phase;
+	
+	if (block_offset == 0)
+	{
+		// A replaced program PAD wavetable is switched only when a block starts
+		wavetable1->update_wavetable();
+	}
+	
+	offset = 0;
+	while (offset < n)
+	{
+		phase = (block_offset + offset) % _CONTROL_SUB_SAMPLING;
+		if (phase == 0)
+		{
+			// Update modulation factors
+			calc_next_modulation_values();
+			update_voice_modulation(voice);
+		}
+		
+		// Up to the next control sub-block start
+		len = _CONTROL_SUB_SAMPLING - phase;
+		if (len > n - offset)
+		{
+			len = n - offset;
+		}
+		
+		render_sub_block(ch1 + offset, ch2 + offset, len);
+		offset += len;
+	}
+}
+
+/**
+*	@brief	Render a control sub-block (up to _CONTROL_SUB_SAMPLING samples) 
+*			using the current modulation values.
+*	@param	ch1		a pointer to channel 1 output buffer of at least n samples
+*	@param	ch2		a pointer to channel 2 output buffer of at least n samples
+*	@param	n		number of samples
+*	@return void
+*/
+void DSP_Voice::render_sub_block(float *ch1, float *ch2, int n)
+{
+	int i;
+	
+	for (i = 0; i < n; i++)
+	{
+		ch1[i] = 0.0f;
+		ch2[i] = 0.0f;
+	}
+	
+	if (osc2_sync_on_osc1 && osc2_active)
+	{
+		// Sync state must be checked every sample
+		for (i = 0; i < n; i++)
+		{
+			if (osc1_active)
+			{
+				osc1_block[i] = osc1->get_next_output_val(act_freq1);
+			}
+			
+			if (osc1->getCycle_restarted_sync_state())
+			{
+				osc2->sync();
+			}
+			
+			osc2_block[i] = osc2->get_next_output_val(act_freq2);
+		}
+	}
+	else
+	{
+		if (osc1_active)
+		{
+			osc1->get_next_output_block(osc1_block, n, act_freq1);
+		}
+		
+		if (osc2_active)
+		{
+			osc2->get_next_output_block(osc2_block, n, act_freq2);
+		}
+	}
+	
+	if (osc1_active)
+	{
+		mix_sub_block(ch1, ch2, osc1_block, osc1_block,
+			mag_modulation1 * osc1_send_filter1_level, 
+			mag_modulation1 * osc1_send_filter2_level, n);
+	}
+	
+	if (osc2_active)
+	{
+		mix_sub_block(ch1, ch2, osc2_block, osc2_block,
+			mag_modulation2 * osc2_send_filter1_level, 
+			mag_modulation2 * osc2_send_filter2_level, n);
+	}
+
+	if (noise1_active)
+	{
+		noise1->get_next_noise_block(noise1_block, n);
+		mix_sub_block(ch1, ch2, noise1_block, noise1_block,
+			noise1_amp_lfo_modulation * noise1_amp_env_modulation * noise1_send_filter1_level, 
+			noise1_amp_lfo_modulation * noise1_amp_env_modulation * noise1_send_filter2_level, n);
+	}
+	
+	if (karpuls1_active)
+	{
+		karplus1->get_next_output_block(karplus1_block, n);
+		mix_sub_block(ch1, ch2, karplus1_block, karplus1_block,
+			karpuls1_send_filter1_level, karpuls1_send_filter2_level, n);
+	}
+
+	if (mso1_active)
+	{
+		mso1->get_next_mso_wtab_block(mso1_block, n, act_freq_mso1);
+		mix_sub_block(ch1, ch2, mso1_block, mso1_block,
+			mag_modulation_mso1 * mso1_send_filter1_level, 
+			mag_modulation_mso1 * mso1_send_filter2_level, n);
+	}
+
+	if (wavetable1_active)
+	{
+		wavetable1->set_output_frequency(act_freq_pad1, false);   // false: do not init pointers
+		wavetable1->get_next_wavetable_block(wavetable1_block1, wavetable1_block2, n);
+		mix_sub_block(ch1, ch2, wavetable1_block1, wavetable1_block2,
+			mag_modulation_pad1 * wavetable1_send_filter1_level, 
+			mag_modulation_pad1 * wavetable1_send_filter2_level, n);
+	}
+	
+	if (distortion1_active)
+	{
+		distortion1->process_block(ch1, n);
+	}
+	
+	if (distortion2_active)
+	{
+		distortion2->process_block(ch2, n);
+	}
+	
+	filter1->filter_output_block(ch1, n, filter_freq_mod1);
+	filter2->filter_output_block(ch2, n, filter_freq_mod2);
+}
+
 
 
 /**
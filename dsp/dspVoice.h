@@ -18,6 +18,7 @@
 #define _DSP_VOICE
 
 #include "../libAdjHeartModSynth_2.h"
+#include "../commonDefs.h"
 //#include "../audio/audioBlockFloatMultiCore.h"
 
 #include "dspKarplusStrong.h"
@@ -60,6 +61,8 @@ public:
 	
 	void register_voice_end_event_callback(func_ptr_void_int_t func_ptr);
 
+	void set_wavetables(DSP_MorphingSinusOscWTAB *mso_wtab, Wavetable **synth_pad_wavetable_source);
+
 	void copy_my_state_to(DSP_Voice target);
 	
 	void in_use();
@@ -360,6 +363,8 @@ public:
 	void calc_next_oscilators_output_value();
 	float get_next_output_value_ch1();
 	float get_next_output_value_ch2();
+	
+	void render_block(float *ch1, float *ch2, int n, int voice = 0, int block_offset = 0);
 
 	void set_osc2_sync_on_osc1();
 	void set_osc2_not_sync_on_osc1();
@@ -405,6 +410,8 @@ public:
 private:
 	int init_lfo_delays();
 	
+	void render_sub_block(float *ch1, float *ch2, int n);
+	
 	bool used;
 	
 	int sample_rate;
@@ -537,6 +544,15 @@ private:
 	float filter_freq_mod2; 
 
 	bool distortion1_active, distortion2_active;
+	
+	// Control sub-block scratch buffers (render_block())
+	float osc1_block[_CONTROL_SUB_SAMPLING];
+	float osc2_block[_CONTROL_SUB_SAMPLING];
+	float noise1_block[_CONTROL_SUB_SAMPLING];
+	float karplus1_block[_CONTROL_SUB_SAMPLING];
+	float mso1_block[_CONTROL_SUB_SAMPLING];
+	float wavetable1_block1[_CONTROL_SUB_SAMPLING];
+	float wavetable1_block2[_CONTROL_SUB_SAMPLING];
 
 	func_ptr_void_int_t voice_end_event_callback_ptr;
 
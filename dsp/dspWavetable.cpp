@@ -27,8 +27,11 @@ DSP_Wavetable::DSP_Wavetable(int iD, Wavetable *table)
 {
 	id = iD;
 	
+	wavetable_source = NULL;
 	wavetable = table;
 	wt_sample_freq = wavetable->base_freq;
+	gen_freq = 440.f;
+	calc_wt_step();
 		
 	init();
 }
@@ -72,12 +75,7 @@ void DSP_Wavetable::set_output_frequency(float out_freq, bool init_pointers)
 {
 	gen_freq = out_freq;
 	wt_sample_freq = wavetable->base_freq;
-	
-	// Actual output freq relative to the wavetable sampled freq.
-	wt_step = out_freq / wt_sample_freq;
-
-	wt_step_hi = (int)floor(wt_step);
-	wt_step_lo = wt_step - floor(wt_step);
+	calc_wt_step();
 
 	if (init_pointers)
 	{
@@ -85,6 +83,20 @@ void DSP_Wavetable::set_output_frequency(float out_freq, bool init_pointers)
 	}
 }
 
+/**
+*	@brief	Calculate the wavetable pointers step of the generated frequency
+*	@param	none
+*	@return void
+*/
+void DSP_Wavetable::calc_wt_step()
+{
+	// Actual output freq relative to the wavetable sampled freq.
+	wt_step = gen_freq / wt_sample_freq;
+
+	wt_step_hi = (int)floor(wt_step);
+	wt_step_lo = wt_step - floor(wt_step);
+}
+
 /**
 *	@brief	Get next wavetable output value
 *	@param	out1 a pointer to a float variable that will hold output 1
@@ -132,6 +144,123 @@ void DSP_Wavetable::get_next_wavetable_value(float *out1, float *out2)
 	*out2 = wavetable->samples[pos_h2] * (1.f - pos_l) + wavetable->samples[nexti] * pos_l;
 }
 
+/**
+*	@brief	Get a block of wavetable output values
+*	@param	out1 a pointer to an output 1 buffer of at least n samples
+*	@param	out2 a pointer to an output 2 buffer of at least n samples
+*	@param	n	number of samples to generate
+*	@return void
+*/
+void DSP_Wavetable::get_next_wavetable_block(float *out1, float *out2, int n)
+{
+	int nexti;
+	int size = wavetable->size;
+	float *samples = wavetable->samples;
+
+	for (int i = 0; i < n; i++)
+	{
+		pos_h1 += wt_step_hi;
+		pos_h2 += wt_step_hi;
+		pos_l += wt_step_lo;
+
+		if (pos_l >= 1.f)
+		{
+			pos_h1 += 1;
+			pos_h2 += 1;
+			pos_l -= 1.f;
+		}
+
+		if (pos_h1 >= size)
+		{
+			pos_h1 %= size;
+		}
+
+		if (pos_h2 >= size)
+		{
+			pos_h2 %= size;
+		}
+
+		// Linear interpolation
+		nexti = pos_h1 + 1;
+		if (nexti >= size)
+		{
+			nexti %= size;
+		}
+		out1[i] = samples[pos_h1] * (1.f - pos_l) + samples[nexti] * pos_l;
+
+		nexti = pos_h2 + 1;
+		if (nexti >= size)
+		{
+			nexti %= size;
+		}
+		out2[i] = samples[pos_h2] * (1.f - pos_l) + samples[nexti] * pos_l;
+	}
+}
+
+/**
+*	@brief	Set the played wavetable.
+*	@param	table	a pointer to a Wavetable_t wavetable
+*	@return void
+*/
+void DSP_Wavetable::set_wavetable(Wavetable_t *table)
+{
+	wavetable_source = NULL;
+	
+	if ((table == NULL) || (table == wavetable))
+	{
+		return;
+	}
+
+	wavetable = table;
+	wt_sample_freq = wavetable->base_freq;
+	calc_wt_step();
+	init();
+}
+
+/**
+*	@brief	Set the played wavetable to follow a published wavetable pointer
+*			(e.g. a program wavetable that is replaced when regenerated).
+*			The pointer is sampled by update_wavetable(), called once when an audio
+*			block starts, so a table is not replaced while a block is generated.
+*	@param	source	a pointer to a published Wavetable_t pointer
+*	@return void
+*/
+void DSP_Wavetable::set_wavetable_source(Wavetable_t **source)
+{
+	wavetable_source = source;
+	update_wavetable();
+}
+
+/**
+*	@brief	Switch to the published wavetable if it was replaced.
+*			Called once per audio block (not on the per sample path).
+*	@param	none
+*	@return void
+*/
+void DSP_Wavetable::update_wavetable()
+{
+	Wavetable_t *table;
+	
+	if (wavetable_source == NULL)
+	{
+		return;
+	}
+
+	table = __atomic_load_n(wavetable_source, __ATOMIC_ACQUIRE);
+	if ((table == NULL) || (table == wavetable))
+	{
+		return;
+	}
+
+	wavetable = table;
+	wt_sample_freq = wavetable->base_freq;
+	calc_wt_step();
+	if ((pos_h1 >= wavetable->size) || (pos_h2 >= wavetable->size))
+	{
+		init();
+	}
+}
+
 /**
 *	@brief	Return a pointer to the wavetable samples
 *	@param	none
@@ -34,7 +34,11 @@ public:
 	void set_output_frequency(float out_freq = 440.f, bool init_pointers = true);
 
 	void get_next_wavetable_value(float *out1, float *out2);
+	void get_next_wavetable_block(float *out1, float *out2, int n);
 
+	void set_wavetable(Wavetable_t *table);
+	void set_wavetable_source(Wavetable_t **source);
+	void update_wavetable();
 	float *get_wavetable();
 	int get_wavetable_size();
 
@@ -67,10 +71,13 @@ public:
 private:
 
 	void init();
+	void calc_wt_step();
 	
 	int id;
 
 	Wavetable_t* wavetable;
+	// Published wavetable pointer followed by this object (NULL: fixed wavetable)
+	Wavetable_t **wavetable_source;
 	// Table pointers
 	int pos_h1, pos_h2;
 	// Residual
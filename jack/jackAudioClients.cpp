@@ -28,9 +28,6 @@
 #include "../libAdjHeartModSynth_2.h"
 
 
-extern pthread_cond_t update_thread_cv;
-extern pthread_mutex_t update_thread_mutex;
-
 AudioManager *audio_manager = NULL;
 
 jack_client_t *client_out = NULL, *client_in = NULL;
@@ -299,15 +296,29 @@ int jack_callback_process_out(jack_nframes_t nun_of_frames, void *arg)
 		fprintf(stderr, "jack callback small buffer\n");
 	}
 
-	process_out(nun_of_frames);
-	
+	if (audio_manager == NULL)
+	{
+		process_silence_out(nun_of_frames);
+		return 0;
+	}
 
-	// Triger update process	
-	if(pthread_mutex_trylock(&update_thread_mutex) == 0)
+	if (audio_manager->get_audio_update_mode() == _AUDIO_UPDATE_MODE_PULL)
 	{
-		// Signal update thread
-		pthread_cond_signal(&update_thread_cv);
-		pthread_mutex_unlock(&update_thread_mutex);
+		// Render this period in place and play it now
+		if (audio_manager->run_audio_update_cycle() != 0)
+		{
+			// A cycle started in push mode is still running
+			process_silence_out(nun_of_frames);
+			return 0;
+		}
+		
+		process_out(nun_of_frames);
+	}
+	else
+	{
+		// Play the oldest rendered period and let the update thread render the next one
+		process_out(nun_of_frames);
+		audio_manager->signal_audio_update();
 	}
 	
 	return 0;
@@ -354,12 +365,36 @@ void process_out(jack_nframes_t nun_of_frames)
 	//	prevBufferR = bufferR;
 	//	prevBufferL = bufferL;
 
-		if(audio_manager != NULL)
+	if(audio_manager != NULL)
 	{
+		shared_memory_audio_block_float_stereo_struct_t *period;
+		AudioOutputRing *ring = audio_manager->get_active_output_ring();
+		
+		if (ring)
+		{
+			period = ring->get_read_period();
+			if (period == NULL)
+			{
+				// Underrun (counted by the ring) - play silence rather than replaying a stale period
+				memset(buffer_L, 0, sizeof(jack_default_audio_sample_t) * nun_of_frames);
+				memset(buffer_R, 0, sizeof(jack_default_audio_sample_t) * nun_of_frames);
+				return;
+			}
+		}
+		else
+		{
+			period = audio_manager->audio_block_stereo_float_shared_memory_outputs;
+		}
+		
 		for (i = 0; i < nun_of_frames /*_PERIOD_SIZE*/; i++) 
 		{
-			*(buffer_L + i) = (sample_t)audio_manager->audio_block_stereo_float_shared_memory_outputs->data[_LEFT][i];          // / 32767.0;
-			*(buffer_R + i) = (sample_t)audio_manager->audio_block_stereo_float_shared_memory_outputs->data[_RIGHT][i];          // / 32767.0;
+			*(buffer_L + i) = (sample_t)period->data[_LEFT][i];          // / 32767.0;
+			*(buffer_R + i) = (sample_t)period->data[_RIGHT][i];          // / 32767.0;
+		}
+		
+		if (ring)
+		{
+			ring->release_read_period();
 		}
 	}
 }
@@ -21,8 +21,14 @@
 
 #include "jack/jackAudioClients.h"
 
+#include "audio/audioBlock.h"
+#include "synthesizer/modSynthOfflineRender.h"
+#include "synthesizer/adjSynthPADgenerator.h"
+#include "dsp/dspPrng.h"
+
 #include "../utils/log.h"
 #include "../utils/utils.h"
+#include "../utils/queuesBenchmark.h"
 
 ModSynthSettings *settings_manager;
 
@@ -74,6 +80,13 @@ int mod_synth_init()
 	FILE_LOG(logINFO) << "...";
 	
 	mod_synth = ModSynth::get_instance(); // new ModSynth();
+	
+	if (!AudioManager::get_instance()->is_audio_memory_arena_allocated())
+	{
+		// Audio can not be started
+		fprintf(stderr, "mod_synth_init: audio memory not allocated\n");
+		return -1;
+	}
 
 	return 0;
 }
@@ -147,6 +160,16 @@ int mod_synth_deinit_midi_services()
 	return 0;
 }
 
+int mod_synth_set_midi_batching_window_us(int usec)
+{
+	return MidiStream::set_batching_window_us(usec);
+}
+
+int mod_synth_get_midi_batching_window_us()
+{
+	return MidiStream::get_batching_window_us();
+}
+
 void mod_synth_connect_bt_to_midi()
 {
 	mod_synth->connect_bt_midi();
@@ -194,6 +217,16 @@ int mod_synth_get_cpu_utilization()
 	return ModSynth::cpu_utilization; 
 }
 
+int mod_synth_get_audio_blocks_pool_contention_count()
+{
+	return (int)AudioBlockFloat::get_audio_blocks_pool_contention_count();
+}
+
+void mod_synth_reset_audio_blocks_pool_contention_count()
+{
+	AudioBlockFloat::reset_audio_blocks_pool_contention_count();
+}
+
 int mod_synth_set_audio_driver(int driver)
 {
 	return ModSynth::get_instance()->set_audio_driver_type(driver, true); // set and restart audio
@@ -204,6 +237,156 @@ int mod_synth_get_audio_driver() // TODO:
 	return ModSynth::get_instance()->get_audio_driver_type();
 }
 
+int mod_synth_set_audio_update_mode(int mode)
+{
+	return mod_synth->get_adj_synth()->audio_manager->set_audio_update_mode(mode);
+}
+
+int mod_synth_get_audio_update_mode()
+{
+	return mod_synth->get_adj_synth()->audio_manager->get_audio_update_mode();
+}
+
+int mod_synth_set_audio_output_ring_num_of_periods(int num)
+{
+	return mod_synth->get_adj_synth()->audio_manager->set_output_ring_num_of_periods(num);
+}
+
+int mod_synth_get_audio_output_underruns_count()
+{
+	return (int)mod_synth->get_adj_synth()->audio_manager->get_output_ring()->get_underruns_count();
+}
+
+void mod_synth_reset_audio_output_underruns_count()
+{
+	mod_synth->get_adj_synth()->audio_manager->get_output_ring()->reset_counters();
+}
+
+int mod_synth_get_audio_stage_latency_percentile_ns(int stage, float percentile)
+{
+	return mod_synth->get_adj_synth()->audio_manager->get_latency_stats()->get_percentile_ns(stage, percentile);
+}
+
+int mod_synth_get_audio_stage_latency_max_ns(int stage)
+{
+	return mod_synth->get_adj_synth()->audio_manager->get_latency_stats()->get_max_ns(stage);
+}
+
+int mod_synth_get_audio_stage_latency_count(int stage)
+{
+	return mod_synth->get_adj_synth()->audio_manager->get_latency_stats()->get_count(stage);
+}
+
+int mod_synth_get_audio_deadline_misses_count()
+{
+	return (int)mod_synth->get_adj_synth()->audio_manager->get_latency_stats()->get_deadline_misses_count();
+}
+
+void mod_synth_reset_audio_latency_stats()
+{
+	mod_synth->get_adj_synth()->audio_manager->get_latency_stats()->reset();
+}
+
+int mod_synth_get_audio_dsp_load()
+{
+	return mod_synth->get_adj_synth()->audio_manager->get_dsp_load()->get_load_percent();
+}
+
+int mod_synth_get_audio_dsp_peak_load()
+{
+	return mod_synth->get_adj_synth()->audio_manager->get_dsp_load()->get_peak_load_percent();
+}
+
+int mod_synth_get_audio_dsp_rejected_voices_count()
+{
+	return (int)mod_synth->get_adj_synth()->audio_manager->get_dsp_load()->get_rejected_voices_count();
+}
+
+void mod_synth_reset_audio_dsp_rejected_voices_count()
+{
+	mod_synth->get_adj_synth()->audio_manager->get_dsp_load()->reset_rejected_voices_count();
+}
+
+int mod_synth_run_queues_benchmark(int num_of_items)
+{
+	const char *queues_names[_QUEUES_BENCHMARK_NUM_OF_QUEUES] = { "SafeQueue", "SpscRing", "MpscRing" };
+	queue_benchmark_result_t results[_QUEUES_BENCHMARK_NUM_OF_QUEUES];
+	int res, queue;
+	
+	res = run_queues_benchmark(num_of_items, results);
+	if ((res == 0) || (res == -3))
+	{
+		for (queue = 0; queue < _QUEUES_BENCHMARK_NUM_OF_QUEUES; queue++)
+		{
+			fprintf(stderr, "%-10s push avg: %6u ns max: %9u ns  pop avg: %6u ns max: %9u ns  full: %u\n",
+				queues_names[queue],
+				results[queue].push_avg_ns,
+				results[queue].push_max_ns,
+				results[queue].pop_avg_ns,
+				results[queue].pop_max_ns,
+				results[queue].push_full_count);
+		}
+	}
+	
+	return res;
+}
+
+void mod_synth_set_dsp_random_seed(uint32_t seed)
+{
+	DSP_Prng::set_global_seed(seed);
+}
+
+uint32_t mod_synth_get_dsp_random_seed()
+{
+	return DSP_Prng::get_global_seed();
+}
+
+int mod_synth_offline_render(string events_file_path, string wav_file_path, int block_size)
+{
+	ModSynthOfflineRenderer renderer;
+	offline_render_stats_t stats;
+	int res;
+	
+	if (renderer.load_events_file(events_file_path) != 0)
+	{
+		return -1;
+	}
+	
+	res = renderer.render(wav_file_path, block_size, _OFFLINE_RENDER_DEFAULT_TAIL_SEC, &stats);
+	if (res == 0)
+	{
+		ModSynthOfflineRenderer::print_stats(stderr, &stats);
+	}
+	
+	return res;
+}
+
+int mod_synth_run_offline_benchmark(string report_file_path, int num_of_voices, int num_of_cycles)
+{
+	ModSynthOfflineRenderer renderer;
+	FILE *report = stdout;
+	int res;
+	
+	if (!report_file_path.empty())
+	{
+		report = fopen(report_file_path.c_str(), "w");
+		if (report == NULL)
+		{
+			fprintf(stderr, "Offline benchmark: unable to create %s\n", report_file_path.c_str());
+			return -1;
+		}
+	}
+	
+	res = renderer.run_benchmark(report, num_of_voices, num_of_cycles);
+	
+	if (report != stdout)
+	{
+		fclose(report);
+	}
+	
+	return res;
+}
+
 int mod_synth_get_jack_mode() 
 { 
 	return get_jack_mode(); 
@@ -1242,7 +1425,7 @@ void mod_synth_set_mod_synth_active_preset_num(int preset_num)
 	if ((preset_num >= 0) || (preset_num < _NUM_OF_PRESETS))
 	{
 		ModSynthPresets::set_active_preset(preset_num);
-		ModSynthPresets::set_synth_settings(ModSynthPresets::get_synth_preset_params(preset_num));
+		mod_synth->set_mod_synth_preset(ModSynthPresets::get_synth_preset_params(preset_num));
 	}		
 }
 
@@ -1616,6 +1799,11 @@ void register_callback_midi_program_change_event(func_ptr_void_int_int_t ptr)
 	callback_ptr_midi_program_change_event = ptr;
 }
 
+void register_callback_wavetables_generation_progress(func_ptr_void_int_int_t ptr)
+{
+	SynthPADgenerator::get_instance()->register_progress_callback(ptr);
+}
+
 void register_callback_update_signal_display(func_ptr_void_float_ptr_float_ptr_int_t ptr)
 {
 	callback_ptr_update_signal_display = ptr;
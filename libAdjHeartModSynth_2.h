@@ -109,6 +109,21 @@
 #define _AUDIO_JACK									0
 #define _AUDIO_ALSA									1
 #define _DEFAULT_AUDIO_DRIVER						_AUDIO_JACK
+
+#define _AUDIO_UPDATE_MODE_PUSH						0	// update thread renders ahead into an output ring
+#define _AUDIO_UPDATE_MODE_PULL						1	// JACK process callback renders in place
+#define _DEFAULT_AUDIO_UPDATE_MODE					_AUDIO_UPDATE_MODE_PUSH
+
+// Audio update cycle instrumented stages (latency histograms)
+#define _AUDIO_LATENCY_STAGE_START_TASKS			0	// update cycle start tasks
+#define _AUDIO_LATENCY_STAGE_VOICE					1	// a single voice update_all()
+#define _AUDIO_LATENCY_STAGE_VOICES					2	// all voices (wall clock)
+#define _AUDIO_LATENCY_STAGE_MIXER					3	// polyphonic mixer
+#define _AUDIO_LATENCY_STAGE_REVERB					4	// reverb
+#define _AUDIO_LATENCY_STAGE_EQUALIZER				5	// equalizer
+#define _AUDIO_LATENCY_STAGE_OUTPUT					6	// stereo output
+#define _AUDIO_LATENCY_STAGE_CYCLE					7	// complete update cycle
+#define _AUDIO_LATENCY_NUM_OF_STAGES				8
 	
 #define _SAMPLE_RATE_44								44100
 #define _SAMPLE_RATE_48								48000
@@ -822,7 +837,7 @@ typedef bool(*func_ptr_bool_int_t)(int);
 *   @brief  Initializes the synthesizer engine.
 *			Must be called first before any other call.
 *   @param  none
-*   @return 0 if done
+*   @return 0 if done; -1 if the audio memory could not be allocated (audio can not be started)
 */
 int mod_synth_init();
 
@@ -884,6 +899,21 @@ int mod_synth_init_midi_services();
 */
 int mod_synth_deinit_midi_services();
 
+/**
+*   @brief  Set the MIDI input batching window: after input is received, wait this time
+*			for more input before it is processed (0: process immediately).
+*   @param  usec	window (usec) 0 to 5000
+*   @return 0 if done; -1 if out of range
+*/
+int mod_synth_set_midi_batching_window_us(int usec);
+
+/**
+*   @brief  Return the MIDI input batching window.
+*   @param  none
+*   @return the batching window (usec)
+*/
+int mod_synth_get_midi_batching_window_us();
+
 /**
 *   @brief `Enable bt MIDI input direct (non ALSA) streaming.
 *   @param  none
@@ -943,6 +973,21 @@ int mod_synth_get_number_of_cores();
 *   @return int	the total (all cores) CPU utilization in precetages (0 to 100).
 */
 int mod_synth_get_cpu_utilization();
+
+/**
+*   @brief  Returns the audio blocks pool contention events counter
+*			(lock-free allocation retries) since the last reset.
+*   @param  none
+*   @return int	number of contention events.
+*/
+int mod_synth_get_audio_blocks_pool_contention_count();
+
+/**
+*   @brief  Resets the audio blocks pool contention events counter.
+*   @param  none
+*   @return void
+*/
+void mod_synth_reset_audio_blocks_pool_contention_count();
 	
 /**
 *   @brief  Returns the audio driver type.
@@ -959,6 +1004,166 @@ int mod_synth_get_audio_driver();
 */
 int mod_synth_set_audio_driver(int driver);
 
+/**
+*   @brief  Sets the audio update mode (JACK driver only).
+*   @param  mode	_AUDIO_UPDATE_MODE_PUSH (update thread renders ahead into an output ring)
+*					or _AUDIO_UPDATE_MODE_PULL (JACK process callback renders in place)
+*   @return int	set mode; -1 param out of range.
+*/
+int mod_synth_set_audio_update_mode(int mode);
+
+/**
+*   @brief  Returns the audio update mode.
+*   @param  none
+*   @return int	_AUDIO_UPDATE_MODE_PUSH or _AUDIO_UPDATE_MODE_PULL.
+*/
+int mod_synth_get_audio_update_mode();
+
+/**
+*   @brief  Sets the number of periods in the JACK output ring (push mode).
+*			Audio is restarted if running.
+*   @param  num	number of periods (2 to 8)
+*   @return int	set number of periods; -1 param out of range.
+*/
+int mod_synth_set_audio_output_ring_num_of_periods(int num);
+
+/**
+*   @brief  Returns the number of JACK output underruns (no rendered period was ready).
+*   @param  none
+*   @return int	number of underruns.
+*/
+int mod_synth_get_audio_output_underruns_count();
+
+/**
+*   @brief  Resets the JACK output underruns/overruns counters.
+*   @param  none
+*   @return void
+*/
+void mod_synth_reset_audio_output_underruns_count();
+
+/**
+*   @brief  Returns a percentile of an audio update cycle stage processing time.
+*   @param  stage		_AUDIO_LATENCY_STAGE_START_TASKS ... _AUDIO_LATENCY_STAGE_CYCLE
+*   @param  percentile	0.0 to 100.0 (e.g. 50.0, 99.0)
+*   @return int	time in nanoseconds (histogram resolution ~6%); -1 param out of range.
+*/
+int mod_synth_get_audio_stage_latency_percentile_ns(int stage, float percentile);
+
+/**
+*   @brief  Returns the maximum processing time of an audio update cycle stage.
+*   @param  stage	_AUDIO_LATENCY_STAGE_START_TASKS ... _AUDIO_LATENCY_STAGE_CYCLE
+*   @return int	time in nanoseconds; -1 param out of range.
+*/
+int mod_synth_get_audio_stage_latency_max_ns(int stage);
+
+/**
+*   @brief  Returns the number of samples recorded for an audio update cycle stage.
+*   @param  stage	_AUDIO_LATENCY_STAGE_START_TASKS ... _AUDIO_LATENCY_STAGE_CYCLE
+*   @return int	number of samples; -1 param out of range.
+*/
+int mod_synth_get_audio_stage_latency_count(int stage);
+
+/**
+*   @brief  Returns the number of audio update cycles that took longer than
+*			an audio period (deadline misses).
+*   @param  none
+*   @return int	number of deadline misses.
+*/
+int mod_synth_get_audio_deadline_misses_count();
+
+/**
+*   @brief  Clears all the audio update cycle latency histograms and the deadline
+*			misses counter.
+*   @param  none
+*   @return void
+*/
+void mod_synth_reset_audio_latency_stats();
+
+/**
+*   @brief  Returns the DSP load: the audio update cycle render time moving average
+*			as a percent of the audio period (voices admission control measure).
+*   @param  none
+*   @return int	DSP load in percents (may exceed 100); 0 if not measured yet.
+*/
+int mod_synth_get_audio_dsp_load();
+
+/**
+*   @brief  Returns the DSP peak load: the audio update cycle render time decaying
+*			peak as a percent of the audio period.
+*   @param  none
+*   @return int	DSP peak load in percents (may exceed 100); 0 if not measured yet.
+*/
+int mod_synth_get_audio_dsp_peak_load();
+
+/**
+*   @brief  Returns the number of new voices that were not admitted since the last
+*			reset, because the audio period deadline could have been missed
+*			(a quiet voice was stolen or the note was dropped).
+*   @param  none
+*   @return int	number of rejected voices.
+*/
+int mod_synth_get_audio_dsp_rejected_voices_count();
+
+/**
+*   @brief  Resets the DSP load rejected voices counter.
+*   @param  none
+*   @return void
+*/
+void mod_synth_reset_audio_dsp_rejected_voices_count();
+
+/**
+*   @brief  Runs a micro-benchmark of the push/pop latency of the thread-safe queues
+*			(SafeQueue vs. the lock-free SPSC and MPSC rings) and prints the results.
+*			Not for use while the synthesizer is playing.
+*   @param  num_of_items	number of records pushed through each queue (1000 to 10000000)
+*   @return int	0 if done; -1 param out of range; -2 thread creation error;
+*			-3 records were lost or reordered.
+*/
+int mod_synth_run_queues_benchmark(int num_of_items);
+
+/**
+*   @brief  Sets the global seed of the DSP random numbers generators (noise, Karplus-Strong
+*			excitation, sample & hold). Each generator sequence depends only on this seed and
+*			its own (voice based) id, so renders are reproducible. All generators restart.
+*   @param  seed	global seed
+*   @return void
+*/
+void mod_synth_set_dsp_random_seed(uint32_t seed);
+
+/**
+*   @brief  Returns the global seed of the DSP random numbers generators.
+*   @param  none
+*   @return uint32_t	global seed.
+*/
+uint32_t mod_synth_get_dsp_random_seed();
+
+/**
+*   @brief  Renders a MIDI file (.mid, .midi) or a notes list text file (lines of:
+*			start_sec duration_sec channel note velocity) into a 32 bits float
+*			stereo WAV file, as fast as possible and without an audio device.
+*			The audio service is stopped (call mod_synth_start_audio() to restart).
+*			The DSP random numbers generators are restarted, so rendering the same
+*			events with the same seed is bit-exact. Timing statistics are printed to stderr.
+*   @param  events_file_path	MIDI file or notes list file path
+*   @param  wav_file_path		output WAV file path
+*   @param  block_size			_AUDIO_BLOCK_SIZE_256, _AUDIO_BLOCK_SIZE_512, _AUDIO_BLOCK_SIZE_1024
+*   @return int	0 if done; -1 otherwise.
+*/
+int mod_synth_offline_render(string events_file_path, string wav_file_path, int block_size = _DEFAULT_BLOCK_SIZE);
+
+/**
+*   @brief  Runs the offline benchmark suite: num_of_voices notes of each synth type
+*			(VCO, noise, KPS, MSO, PAD) at each block size, without an audio device.
+*			A CSV report line is written per configuration with the cycle and voice
+*			processing times and the number of voices per core at real-time.
+*			The audio service is stopped and the active patch sound sources are changed.
+*   @param  report_file_path	CSV report file path; empty - report to stdout
+*   @param  num_of_voices		number of simultaneous notes
+*   @param  num_of_cycles		number of measured update cycles per configuration
+*   @return int	0 if done; -1 otherwise.
+*/
+int mod_synth_run_offline_benchmark(string report_file_path, int num_of_voices, int num_of_cycles = 500);
+
 /**
 *   @brief  Returns the JACK mode of operation auto (parameters are retrived
 *			from JACK server), or manual (application sets JACK servers parameters).
@@ -4283,6 +4488,16 @@ void register_callback_update_ui_jack_connection_status_not_active(func_ptr_void
 */	
 void register_callback_midi_program_change_event(func_ptr_void_int_int_t ptr);
 
+/**
+*   @brief  Register a callback function that reports the background programs wavetables
+*			(PAD, MSO) generation progress, e.g. while a preset is loaded.
+*			Called from a wavetables generator worker thread.
+*   @param  funcPtrVoidIntInt ptr  a pointer to the callback function ( void foo(int done, int requested) )\n
+*	A preset wavetables are switched when done == requested.
+*   @return void
+*/	
+void register_callback_wavetables_generation_progress(func_ptr_void_int_int_t ptr);
+
 /**
 *   @brief  Register a callback function that initiates a GUI update of signals oscilooscope display.
 *   @param  funcPtrVoidFloatFloatInt ptr  a pointer to the callback function ( void func(float*, float*, int) )\n
@@ -1,8 +1,11 @@
 /**
 *	@file		midiAlsaQclient.h
 *	@author		Nahum Budin
-*	@date		12-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. The rx queue is a preallocated wait-free ring (no allocations).
+*
+*	@version	1.1		12-Feb-2021
 *					1. Code refactoring and notaion.
 *					2. Adding rx queue as a paramter
 *
@@ -16,9 +19,8 @@
 #include "midiAlsaQclient.h"
 //#include "../alsa/alsaMidi.h"
 #include "midiStream.h"
-#include "../utils/safeQueues.h"
 
-MidiAlsaQclientIn::MidiAlsaQclientIn(SafeQueue<alsa_data_t*> *rx_q , uint8_t stage)
+MidiAlsaQclientIn::MidiAlsaQclientIn(alsa_midi_rx_ring_t *rx_q , uint8_t stage)
 	: MidiStream(0, NULL, stage)
 {
 	rx_queue = rx_q;
@@ -30,10 +32,14 @@ void MidiAlsaQclientIn::update(void) // TODO: add connection number to select in
 {
 	midi_stream_mssg_block_t *block;
 	raw_data_mssg_block_t *data;
-	int count, last_count;
+	int count, i;
 
 	alsa_data_t *rx_data = NULL;
-	bool timeout, blocking = false;
+
+	if (rx_queue == NULL)
+	{
+		return;
+	}
 
 	// Available channel data
 	block = allocate_midi_stream_block();
@@ -44,19 +50,31 @@ void MidiAlsaQclientIn::update(void) // TODO: add connection number to select in
 			block->header_type = _MIDISTREAM_HEADER_TYPE_RAW;
 			block->header_reseved1 = 0;
 			block->header_reseved2 = 0;
-			// Get all data from Q
+			// Get all data from the ring that fits into one block
 			count = 0;
-			last_count = 0;		// used for single message multiple reads
-			rx_data = rx_queue->dequeue(0, &timeout, &blocking);  //// Non blocking get from Q
+			rx_data = rx_queue->get_read_slot();
+			if (rx_data != NULL)
+			{
+				// A block holds data received at the same time only
+				block->timestamp_ns = rx_data->timestamp_ns;
+			}
+			
 			while (rx_data != NULL)
 			{ 
-				for (count; count < (last_count + rx_data->length) && count < sizeof(rx_data->data); count++)
+				if (((count + rx_data->length) > sizeof(rx_data->data)) ||
+					(rx_data->timestamp_ns != block->timestamp_ns))
+				{
+					// Left for the next update process
+					MidiStream::notify_data_available();
+					break;
+				}
+				
+				for (i = 0; i < rx_data->length; i++)
 				{
-					data->bytes[count] = rx_data->data[count-last_count];
+					data->bytes[count++] = rx_data->data[i];
 				}
-				last_count = count;
-				delete rx_data;
-				rx_data = rx_queue->dequeue(0, &timeout, &blocking);
+				rx_queue->release_read_slot();
+				rx_data = rx_queue->get_read_slot();
 			}
 			
 			if (count > 0)
@@ -1,8 +1,11 @@
 /**
 *	@file		midiAlsaQclient.h
 *	@author		Nahum Budin
-*	@date		12-Feb-2021
-*	@version	1.1
+*	@date		17-Oct-2026
+*	@version	1.2
+*					1. The rx queue is a preallocated wait-free ring (no allocations).
+*
+*	@version	1.1		12-Feb-2021
 *					1. Code refactoring and notaion.
 *					2. Adding rx queue as a paramter
 *
@@ -23,13 +26,13 @@
 class MidiAlsaQclientIn : public MidiStream
 {
 public:
-	MidiAlsaQclientIn(SafeQueue<alsa_data_t*> *rx_q = nullptr, uint8_t stage = 0);		
+	MidiAlsaQclientIn(alsa_midi_rx_ring_t *rx_q = nullptr, uint8_t stage = 0);		
 
 	virtual void update(void);
 
 private:
 	
-	SafeQueue<alsa_data_t*> *rx_queue;
+	alsa_midi_rx_ring_t *rx_queue;
 
 };
 
@@ -205,6 +205,9 @@ void MidiHandler::update()
 		rx_block = receive_read_only(stream);
 		if (rx_block)
 		{
+			// Notes are scheduled by their own arrival time
+			set_input_timestamp_ns(rx_block->timestamp_ns);
+			
 			// New data received
 			if (rx_block->header_type == _MIDISTREAM_HEADER_TYPE_MIDI_MULTI)
 			{
@@ -258,6 +261,8 @@ void MidiHandler::update()
 	//		fprintf(stderr, "Midi handler no rx block: \n");
 		}
 	}
+
+	set_input_timestamp_ns(0);
 }
 
 /**
@@ -406,7 +411,8 @@ void MidiHandler::call_midi_handlers(uint8_t *msg, uint8_t len)
 					
 		case _MIDI_PITCH_BEND:
 			byte3 = *(msg + 2);
-			pitch = (int)((byte2 & 0x7f) + ((byte3 & 0x7f) << 7));
+			// -8192 to 8191 (as the ALSA sequencer pitch bend value)
+			pitch = (int)((byte2 & 0x7f) + ((byte3 & 0x7f) << 7)) - _MIDI_PITCH_BEND_MAX_VALUE;
 			if (callback_pitch_bend) (*callback_pitch_bend)(channel, pitch);
 			break;
 						
@@ -251,6 +251,8 @@ MidiParser::MidiParser(uint8_t stage)
 
 					tx_block->header_type = _MIDISTREAM_HEADER_TYPE_MIDI_MULTI;
 					tx_block->header_length = midi_mssg_index;
+					// The commands were completed by this input
+					tx_block->timestamp_ns = rx_block->timestamp_ns;
 					// Transmit on channel 0
 					transmit(tx_block, 0);
 					release_midi_stream_block(tx_block);
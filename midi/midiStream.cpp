@@ -1,8 +1,20 @@
 /**
 *	@file		midiStream.cpp
 *	@author		Nahum Budin
-*	@date		6-Feb-2021
-*	@version	1.1 
+*	@date		17-Oct-2026
+*	@version	1.4
+*					1. Each midi block carries its input arrival time; the time of the
+*					   message being handled is kept per message instead of per update process.
+*
+*	@version	1.3		17-Oct-2026
+*					1. The arrival time of the input processed by the update process
+*					   is kept (used for sample-accurate notes scheduling).
+*
+*	@version	1.2		17-Oct-2026
+*					1. The update process runs when input data is available (eventfd wake-up)
+*					   instead of periodic polling.
+*
+*	@version	1.1		6-Feb-2021
 *					1. Code refactoring and notaion.
 *					
 *	@version	1.0		13_Oct-2019 
@@ -23,6 +35,8 @@
 
 #include <unistd.h>
 #include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
 
 #include "midiStream.h"
 #include "../misc/priorities.h"
@@ -42,6 +56,9 @@ MidiStream *MidiStream::first_update[_MAX_STAGES_NUM];
 bool MidiStream::thread_is_running = false;
 bool MidiStream::update_in_progress = false;
 pthread_t MidiStream::midi_thread;
+int MidiStream::data_available_fd = -1;
+int MidiStream::batching_window_us = 0;
+uint64_t MidiStream::input_timestamp_ns = 0;
 
 std::mutex MidiStream::allocations_manage_mutex;
 
@@ -232,6 +249,7 @@ midi_stream_mssg_block_t * MidiStream::allocate_midi_stream_block(void)
 	
 	block = midi_stream_memory_pool + ((index << 5) + (/*31 -*/ n));
 	block->ref_count = 1;
+	block->timestamp_ns = 0;
 	//	if (used > memory_used_max) memory_used_max = used;
 
 	// mutex-release like
@@ -558,6 +576,16 @@ void MidiStream::start_thread()
 		fprintf(stderr, "Unsuccessful in setting MIDI Stream thread realtime prio\n");
 	}
 	
+	if (data_available_fd < 0)
+	{
+		data_available_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (data_available_fd < 0)
+		{
+			fprintf(stderr, "MIDI Stream: unable to create eventfd; polling every %i msec\n",
+				_MIDI_STREAM_IDLE_UPDATE_PERIOD_MSEC);
+		}
+	}
+	
 	thread_is_running = true;
 	pthread_create(&midi_thread, &tattr, run_midi, (void *)11);
 }
@@ -570,6 +598,96 @@ void MidiStream::start_thread()
 void MidiStream::stop_thread()
 {
 	thread_is_running = false;
+	// Wake the thread so it exits now
+	notify_data_available();
+}
+
+/**
+*   @brief  Signal the update process thread that input data is available.
+*			Called by the input threads (e.g. ALSA MIDI rx) after data is queued;
+*			the update process runs immediately (or after the batching window).
+*			Lock free; may be called from any thread.
+*   @param  none
+*   @return void
+*/
+void MidiStream::notify_data_available()
+{
+	uint64_t one = 1;
+	
+	if (data_available_fd >= 0)
+	{
+		// Never blocks (the counter only saturates after 2^64 - 2 unread signals)
+		if (write(data_available_fd, &one, sizeof(one)) != sizeof(one))
+		{
+			// Already signaled
+		}
+	}
+}
+
+/**
+*   @brief  Set the batching window: after a wake-up, wait this time for more input
+*			before the update process runs (e.g. to handle chord notes in one update).
+*   @param  usec	window (usec) 0 to _MIDI_STREAM_MAX_BATCHING_WINDOW_USEC; 0: no window
+*   @return 0 if done; -1 if out of range
+*/
+int MidiStream::set_batching_window_us(int usec)
+{
+	if ((usec < 0) || (usec > _MIDI_STREAM_MAX_BATCHING_WINDOW_USEC))
+	{
+		return -1;
+	}
+	
+	__atomic_store_n(&batching_window_us, usec, __ATOMIC_RELAXED);
+	
+	return 0;
+}
+
+/**
+*   @brief  Return the batching window.
+*   @param  none
+*   @return the batching window (usec)
+*/
+int MidiStream::get_batching_window_us() { return __atomic_load_n(&batching_window_us, __ATOMIC_RELAXED); }
+
+/**
+*   @brief  Return the arrival time of the MIDI message handled by the update process
+*			(set by the stage that handles the message).
+*			Valid only when called by the update process (MIDI stream thread).
+*   @param  none
+*   @return arrival time (CLOCK_MONOTONIC ns); 0 if not called by the update process
+*			or the message arrival time is unknown
+*/
+uint64_t MidiStream::get_input_timestamp_ns()
+{
+	if (!thread_is_running || !pthread_equal(pthread_self(), midi_thread))
+	{
+		return 0;
+	}
+	
+	return input_timestamp_ns;
+}
+
+/**
+*   @brief  Set the arrival time of the MIDI message that is about to be handled.
+*			Called by the handling stage (update process) before each message.
+*   @param  timestamp_ns	arrival time (CLOCK_MONOTONIC ns); 0: unknown
+*   @return void
+*/
+void MidiStream::set_input_timestamp_ns(uint64_t timestamp_ns) { input_timestamp_ns = timestamp_ns; }
+
+/**
+*   @brief  Return the current time used for MIDI input arrival times.
+*			Called by the input threads when data is received.
+*   @param  none
+*   @return current time (CLOCK_MONOTONIC ns)
+*/
+uint64_t MidiStream::get_time_ns()
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
 }
 
 /**
@@ -608,10 +726,15 @@ bool MidiStream::update_is_in_progress()
 }
 
 /**
-*	Midi timer function that periodically (5msec) initiates a MIDI update process 
+*	Midi thread function that initiates a MIDI update process when input data is
+*	signaled (notify_data_available()), and also periodically when idle.
 */
 void *MidiStream::run_midi(void *threadid)
 {
+	struct pollfd poll_fd;
+	uint64_t signals;
+	int window_us, res;
+
 	fprintf(stderr, "MIDI Stream thread started\n");
 	
 	int *tid = (int*)threadid;
@@ -621,14 +744,42 @@ void *MidiStream::run_midi(void *threadid)
 	
 	pthread_setname_np(thId, "midithread");
 	
+	poll_fd.fd = data_available_fd;
+	poll_fd.events = POLLIN;
+	
 	while (thread_is_running)
 	{
-		if (update_enable)
+		if (data_available_fd >= 0)
+		{
+			// Wait for input (or the idle period)
+			poll_fd.revents = 0;
+			res = poll(&poll_fd, 1, _MIDI_STREAM_IDLE_UPDATE_PERIOD_MSEC);
+			if ((res > 0) && (poll_fd.revents & POLLIN))
+			{
+				window_us = get_batching_window_us();
+				if (window_us > 0)
+				{
+					usleep(window_us);
+				}
+				// Clear the signals (data that arrives from now on signals again)
+				if (read(data_available_fd, &signals, sizeof(signals)) != sizeof(signals))
+				{
+					// Not signaled
+				}
+			}
+		}
+		else
+		{
+			usleep(_MIDI_STREAM_IDLE_UPDATE_PERIOD_MSEC * 1000);
+		}
+		
+		// Set by the stages for each handled message
+		input_timestamp_ns = 0;
+		
+		if (update_enable && thread_is_running)
 		{
 			update_all();
 		}
-
-		usleep(50000); // (10000);
 	}
 
 	return 0;
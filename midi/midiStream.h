@@ -1,8 +1,20 @@
 /**
 *	@file		midiStream.h
 *	@author		Nahum Budin
-*	@date		3-Feb-2021
-*	@version	1.1 
+*	@date		17-Oct-2026
+*	@version	1.4
+*					1. Each midi block carries its input arrival time; the time of the
+*					   message being handled is kept per message instead of per update process.
+*
+*	@version	1.3		17-Oct-2026
+*					1. The arrival time of the input processed by the update process
+*					   is kept (used for sample-accurate notes scheduling).
+*
+*	@version	1.2		17-Oct-2026
+*					1. The update process runs when input data is available (eventfd wake-up)
+*					   instead of periodic polling.
+*
+*	@version	1.1		3-Feb-2021
 *					1. Code refactoring and notaion.
 *					
 *	@version	1.0		13_Oct-2019 
@@ -78,6 +90,11 @@ Error : must be n * 32
 
 // Max number of midi processing stages - Must be no more than 8
 #define _MAX_STAGES_NUM 8
+
+// The update process also runs when no input was signaled for this period (msec)
+#define _MIDI_STREAM_IDLE_UPDATE_PERIOD_MSEC	50
+// Max batching window (usec): after a wake-up, wait for more input before updating
+#define _MIDI_STREAM_MAX_BATCHING_WINDOW_USEC	5000
 #if (_MAX_STAGES_NUM > 8)
 														Error : Must be no more than 8
 #endif
@@ -96,6 +113,13 @@ Error : must be n * 32
 #define _MIDI_SYSEX_END							0xF7
 #define _MIDI_RESET								0xFF
 
+#define _MIDI_CC_ALL_SOUND_OFF					120
+#define _MIDI_CC_RESET_ALL_CONTROLLERS			121
+#define _MIDI_CC_ALL_NOTES_OFF					123
+
+// Pitch bend value range is -8192 to 8191 (0: no bend)
+#define _MIDI_PITCH_BEND_MAX_VALUE				8192
+
 // TODO: temp
 #define _MIDI_TILTUNE_SYSEX_VENDOR_ID_0			0
 #define _MIDI_TILTUNE_SYSEX_VENDOR_ID_1			0x35 
@@ -208,6 +232,8 @@ typedef	struct
 	uint8_t header_length; 			// Number of valid bytes
 	uint8_t header_reseved1;
 	uint8_t header_reseved2;
+	// Input arrival time of the block data (CLOCK_MONOTONIC ns; 0: unknown)
+	uint64_t timestamp_ns;
 	
 	// Block data bytes: may be refernced in various ways
 	union 
@@ -288,6 +314,12 @@ public:
 	static void start_thread();
 	static void stop_thread();
 	
+	static void notify_data_available();
+	static int set_batching_window_us(int usec);
+	static int get_batching_window_us();
+	static uint64_t get_input_timestamp_ns();
+	static uint64_t get_time_ns();
+	
 	static void update_setup(void);
 	static void update_stop(void);
 		
@@ -309,6 +341,7 @@ public:
 	static void release_midi_stream_block(midi_stream_mssg_block_t * block);
 	static raw_data_mssg_block_t * allocate_raw_data_mssg_block(void);
 	static void release_raw_data_mssg_block(raw_data_mssg_block_t * block);		
+	static void set_input_timestamp_ns(uint64_t timestamp_ns);
 	void transmit(midi_stream_mssg_block_t *block, unsigned char index = 0);
 	midi_stream_mssg_block_t * receive_read_only(unsigned int index = 0);
 	midi_stream_mssg_block_t * receive_writable(unsigned int index = 0);
@@ -339,6 +372,12 @@ private:
 	static bool thread_is_running;
 	/* When true update process is in progress */
 	static bool update_in_progress;
+	/* Signaled (eventfd) by input threads when data is available */
+	static int data_available_fd;
+	/* After a wake-up, wait this time (usec) for more input before updating (0: none) */
+	static int batching_window_us;
+	/* Arrival time (CLOCK_MONOTONIC ns) of the message handled by the update process (0: unknown) */
+	static uint64_t input_timestamp_ns;
 	
 	static midi_stream_mssg_block_t *midi_stream_memory_pool;
 	/* Used for marking used/free pool resources */
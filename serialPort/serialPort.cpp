@@ -1,8 +1,12 @@
 /**
 * @file		serialPort.cpp
 *	@author		Nahum Budin
-*	@date		21-Oxt-2020
-*	@version	1.0
+*	@date		17-Oct-2026
+*	@version	1.1
+*					1. Data is transferred through preallocated lock-free rings of fixed-size
+*					   records instead of SafeQueue (no allocations).
+*
+*	@version	1.0		21-Oxt-2020
 *
 *	@brief		Handle serial port
 *
@@ -20,7 +24,7 @@ bool SerialPort::serial_port_is_opened = false;
 int SerialPort::port_number = 1;
 char SerialPort::default_mode[3] = { '8', 'N', '1' };
 SerialPort *SerialPort::serial_port_instance = NULL;
-SafeQueue<serialPortData_t *> SerialPort::alsa_serial_port_rx_queue;
+serial_port_ring_t SerialPort::alsa_serial_port_rx_queue;
 
 SerialPort *SerialPort::get_serial_port_instance(int port_num)
 {
@@ -129,7 +133,7 @@ int SerialPort::close_port()
 
 void *SerialPort::serial_port_rx_thread(void *threadid)
 {
-	int num_of_RX_bytes = 0, i;
+	int num_of_RX_bytes = 0, i, offset, len;
 	unsigned char rx_buf[1024];
 
 	serialPortData_t *serialPortRxAlsaData;
@@ -144,22 +148,32 @@ void *SerialPort::serial_port_rx_thread(void *threadid)
 
 			if (num_of_RX_bytes > 0)
 			{
-				// New data received - Create a new rx data object (Don't forget to free after processing!!!)
-				serialPortRxAlsaData = new serialPortData_t;
-				serialPortRxAlsaData->port_num = port_number;
-				serialPortRxAlsaData->mssg_len = num_of_RX_bytes;
-				for (i = 0; (i < num_of_RX_bytes) && (i < sizeof(serialPortRxAlsaData->message)); i++) // TODO: break longer messages
+				// New data received - copy it into ring records (dropped if full)
+				for (offset = 0; offset < num_of_RX_bytes; offset += len)
 				{
-					serialPortRxAlsaData->message[i] = rx_buf[i];
+					serialPortRxAlsaData = alsa_serial_port_rx_queue.get_write_slot();
+					if (serialPortRxAlsaData == NULL)
+					{
+						break;
+					}
+					
+					// Longer messages are split
+					len = num_of_RX_bytes - offset;
+					if (len > sizeof(serialPortRxAlsaData->message))
+					{
+						len = sizeof(serialPortRxAlsaData->message);
+					}
+					
+					serialPortRxAlsaData->port_num = port_number;
+					serialPortRxAlsaData->mssg_len = len;
+					for (i = 0; i < len; i++)
+					{
+						serialPortRxAlsaData->message[i] = rx_buf[offset + i];
+					}
+					
+					alsa_serial_port_rx_queue.commit_write_slot();
 				}
 
-				if (serialPortRxAlsaData->mssg_len > 100)
-				{
-					printf("ser data big");
-				}
-
-				alsa_serial_port_rx_queue.enqueue(serialPortRxAlsaData);
-
 #ifdef _SERIAL_DBG_PRINT_IS_ON
 				printf("Ser port rx bytes: n=%i  ", num_of_RX_bytes);
 				for (i = 0; i < num_of_RX_bytes; i++)
@@ -1,8 +1,12 @@
 /**
 * @file		serialPort.h
 *	@author		Nahum Budin
-*	@date		21-Oxt-2020
-*	@version	1.0
+*	@date		17-Oct-2026
+*	@version	1.1
+*					1. Data is transferred through preallocated lock-free rings of fixed-size
+*					   records instead of SafeQueue (no allocations).
+*
+*	@version	1.0		21-Oxt-2020
 *
 *	@brief		Handle serial port
 *	
@@ -59,7 +63,7 @@
 
 #include <stdint.h>
 
-#include "../utils/safeQueues.h"
+#include "../utils/lockFreeRings.h"
 
 #include "../../../../RS232lib/adjRS232.h"
 
@@ -74,6 +78,11 @@ typedef struct serialPortData
 	int mssg_len;
 } serialPortData_t;
 
+/* Number of records in each data ring (must be a power of 2) */
+#define _SERIAL_PORT_RING_SIZE	64
+
+typedef SpscRing<serialPortData_t, _SERIAL_PORT_RING_SIZE> serial_port_ring_t;
+
 class SerialPort
 {
 public:
@@ -87,9 +96,9 @@ public:
 	int close_port();
 
 	/* A queue used to send the incoming serial port data as ALSA midi events */
-	static SafeQueue<serialPortData_t *> alsa_serial_port_rx_queue;
+	static serial_port_ring_t alsa_serial_port_rx_queue;
 	/* A queue used to send the incoming serial port data raw data */
-	static SafeQueue<serialPortData_t *> alsa_serial_port_tx_queue;
+	static serial_port_ring_t alsa_serial_port_tx_queue;
 
 private:
 	SerialPort(int portNum = 1);
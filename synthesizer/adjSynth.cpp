@@ -16,11 +16,13 @@
 */
 
 #include <mutex>
+#include <math.h>
 
 #include <omp.h>
 
 #include "adjSynth.h"
 #include "../utils/utils.h"
+#include "../utils/FFTwrapper.h"
 #include "../audio/audioBlock.h"
 #include "../audio/audioBandEqualizer.h"
 #include "../jack/jackAudioClients.h"
@@ -40,8 +42,6 @@ int AdjSynth::num_of_core_voices = 1;
 pthread_mutex_t voice_manage_mutex;
 // Mutex to handle busy/not-busy voices marking
 pthread_mutex_t voice_busy_mutex;
-// Mutex to controll audio memory blocks allocation
-pthread_mutex_t voice_mem_blocks_allocation_control_mutex;
 
 // Callback that is initiated by the AudioManager audio-update thread
 void callback_audio_voice_update(int voice_num)
@@ -53,13 +53,115 @@ void callback_audio_voice_update(int voice_num)
 	}
 }
 
+// Callback that is initiated by the AudioManager voices scheduler - only active voices are scheduled
+bool callback_audio_voice_is_active(int voice_num)
+{
+	if (AdjSynth::synth_voice[voice_num] == NULL)
+	{
+		return false;
+	}
+	
+	return AdjSynth::synth_voice[voice_num]->audio_voice->is_voice_active() ||
+		AdjSynth::synth_voice[voice_num]->audio_voice->is_voice_wait_for_not_active();
+}
+
+// Audio parameters update: rebuild a program voices parameters (on the audio update thread)
+static void apply_program_voices_params_update(const audio_param_update_t *update)
+{
+	AdjSynth::get_instance()->update_program_voices_params(update->prog);
+}
+
+// Audio parameters update: bind a stolen (playing) voice to a program (on the audio update thread)
+static void apply_voice_bind_program_update(const audio_param_update_t *update)
+{
+	AdjSynth *adj_synth = AdjSynth::get_instance();
+	int prog = update->prog;
+	
+	adj_synth->synth_voice[update->index_start]->bind_program(
+		prog,
+		adj_synth->synth_program[prog]->get_patch_snapshot(),
+		adj_synth->synth_program[prog]->mso_wtab,
+		&adj_synth->synth_program[prog]->program_wavetable);
+}
+
+// Callback that is initiated by the settings manager when a parameters batch is committed.
+void callback_settings_params_batch_commit(int prog)
+{
+	audio_param_update_t update;
+	
+	if ((prog < 0) || (prog >= mod_synth_get_synthesizer_num_of_programs()))
+	{
+		return;
+	}
+	
+	// The voices are set from the new program patch snapshot
+	AdjSynth::get_instance()->synth_program[prog]->publish_patch_snapshot();
+	
+	update.apply = apply_program_voices_params_update;
+	update.target = NULL;
+	update.index_start = 0;
+	update.index_stop = 0;
+	update.prog = prog;
+	update.value.int_value = 0;
+	
+	// The voices DSP objects are not modified while they are processed
+	if (!AudioParamsQueue::get_instance()->post_wait(&update))
+	{
+		// No update cycles are running
+		AdjSynth::get_instance()->update_program_voices_params(prog);
+	}
+}
+
+// Callback that is initiated by the settings manager when a program parameter was edited
+// (outside of a parameters batch): new voices are bound to the edited patch.
+void callback_settings_params_changed(int prog)
+{
+	if ((prog >= 0) && (prog < mod_synth_get_synthesizer_num_of_programs()))
+	{
+		AdjSynth::get_instance()->synth_program[prog]->publish_patch_snapshot();
+	}
+}
+
 // Callback that is initiated by the AudioManager audio-update thread.
 void callback_audio_update_cycle_end_tasks(int param)
 {
+	AdjSynth *adj_synth = AdjSynth::get_instance();
+	AudioLatencyStats *latency_stats = adj_synth->audio_manager->get_latency_stats();
 	AudioBlockFloat *p;
-	for (p = *AdjSynth::get_instance()->audio_poly_mixer->audio_first_update; p; p = p->audio_next_update)
+	uint64_t start_ns, stop_ns;
+	int stage;
+	
+	start_ns = audio_latency_now_ns();
+	
+	for (p = *adj_synth->audio_poly_mixer->audio_first_update; p; p = p->audio_next_update)
 	{
 		p->update();
+		
+		stop_ns = audio_latency_now_ns();
+		
+		if (p == adj_synth->audio_poly_mixer)
+		{
+			stage = _AUDIO_LATENCY_STAGE_MIXER;
+		}
+		else if (p == adj_synth->audio_reverb)
+		{
+			stage = _AUDIO_LATENCY_STAGE_REVERB;
+		}
+		else if (p == adj_synth->audio_equalizer)
+		{
+			stage = _AUDIO_LATENCY_STAGE_EQUALIZER;
+		}
+		else if (p == adj_synth->audio_out)
+		{
+			stage = _AUDIO_LATENCY_STAGE_OUTPUT;
+		}
+		else
+		{
+			stage = -1;	// not instrumented (included in the cycle time)
+		}
+		
+		latency_stats->record(stage, stop_ns - start_ns);
+		start_ns = stop_ns;
 	}
 }
 
@@ -93,6 +195,11 @@ AdjSynth::AdjSynth()
 	hammond_percussion_soft = false; 
 	hammond_ercussion_3_rd = false; 
 	active_sketch = _SKETCH_PROGRAM_1;
+	
+	for (int prog = 0; prog < _SYNTH_MAX_NUM_OF_PROGRAMS; prog++)
+	{
+		program_pitch_bend_factor[prog] = 1.0f;
+	}
 
 	// Allocate audio blocks data memory pool
 //	AllocateAudioMemoryBlocksFloatPool(_MAX_AUDIO_BLOCKS_MESSAGES_POOL_SIZE, audio_block_size); // moved down after setting sample-rate and block size
@@ -114,7 +221,6 @@ AdjSynth::AdjSynth()
 	// Init mutexes
 	pthread_mutex_init(&voice_manage_mutex, NULL);
 	pthread_mutex_init(&voice_busy_mutex, NULL);
-	pthread_mutex_init(&voice_mem_blocks_allocation_control_mutex, NULL);
 
 	set_sample_rate(_DEFAULT_SAMPLE_RATE);
 	set_audio_block_size(_DEFAULT_BLOCK_SIZE);
@@ -138,8 +244,12 @@ AdjSynth::AdjSynth()
 	audio_manager->set_period_time_us(((unsigned long)audio_block_size*1000000)/sample_rate + 0.5);	
 	
 	audio_manager->register_callback_audio_voice_update(&callback_audio_voice_update);
+	audio_manager->register_callback_audio_voice_is_active(&callback_audio_voice_is_active);
 	audio_manager->register_callback_audio_update_cycle_end_tasks(&callback_audio_update_cycle_end_tasks);
 	
+	ModSynthSettings::register_params_batch_commit_callback(&callback_settings_params_batch_commit);
+	ModSynthSettings::register_params_changed_callback(&callback_settings_params_changed);
+	
 
 	program_wavetable = new Wavetable();
 	program_wavetable->size = _PAD_DEFAULT_WAVETABLE_SIZE;
@@ -385,24 +495,95 @@ int AdjSynth::stop_audio()
 }
 
 /**
-*   @brief  retruns a pointer to an original main dsp voice 
-*   @param  voice voice number
-*   @return  pointer to an original main dsp voice if OK; NULL if param out of range
+*   @brief  Returns the pool voice a program voice-block parameter change should be applied to.
+*			A voice-block parameter callback is called for each voice number; the change is 
+*			applied to the voice only if it currently plays the program. Other voices get the
+*			changed program parameters when bound again to the program (the program patch 
+*			snapshot is changed).
+*   @param  prog	program number
+*   @param	voice	voice number
+*   @return a pointer to the voice if it plays the program; NULL otherwise
 */	
-DSP_Voice *AdjSynth::get_original_main_dsp_voices(int voice)
+SynthVoice *AdjSynth::get_program_bound_voice(int prog, int voice)
 {
-	if ((voice >= 0) && (voice < mod_synth_get_synthesizer_num_of_polyphonic_voices()))
-	{	
-		return original_main_dsp_voices[voice];
-	}
-	else
+	if ((voice < 0) || (voice >= mod_synth_get_synthesizer_num_of_polyphonic_voices()) ||
+		(synth_voice[voice] == NULL))
 	{
 		return NULL;
 	}
+
+	if (synth_voice[voice]->is_bound_to_program(prog))
+	{
+		return synth_voice[voice];
+	}
+
+	return NULL;
+}
+
+/**
+*   @brief  Update all the voices that hold a program parameters, after a parameters
+*			batch modified the program patch (instead of each block callback of the batch).
+*			Voices that play the program are set from the published program patch snapshot
+*			at once; other voices get it when bound again to the program.
+*			Called by the audio update thread before the voices are updated (or directly
+*			when no update cycles are running).
+*   @param  prog	program number
+*   @return void
+*/
+void AdjSynth::update_program_voices_params(int prog)
+{
+	settings_snapshot_t *snapshot;
+	
+	if ((prog < 0) || (prog >= mod_synth_get_synthesizer_num_of_programs()))
+	{
+		return;
+	}
+	
+	snapshot = synth_program[prog]->get_patch_snapshot();
+	
+	for (int voice = 0; voice < mod_synth_get_synthesizer_num_of_polyphonic_voices(); voice++)
+	{
+		if (synth_voice[voice] == NULL)
+		{
+			continue;
+		}
+
+		if (synth_voice[voice]->is_bound_to_program(prog))
+		{
+			synth_voice[voice]->set_patch_snapshot(prog, ModSynthSettings::retain_snapshot(snapshot));
+		}
+	}
+	
+	ModSynthSettings::release_snapshot(snapshot);
 }
 
 /**
-*   @brief  Set synthvoice instances to point at program[0] voices //Create and initialize the synth voice instances
+*   @brief  Release a synthesizer voice from the active voices count of the program
+*			it was acquired for. Idempotent: a voice stolen by the MIDI thread and freed
+*			by the audio update thread is released once.
+*   @param  voice	voice number
+*   @return void
+*/
+void AdjSynth::release_program_voice(int voice)
+{
+	int prog;
+	
+	if ((voice < 0) || (voice >= mod_synth_get_synthesizer_num_of_polyphonic_voices()) ||
+		(synth_voice[voice] == NULL))
+	{
+		return;
+	}
+	
+	prog = __atomic_exchange_n(&synth_voice[voice]->active_count_program, -1, __ATOMIC_ACQ_REL);
+	if ((prog >= 0) && (prog < mod_synth_get_synthesizer_num_of_programs()))
+	{
+		synth_program[prog]->release_voice();
+	}
+}
+
+/**
+*   @brief  Create the synthesizer shared voices pool instances.
+*			Voices are bound to a program patch parameters only when a note is played.
 *   @param  none
 *   @return void
 */
@@ -413,17 +594,6 @@ void AdjSynth::init_synth_voices()
 		synth_voice[voice] = new SynthVoice(voice, active_sketch, sample_rate, audio_block_size, 
 											 &active_adj_synth_patch_params, mso_wtab, program_wavetable,
 											audio_manager);
-		
-		//		originalMainDspVoices[voice] = synth_voice[voice]->dspVoice;
-				
-//		synth_voice[voice] = synth_program[0]->synth_voices[voice];		
-		
-		
-		// Assign the program voice to the original voice
-		synth_voice[voice]->assign_dsp_voice(synth_program[active_sketch]->synth_voices[voice]->dsp_voice);
-		// Assingn LUTs
-		synth_voice[voice]->mso_wtab = synth_program[active_sketch]->mso_wtab;
-		synth_voice[voice]->pad_wavetable = synth_program[active_sketch]->program_wavetable;
 	}
 }
 
@@ -434,6 +604,9 @@ void AdjSynth::init_synth_voices()
 */
 void AdjSynth::init_synth_programs()
 {
+	// PAD wavetables FFT plans measured on previous runs are reused
+	FFT_set_wisdom_file((std::string(_ADJ_DEFAULT_PATCHES_DIR) + "/" + _FFT_WISDOM_FILE_NAME).c_str());
+	
 	// Program[0] is the active non MIDIping mode program used for editting patches, etc.
 	// Program[1] to Program[16] are MIDI-mapping mode programs used each for a MIDI channel 1-16 
 	for(int program = 0 ; program < mod_synth_get_synthesizer_num_of_programs(); program++)
@@ -682,6 +855,8 @@ int AdjSynth::get_active_sketch() { return active_sketch; }
 */
 int AdjSynth::copy_sketch(int srcsk, int destsk)
 {
+	settings_snapshot_t *snapshot;
+	
 	if ((srcsk == destsk) || (srcsk < _SKETCH_PROGRAM_1) || (srcsk > _SKETCH_PROGRAM_3) ||
 		(destsk < _SKETCH_PROGRAM_1) || (destsk > _SKETCH_PROGRAM_3))
 	{
@@ -689,12 +864,35 @@ int AdjSynth::copy_sketch(int srcsk, int destsk)
 	}
 	else
 	{
-		synth_program[destsk]->set_program_patch_params(&synth_program[srcsk]->active_patch_params);
+		// The source patch snapshot is shared by the destination program (copy on write)
+		synth_program[srcsk]->publish_patch_snapshot();
+		snapshot = synth_program[srcsk]->get_patch_snapshot();
+		synth_program[destsk]->set_program_patch_snapshot(snapshot);
+		ModSynthSettings::release_snapshot(snapshot);
+		
+		callback_settings_params_batch_commit(destsk);
 	}
 
 	return 0;
 }
 
+/**
+*   @brief  Hold (or release) all the programs patch snapshots: while held, new voices are
+*			bound to the programs patches as they were when the hold started.
+*   @param  hold	true to hold; false to release
+*   @return void
+*/
+void AdjSynth::hold_programs_patch_snapshots(bool hold)
+{
+	for (int prog = 0; prog < mod_synth_get_synthesizer_num_of_programs(); prog++)
+	{
+		if (synth_program[prog] != NULL)
+		{
+			synth_program[prog]->hold_patch_snapshot(hold);
+		}
+	}
+}
+
 /**
 *   @brief  Initilize the voices polyphonic state and paramters
 *   @param  none
@@ -707,6 +905,7 @@ void AdjSynth::init_poly()
 		if (synth_voice[voice] != NULL)
 		{	
 			synth_voice[voice]->audio_voice->init_poly();
+			__atomic_store_n(&synth_voice[voice]->active_count_program, -1, __ATOMIC_RELEASE);
 		}
 		mark_voice_not_busy_callback(voice);
 
@@ -715,13 +914,11 @@ void AdjSynth::init_poly()
 			synth_polyphony->clear_busy_core_voices_count(core);
 		}
 
-		for (int program = 0; program < mod_synth_get_synthesizer_num_of_programs(); program++)
-		{
-			if (synth_program[program]->synth_voices[voice] != NULL)
-			{	
-				synth_program[program]->synth_voices[voice]->dsp_voice->not_in_use();
-			}
-		}
+	}
+
+	for (int program = 0; program < mod_synth_get_synthesizer_num_of_programs(); program++)
+	{
+		synth_program[program]->release_all_voices();
 	}
 }
 
@@ -960,6 +1157,32 @@ int AdjSynth::get_utilization_callback()
 }
 
 
+/**
+*   @brief  Post a note on/off or pitch bend event to a voice, timestamped with the MIDI 
+*			message arrival time, to be applied by the voice update at the event frame offset inside
+*			the audio block. Applied directly when the audio update cycles are not
+*			running or the voice events queue is full.
+*			Called under the voices management mutex.
+*   @param	voice	voice number
+*	@param	event	a pointer to the event (timestamp is set)
+*   @return void
+*/
+void AdjSynth::post_voice_event(int voice, audio_voice_event_t *event)
+{
+	event->timestamp_ns = MidiStream::get_input_timestamp_ns();
+	if (event->timestamp_ns == 0)
+	{
+		// Not called by the MIDI stream update process
+		event->timestamp_ns = audio_latency_now_ns();
+	}
+	
+	if (!AudioParamsQueue::get_instance()->is_active() ||
+		!synth_voice[voice]->audio_voice->post_event(event))
+	{
+		synth_voice[voice]->audio_voice->apply_event(event);
+	}
+}
+
 /**
 *   @brief  Play note on 
 *			Allocate free voice
@@ -973,9 +1196,10 @@ int AdjSynth::get_utilization_callback()
 */
 void  AdjSynth::midi_play_note_on(uint8_t channel, uint8_t byte2, uint8_t byte3, int voc)
 {
-	int voice, core, scaledMagnitude, prog = 0;
-	bool reused = false;
-	SynthVoice *prog_voice = NULL;
+	int voice, core, scaledMagnitude, voice_type, prog = 0;
+	bool reused = false, stolen = false;
+	audio_voice_event_t event;
+	audio_param_update_t bind_update;
 	
 	if (midi_mapping_mode == _MIDI_MAPPING_MODE_MAPPING)
 	{
@@ -996,6 +1220,7 @@ void  AdjSynth::midi_play_note_on(uint8_t channel, uint8_t byte2, uint8_t byte3,
 	}
 
 	voice = -1;
+	voice_type = synth_program[prog]->get_voice_type();
 
 	if (kbd1->portamento_is_enabled()) // TODO mobe portamento to programs?
 		{
@@ -1031,6 +1256,21 @@ void  AdjSynth::midi_play_note_on(uint8_t channel, uint8_t byte2, uint8_t byte3,
 		}
 	}
 
+	if ((voice > -1) && !reused &&
+		!synth_voice[voice]->audio_voice->is_voice_active() &&
+		!synth_voice[voice]->audio_voice->is_voice_wait_for_not_active())
+	{
+		// A free voice adds to the DSP load - admit it only if the next audio
+		// periods are still expected to meet their deadline (offline renders have
+		// no deadline: all the voices are rendered)
+		if (audio_manager->is_audio_service_started() &&
+			!audio_manager->get_dsp_load()->admit_voice(voice_type))
+		{
+			// Steal the quietest playing voice instead (none: the note is dropped)
+			voice = synth_polyphony->get_quietest_voice();
+		}
+	}
+
 	if ((voice > -1) && !reused)
 	{
 		/*	moved up	
@@ -1043,42 +1283,66 @@ void  AdjSynth::midi_play_note_on(uint8_t channel, uint8_t byte2, uint8_t byte3,
 				prog = active_sketch;
 		}
 */		
-		// Voice found and if not reused, get a free voice from mapped program		
-		prog_voice = synth_program[prog]->get_free_voice();
-		
-		if (!prog_voice)
+		// Voice found and if not reused, verify the mapped program polyphony		
+		if (!synth_program[prog]->acquire_voice())
 			voice = -1;
 		else
 		{
-				// Assign the program voice to the free voice
-			synth_voice[voice]->assign_dsp_voice(prog_voice->dsp_voice);
-			// Assingn LUTs
-			synth_voice[voice]->mso_wtab = synth_program[prog]->mso_wtab;			
-			synth_voice[voice]->pad_wavetable = synth_program[prog]->program_wavetable;
-
-			synth_voice[voice]->allocated_to_program_num = prog_voice->allocated_to_program_num;
-			synth_voice[voice]->allocated_to_program_voice_num = prog_voice->voice_num;
-			audio_poly_mixer->preserve_gain_pan(voice);
-			audio_poly_mixer->set_voice_gain_1_ptr(voice, prog);
-			audio_poly_mixer->set_voice_gain_2_ptr(voice, prog);
-			audio_poly_mixer->set_voice_pan_1_ptr(voice, prog);
-			audio_poly_mixer->set_voice_pan_2_ptr(voice, prog);
-			audio_poly_mixer->set_voice_send_1_ptr(voice, prog);
-			audio_poly_mixer->set_voice_send_2_ptr(voice, prog);
+			stolen = synth_voice[voice]->audio_voice->is_voice_active() ||
+				synth_voice[voice]->audio_voice->is_voice_wait_for_not_active();
+			if (stolen)
+			{
+				// An oldest (or quietest) voice is reused - release it from its program
+				release_program_voice(voice);
+			}
+			
+			if (!synth_program[prog]->portamento_is_enabled())
+			{
+				__atomic_store_n(&synth_voice[voice]->active_count_program, prog, __ATOMIC_RELEASE);
+			}
+			
+			if (stolen)
+			{
+				// A playing voice DSP objects are modified only by the audio update thread
+				bind_update.apply = apply_voice_bind_program_update;
+				bind_update.target = NULL;
+				bind_update.index_start = voice;
+				bind_update.index_stop = voice;
+				bind_update.prog = prog;
+				bind_update.value.int_value = 0;
+				
+				if (!AudioParamsQueue::get_instance()->post_wait(&bind_update))
+				{
+					// No update cycles are running
+					apply_voice_bind_program_update(&bind_update);
+				}
+			}
+			else
+			{
+				// Bind the free voice to the program patch parameters and wavetables
+				synth_voice[voice]->bind_program(
+					prog,
+					synth_program[prog]->get_patch_snapshot(),
+					synth_program[prog]->mso_wtab,
+					&synth_program[prog]->program_wavetable);
+			}
+			
+			// Rebound by the audio update thread (not while the voices are mixed)
+			audio_poly_mixer->bind_voice_program(voice, prog);
 
 			fprintf(stderr,
-				"midi_play_note_on: %i voice: %i program: %i allocated to prog %i\n", 
+				"midi_play_note_on: %i voice: %i program: %i\n", 
 				byte2,
-				prog_voice->voice_num,
-				prog,
-				prog_voice->allocated_to_program_num);
+				voice,
+				prog);
 		}
 	}
 _voice_is_on:
 	if ((voice > -1) && (synth_voice[voice] != NULL))
 	{
-		if (!reused)
+		if (!reused && !stolen)
 		{
+			// A stolen voice is already counted as busy
 			core = voice / num_of_core_voices;
 			pthread_mutex_lock(&voice_busy_mutex);
 			synth_polyphony->inc_busy_core_voices_count(core);
@@ -1092,6 +1356,8 @@ _voice_is_on:
 		}
 		
 		synth_polyphony->activate_resource(voice, (int)byte2, prog);
+		// Voice type render costs are measured for the admission control
+		audio_manager->get_dsp_load()->set_voice_type(voice, voice_type);
 		//		kbd1->voices[voice].note = byte2;
 		synth_voice[voice]->audio_voice->set_note(byte2);
 		fprintf(stderr, "On voice %i\n", voice);
@@ -1116,25 +1382,19 @@ _voice_is_on:
 			scaledMagnitude = kbd1->get_low_scaled_velocity(byte3);
 		}
 
-		synth_voice[voice]->dsp_voice->set_voice_frequency(kbd1->get_note_frequency());
-
-		synth_voice[voice]->dsp_voice->filter1->set_kbd_freq(kbd1->get_note_frequency());
-		synth_voice[voice]->dsp_voice->filter2->set_kbd_freq(kbd1->get_note_frequency());
-
-		synth_voice[voice]->audio_voice->set_magnitude((float)scaledMagnitude / 127);
-		synth_voice[voice]->dsp_voice->karplus1->note_on(byte2, (float)scaledMagnitude / 127);
-
+		// Frequency, magnitude, karplus and envelopes note on are applied by the voice
+		// update at the note frame offset
+		event.type = _AUDIO_VOICE_EVENT_NOTE_ON;
+		event.note = byte2;
+		event.frequency = kbd1->get_note_frequency();
+		event.magnitude = (float)scaledMagnitude / 127;
+		event.pitch_factor = program_pitch_bend_factor[prog];
+		post_voice_event(voice, &event);
 
 		//		fprintf(stderr, "%i %f\n", voice, kbd1->getNoteFrequency());
 
 		//		fprintf(stderr, "freq %f\n", kbd1->getNoteFrequency());
 
-		synth_voice[voice]->dsp_voice->adsr_note_on(synth_voice[voice]->dsp_voice->adsr1);
-		synth_voice[voice]->dsp_voice->adsr_note_on(synth_voice[voice]->dsp_voice->adsr2);
-		synth_voice[voice]->dsp_voice->adsr_note_on(synth_voice[voice]->dsp_voice->adsr3);
-		synth_voice[voice]->dsp_voice->adsr_note_on(synth_voice[voice]->dsp_voice->adsr4);
-		synth_voice[voice]->dsp_voice->adsr_note_on(synth_voice[voice]->dsp_voice->adsr5);
-
 		//		fprintf(stderr, "\nsynth on %i %i ", byte2, voice);
 	}
 	else
@@ -1155,6 +1415,7 @@ _voice_is_on:
 void  AdjSynth::midi_play_note_off(uint8_t channel, uint8_t byte2, uint8_t byte3, int voc)
 {
 	int voice = -1, program = 0;
+	audio_voice_event_t event;
 
 	if (midi_mapping_mode == _MIDI_MAPPING_MODE_MAPPING)
 	{
@@ -1177,12 +1438,13 @@ void  AdjSynth::midi_play_note_off(uint8_t channel, uint8_t byte2, uint8_t byte3
 
 		if(voice != -1)
 	{		
-		synth_voice[voice]->dsp_voice->adsr_note_off(synth_voice[voice]->dsp_voice->adsr1);
-		synth_voice[voice]->dsp_voice->adsr_note_off(synth_voice[voice]->dsp_voice->adsr2);
-		synth_voice[voice]->dsp_voice->adsr_note_off(synth_voice[voice]->dsp_voice->adsr3);
-		synth_voice[voice]->dsp_voice->adsr_note_off(synth_voice[voice]->dsp_voice->adsr4);
-		synth_voice[voice]->dsp_voice->adsr_note_off(synth_voice[voice]->dsp_voice->adsr5);
-		synth_voice[voice]->dsp_voice->karplus1->note_off();
+		// Envelopes and karplus note off are applied by the voice update at the note frame offset
+		event.type = _AUDIO_VOICE_EVENT_NOTE_OFF;
+		event.note = byte2;
+		event.frequency = 0.0f;
+		event.magnitude = 0.0f;
+		event.pitch_factor = 1.0f;
+		post_voice_event(voice, &event);
 		synth_polyphony->free_voice(voice, true);   // go to pending untill env is zero
 		fprintf(stderr, "midi_play_note_off  %i voice: %i prog: %i\n", byte2, voice, program);
 
@@ -1204,6 +1466,104 @@ void  AdjSynth::midi_play_note_off(uint8_t channel, uint8_t byte2, uint8_t byte3
 	pthread_mutex_unlock(&voice_manage_mutex);
 }
 
+/**
+*   @brief  Return the program played by a MIDI channel.
+*   @param	channel	MIDI channel: 0-15 patc1-3: 16-18
+*   @return program number
+*/
+int AdjSynth::get_midi_channel_program(uint8_t channel)
+{
+	if (midi_mapping_mode == _MIDI_MAPPING_MODE_MAPPING)
+	{
+		return channel;
+	}
+	else
+	{
+		return active_sketch;
+	}
+}
+
+/**
+*   @brief  Pitch bend. The program playing voices are bent by pitch bend events, applied
+*			by the voice update at the message frame offset; new notes start bent.
+*   @param	channel	MIDI channel: 0-15 patc1-3: 16-18
+*	@param	pitch	pitch bend value -8192 to 8191 (0: no bend)
+*   @return void
+*/
+void AdjSynth::midi_pitch_bend(uint8_t channel, int pitch)
+{
+	int prog = get_midi_channel_program(channel);
+	audio_voice_event_t event;
+
+	return_if_true((prog < 0) || (prog >= _SYNTH_MAX_NUM_OF_PROGRAMS));
+
+	pthread_mutex_lock(&voice_manage_mutex);
+
+	program_pitch_bend_factor[prog] = powf(2.0f, 
+		(float)pitch / _MIDI_PITCH_BEND_MAX_VALUE * _ADJ_SYNTH_PITCH_BEND_RANGE_SEMITONES / 12.0f);
+
+	event.type = _AUDIO_VOICE_EVENT_PITCH_BEND;
+	event.note = -1;
+	event.frequency = 0.0f;
+	event.magnitude = 0.0f;
+	event.pitch_factor = program_pitch_bend_factor[prog];
+
+	for (int voice = 0; voice < mod_synth_get_synthesizer_num_of_polyphonic_voices(); voice++)
+	{
+		if ((synth_voice[voice] != NULL) && (synth_voice[voice]->get_allocated_program() == prog) &&
+			(synth_voice[voice]->audio_voice->is_voice_active() ||
+			 synth_voice[voice]->audio_voice->is_voice_wait_for_not_active()))
+		{
+			post_voice_event(voice, &event);
+		}
+	}
+
+	pthread_mutex_unlock(&voice_manage_mutex);
+}
+
+/**
+*   @brief  Control change. All notes off and all sound off release the program playing
+*			notes by note off events, and reset all controllers resets the pitch bend
+*			by a pitch bend event (applied at the message frame offset).
+*			Other controllers are handled by the MIDI control mapper.
+*   @param	channel	MIDI channel: 0-15 patc1-3: 16-18
+*	@param	num		controller number
+*	@param	val		controller value
+*   @return void
+*/
+void AdjSynth::midi_control_change(uint8_t channel, uint8_t num, uint8_t val)
+{
+	int prog = get_midi_channel_program(channel);
+	bool playing_notes[128];
+	int note;
+
+	return_if_true((prog < 0) || (prog >= _SYNTH_MAX_NUM_OF_PROGRAMS));
+
+	if ((num == _MIDI_CC_ALL_NOTES_OFF) || (num == _MIDI_CC_ALL_SOUND_OFF))
+	{
+		pthread_mutex_lock(&voice_manage_mutex);
+
+		for (note = 0; note < 128; note++)
+		{
+			playing_notes[note] = synth_polyphony->get_voice_note(note, prog) != -1;
+		}
+
+		pthread_mutex_unlock(&voice_manage_mutex);
+
+		for (note = 0; note < 128; note++)
+		{
+			if (playing_notes[note])
+			{
+				midi_play_note_off(channel, (uint8_t)note, 0);
+			}
+		}
+	}
+	else if (num == _MIDI_CC_RESET_ALL_CONTROLLERS)
+	{
+		midi_pitch_bend(channel, 0);
+	}
+}
+
 
 
 
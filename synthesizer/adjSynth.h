@@ -31,8 +31,13 @@
 
 void callback_audio_voice_update(int voice_num);
 void callback_audio_update_cycle_end_tasks(int param);
+void callback_settings_params_batch_commit(int prog);
+void callback_settings_params_changed(int prog);
 //void callback_voice_end(int voice);
 
+// Pitch bend range (up and down)
+#define _ADJ_SYNTH_PITCH_BEND_RANGE_SEMITONES	2
+
 int set_patch_settings_default_params_callback_wrapper(_setting_params_t *params, int prog);
 
 class AdjSynth
@@ -55,7 +60,9 @@ public:
 	int start_audio(int driver, int samp_rate, int block_size);
 	int stop_audio();
 	
-	DSP_Voice *get_original_main_dsp_voices(int voice);
+	SynthVoice *get_program_bound_voice(int prog, int voice);
+	void update_program_voices_params(int prog);
+	void release_program_voice(int voice);
 	
 	int init_synth_settings_params(_setting_params_t *settings_params);
 	
@@ -80,6 +87,7 @@ public:
 	void set_active_sketch(int ask);
 	int get_active_sketch();
 	int copy_sketch(int src_sk, int dest_sk);
+	void hold_programs_patch_snapshots(bool hold);
 
 	void init_poly();
 	void init_jack();
@@ -140,6 +148,8 @@ public:
 	
 	void  midi_play_note_on(uint8_t channel, uint8_t byte2, uint8_t byte3, int voc = 0);
 	void  midi_play_note_off(uint8_t channel, uint8_t byte2, uint8_t byte3, int voc = 0);
+	void  midi_pitch_bend(uint8_t channel, int pitch);
+	void  midi_control_change(uint8_t channel, uint8_t num, uint8_t val);
 	
 	// UI callbacks intiations
 	void set_num_of_poly_disp_callback(int numv);
@@ -162,7 +172,8 @@ public:
 
 	
 	/** This pool of SynthVoice objects is run and controlled by the synthesizer.
-		Each of them is only a pointer to a SynthVoice object. */
+		The voices are shared by all programs: a free voice is bound to the played
+		program patch parameters and wavetables on note-on. */
 	static SynthVoice *synth_voice[_SYNTH_MAX_NUM_OF_VOICES];
 
 	SynthProgram *synth_program[_SYNTH_NUM_OF_PROGRAMS];
@@ -186,6 +197,12 @@ public:
 private:
 	
 	static AdjSynth *adj_synth;
+	
+	void post_voice_event(int voice, audio_voice_event_t *event);
+	int get_midi_channel_program(uint8_t channel);
+
+	/* Pitch bend frequency factor of each program (applied by note on and pitch bend events) */
+	float program_pitch_bend_factor[_SYNTH_MAX_NUM_OF_PROGRAMS];
 
 	/* Holds the AdjSynth patch parameters */	
 	_setting_params_t active_adj_synth_patch_params;
@@ -197,9 +214,6 @@ private:
 	/* Hammond percussion mode settings */
 	bool hammond_percussion_on, hammond_percussion_slow, hammond_percussion_soft, hammond_ercussion_3_rd;
 	
-	// Used to hold original voice settings to be reproduced when a dsp voice is disallocated by a voice program.
-	DSP_Voice *original_main_dsp_voices[_SYNTH_MAX_NUM_OF_VOICES] = { NULL };
-	
 	int sample_rate, audio_block_size, audio_driver_type;
 	
 	int num_of_voices;
@@ -313,6 +327,7 @@ int set_voice_block_osc_1_amp_modulation_lfo_num_cb(int lfon, int voice, int pro
 int set_voice_block_osc_1_amp_modulation_lfo_level_cb(int lfolev, int voice, int prog);
 int set_voice_block_osc_1_amp_modulation_env_num_cb(int envn, int voice, int prog);
 int set_voice_block_osc_1_amp_modulation_env_level_cb(int envlev, int voice, int prog);
+int set_osc_1_unison_mode_cb(int unimod, int prog);
 int set_voice_block_osc_1_unison_mod_cb(int unimod, int voice, int prog);
 int set_voice_block_osc_1_hammond_percussion_mode_cb(int pmode, int voice, int prog);
 int set_voice_block_osc_1_unison_level_1_cb(int level, int voice, int prog);
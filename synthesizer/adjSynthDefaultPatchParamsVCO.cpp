@@ -350,13 +350,13 @@ int AdjSynth::set_default_patch_parameters_vco(_setting_params_t *params, int pr
 				_OSC_UNISON_MODE_Cm7_CHORD,
 				_OSC_UNISON_MODE_12345678,
 				_PARAM_TYPE_ADJ_SYNTH_PATCH,
-				NULL,
+				set_osc_1_unison_mode_cb,
 				0,
 				num_of_voices - 1,
 				set_voice_block_osc_1_unison_mod_cb,
 				_SET_VALUE | _SET_MAX_VAL | _SET_MIN_VAL | 
 				_SET_TYPE | _SET_BLOCK_START_INDEX | 
-				_SET_BLOCK_STOP_INDEX | _SET_BLOCK_CALLBACK,
+				_SET_BLOCK_STOP_INDEX | _SET_CALLBACK | _SET_BLOCK_CALLBACK,
 				prog);
 	
 	res |= adj_synth_settings_manager->set_int_param
@@ -138,10 +138,8 @@ int AdjSynth::mso_event(int msoid, int eventid, int val, _setting_params_t *para
 			else if (eventid == _MSO_CALC_MORPHED_LUT)
 			{
 				synth_program[program]->mso_wtab->set_morphing_symetry(synth_program[program]->mso_wtab->get_morphing_symetry());
-				synth_program[program]->mso_wtab->calc_wtab(
-					synth_program[program]->mso_wtab->morphed_waveform_tab,
-					&synth_program[program]->mso_wtab->morphed_segment_lengths,
-					&synth_program[program]->mso_wtab->morphed_segment_positions);
+				// Calculated into a new table and switched by the PAD generator
+				synth_program[program]->request_pad_wavetable_generation(_PAD_GEN_JOB_MSO);
 			}
 			else if (eventid == _MSO_DETUNE_OCTAVE)
 			{
@@ -1,8 +1,11 @@
 /**
 *	@file		adjSynthEventsHandlingMixer.cpp
 *	@author		Nahum Budin
-*	@date		15_Nov-2019
-*	@version	1.0
+*	@date		17-Oct-2026
+*	@version	1.1
+*					1. Parameters set by identifiers.
+*
+*	@version	1.0		15_Nov-2019
 *	
 *	@brief		AdjHeart Synthesizer Mixer Events Handling
 *
@@ -27,7 +30,6 @@
 */
 int AdjSynth::midi_mixer_event(int mixid, int eventid, int val, _setting_params_t *params)
 {
-	char keyString[128];
 	int i;
 
 	switch (eventid)
@@ -49,10 +51,9 @@ int AdjSynth::midi_mixer_event(int mixid, int eventid, int val, _setting_params_
 		case _MIXER_CHAN_15_LEVEL:
 		case _MIXER_CHAN_16_LEVEL:
 			
-			sprintf(keyString, "adjsynth.mixer_channel_%i.level", eventid - _MIXER_CHAN_1_LEVEL + 1);
 			adj_synth_settings_manager->set_int_param_value
 				(params,
-				string(keyString),
+				(settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_LEVEL + eventid - _MIXER_CHAN_1_LEVEL),
 				val,
 				_EXEC_CALLBACK,
 				eventid - _MIXER_CHAN_1_LEVEL);
@@ -62,9 +63,8 @@ int AdjSynth::midi_mixer_event(int mixid, int eventid, int val, _setting_params_
 		case _MIXER_ALL_LEVEL:
 			for (i = 0; i < 16; i++)
 			{
-				sprintf(keyString, "adjsynth.mixer_channel_%i.level", i + 1);
 				adj_synth_settings_manager->set_int_param_value(params,
-													  string(keyString),
+													  (settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_LEVEL + i),
 													  val,
 													  _EXEC_CALLBACK,
 													  i);
@@ -88,10 +88,9 @@ int AdjSynth::midi_mixer_event(int mixid, int eventid, int val, _setting_params_
 		case _MIXER_CHAN_15_PAN:
 		case _MIXER_CHAN_16_PAN:
 			
-			sprintf(keyString, "adjsynth.mixer_channel_%i.pan", eventid - _MIXER_CHAN_1_PAN + 1);
 			adj_synth_settings_manager->set_int_param_value
 				(params,
-				string(keyString),
+				(settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_PAN + eventid - _MIXER_CHAN_1_PAN),
 				val,
 				_EXEC_CALLBACK,
 				eventid - _MIXER_CHAN_1_PAN);
@@ -101,9 +100,8 @@ int AdjSynth::midi_mixer_event(int mixid, int eventid, int val, _setting_params_
 		case _MIXER_ALL_PAN:
 			for (i = 0; i < 16; i++)
 			{
-				sprintf(keyString, "adjsynth.mixer_channel_%i.pan", i + 1);
 				adj_synth_settings_manager->set_int_param_value(params,
-													  string(keyString),
+													  (settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_PAN + i),
 													  val,
 													  _EXEC_CALLBACK,
 													  i);
@@ -127,10 +125,9 @@ int AdjSynth::midi_mixer_event(int mixid, int eventid, int val, _setting_params_
 		case _MIXER_CHAN_15_SEND:
 		case _MIXER_CHAN_16_SEND:
 			
-			sprintf(keyString, "adjsynth.mixer_channel_%i.send", eventid - _MIXER_CHAN_1_SEND + 1);
 			adj_synth_settings_manager->set_int_param_value
 				(params,
-				string(keyString),
+				(settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_SEND + eventid - _MIXER_CHAN_1_SEND),
 				val,
 				_EXEC_CALLBACK,
 				eventid - _MIXER_CHAN_1_SEND);
@@ -140,9 +137,8 @@ int AdjSynth::midi_mixer_event(int mixid, int eventid, int val, _setting_params_
 		case _MIXER_ALL_SEND:
 			for (i = 0; i < 16; i++)
 			{
-				sprintf(keyString, "adjsynth.mixer_channel_%i.send", i + 1);
 				adj_synth_settings_manager->set_int_param_value(params,
-													  string(keyString),
+													  (settings_param_id_t)(_PARAM_ID_MIXER_CHANNEL_1_SEND + i),
 													  val,
 													  _EXEC_CALLBACK,
 													  i);
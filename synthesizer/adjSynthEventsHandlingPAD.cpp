@@ -339,7 +339,7 @@ int AdjSynth::pad_event(int padid, int eventid, int val, _setting_params_t *para
 	else if (eventid == _PAD_GENERATE)
 	{
 //		AdjSynth::get_instance()->synthPADcreator->getprofile();
-		synth_program[program]->synth_pad_creator->generate_wavetable(synth_program[program]->program_wavetable);
+		synth_program[program]->request_pad_wavetable_generation();
 
 	}
 	else if (eventid == _PAD_SHAPE_CUTOFF)
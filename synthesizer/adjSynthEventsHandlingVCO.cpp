@@ -307,7 +307,7 @@ int AdjSynth::vco_event(int vcoid, int eventid, int val, _setting_params_t *para
 					(params,
 					"adjsynth.osc1.unison_mode",
 					val,
-					_EXEC_BLOCK_CALLBACK,
+					_EXEC_CALLBACK | _EXEC_BLOCK_CALLBACK,
 					program);
 			}
 			break;
@@ -0,0 +1,497 @@
+/**
+*	@file		adjSynthPADcache.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.1
+*					1. Cache directory size limit (least recently used files are deleted).
+*
+*	@version	1.0		17-Oct-2026
+*
+*	@brief		Content addressed cache of generated PAD wavetables.
+*
+*				Each wavetable in use is held once, by its parameters key, with a
+*				reference count (one reference per program playing it).
+*				A wavetable that is not in use is looked for in the cache directory
+*				(file name is the key) and memory mapped read-only (pre-faulted and
+*				locked before it is published); a generated
+*				wavetable is written to the cache directory (to a temporary file
+*				that is renamed, so a partial file is never mapped).
+*				When the cache directory exceeds its size limit, the least recently
+*				used (mapped or written) files are deleted; a deleted file that is
+*				mapped stays valid until it is unmapped.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+
+#include "adjSynthPADcache.h"
+#include "../libAdjHeartModSynth_2.h"
+#include "../utils/utils.h"
+
+SynthPADcache *SynthPADcache::pad_cache_instance = NULL;
+
+/**
+*   @brief  Create a SynthPADcache object instance.
+*   @param  none
+*   @return none
+*/
+SynthPADcache::SynthPADcache()
+{
+	pthread_mutex_init(&cache_mutex, NULL);
+	max_size_mb = _PAD_CACHE_DEFAULT_MAX_SIZE_MB;
+	set_cache_dir(std::string(_ADJ_DEFAULT_PATCHES_DIR) + "/" + _PAD_CACHE_DIR_NAME);
+}
+
+SynthPADcache::~SynthPADcache()
+{
+	for (std::map<uint64_t, pad_cache_entry_t>::iterator it = entries.begin(); it != entries.end(); ++it)
+	{
+		free_entry(&it->second);
+	}
+	entries.clear();
+
+	pthread_mutex_destroy(&cache_mutex);
+}
+
+/**
+*   @brief  Return the SynthPADcache instance (created on first call).
+*   @param  none
+*   @return a pointer to the SynthPADcache instance
+*/
+SynthPADcache *SynthPADcache::get_instance()
+{
+	if (pad_cache_instance == NULL)
+	{
+		pad_cache_instance = new SynthPADcache();
+	}
+
+	return pad_cache_instance;
+}
+
+/**
+*   @brief  Set the cache directory (created if not exists).
+*   @param  path	cache directory path
+*   @return 0 if OK; -1 if the directory could not be created
+*/
+int SynthPADcache::set_cache_dir(const std::string &path)
+{
+	int res = 0;
+
+	pthread_mutex_lock(&cache_mutex);
+
+	cache_dir = path;
+	if ((mkdir(cache_dir.c_str(), 0755) != 0) && (errno != EEXIST))
+	{
+		fprintf(stderr, "PAD cache: unable to create %s\n", cache_dir.c_str());
+		res = -1;
+	}
+
+	pthread_mutex_unlock(&cache_mutex);
+
+	return res;
+}
+
+/**
+*   @brief  Return the cache directory.
+*   @param  none
+*   @return cache directory path
+*/
+std::string SynthPADcache::get_cache_dir()
+{
+	std::string dir;
+
+	pthread_mutex_lock(&cache_mutex);
+	dir = cache_dir;
+	pthread_mutex_unlock(&cache_mutex);
+
+	return dir;
+}
+
+/**
+*   @brief  Set the cache directory size limit.
+*   @param  size_mb	size limit (MB)
+*   @return 0 if OK; -1 if size is out of range
+*/
+int SynthPADcache::set_max_size_mb(int size_mb)
+{
+	return_val_if_true(size_mb < 1, -1);
+
+	pthread_mutex_lock(&cache_mutex);
+	max_size_mb = size_mb;
+	trim_dir();
+	pthread_mutex_unlock(&cache_mutex);
+
+	return 0;
+}
+
+/**
+*   @brief  Return the cache directory size limit.
+*   @param  none
+*   @return size limit (MB)
+*/
+int SynthPADcache::get_max_size_mb()
+{
+	int size_mb;
+
+	pthread_mutex_lock(&cache_mutex);
+	size_mb = max_size_mb;
+	pthread_mutex_unlock(&cache_mutex);
+
+	return size_mb;
+}
+
+/**
+*   @brief  Return the cache file path of a wavetable key.
+*   @param  key	wavetable key
+*   @return cache file path
+*/
+std::string SynthPADcache::get_file_path(uint64_t key)
+{
+	char name[32];
+
+	snprintf(name, sizeof(name), "/%016llx" _PAD_CACHE_FILE_EXTENSION, (unsigned long long)key);
+
+	return cache_dir + name;
+}
+
+/**
+*   @brief  Acquire a wavetable by its key: a wavetable in use is shared,
+*			otherwise the cache file is mapped. Must be released by release().
+*   @param  key		wavetable key
+*   @param  size	wavetable length (samples)
+*   @return a pointer to the Wavetable; NULL if not cached
+*/
+Wavetable *SynthPADcache::acquire(uint64_t key, int size)
+{
+	std::map<uint64_t, pad_cache_entry_t>::iterator it;
+	pad_cache_entry_t entry;
+	Wavetable *wt = NULL;
+
+	if (key == 0)
+	{
+		return NULL;
+	}
+
+	pthread_mutex_lock(&cache_mutex);
+
+	it = entries.find(key);
+	if (it != entries.end())
+	{
+		it->second.ref_count++;
+		wt = it->second.wavetable;
+	}
+	else
+	{
+		wt = map_file(key, size, &entry);
+		if (wt != NULL)
+		{
+			entries[key] = entry;
+		}
+	}
+
+	pthread_mutex_unlock(&cache_mutex);
+
+	return wt;
+}
+
+/**
+*   @brief  Add a generated (heap allocated) wavetable to the cache and write its
+*			cache file. The cache takes ownership of the wavetable.
+*			If a wavetable of the same key is already in use, the given one is
+*			deleted and the one in use is shared.
+*   @param  key		wavetable key (0: not cacheable)
+*   @param  wt		a pointer to a generated Wavetable (new[] allocated samples)
+*   @return a pointer to the acquired Wavetable
+*/
+Wavetable *SynthPADcache::insert(uint64_t key, Wavetable *wt)
+{
+	std::map<uint64_t, pad_cache_entry_t>::iterator it;
+	pad_cache_entry_t entry;
+
+	if ((key == 0) || (wt == NULL))
+	{
+		return wt;
+	}
+
+	pthread_mutex_lock(&cache_mutex);
+
+	it = entries.find(key);
+	if (it != entries.end())
+	{
+		it->second.ref_count++;
+		delete[] wt->samples;
+		delete wt;
+		wt = it->second.wavetable;
+	}
+	else
+	{
+		if (write_file(key, wt) == 0)
+		{
+			trim_dir();
+		}
+
+		entry.wavetable = wt;
+		entry.ref_count = 1;
+		entry.mapped = NULL;
+		entry.mapped_length = 0;
+		entries[key] = entry;
+	}
+
+	pthread_mutex_unlock(&cache_mutex);
+
+	return wt;
+}
+
+/**
+*   @brief  Release a wavetable acquired from the cache. The wavetable is freed
+*			(or unmapped) when no longer in use.
+*   @param  wt	a pointer to the Wavetable
+*   @return 0 if released; -1 if the wavetable is not held by the cache
+*/
+int SynthPADcache::release(Wavetable *wt)
+{
+	std::map<uint64_t, pad_cache_entry_t>::iterator it;
+	int res = -1;
+
+	pthread_mutex_lock(&cache_mutex);
+
+	for (it = entries.begin(); it != entries.end(); ++it)
+	{
+		if (it->second.wavetable == wt)
+		{
+			if (--it->second.ref_count <= 0)
+			{
+				free_entry(&it->second);
+				entries.erase(it);
+			}
+			res = 0;
+			break;
+		}
+	}
+
+	pthread_mutex_unlock(&cache_mutex);
+
+	return res;
+}
+
+/**
+*   @brief  Return the number of wavetables in use.
+*   @param  none
+*   @return number of wavetables in use
+*/
+int SynthPADcache::get_num_of_entries()
+{
+	int num;
+
+	pthread_mutex_lock(&cache_mutex);
+	num = (int)entries.size();
+	pthread_mutex_unlock(&cache_mutex);
+
+	return num;
+}
+
+/**
+*   @brief  Map a wavetable cache file read-only.
+*   @param  key		wavetable key
+*   @param  size	wavetable length (samples)
+*   @param	entry	a pointer to the cache entry to fill
+*   @return a pointer to the mapped Wavetable; NULL if no valid cache file
+*/
+Wavetable *SynthPADcache::map_file(uint64_t key, int size, pad_cache_entry_t *entry)
+{
+	std::string path = get_file_path(key);
+	size_t length = _PAD_CACHE_FILE_HEADER_SIZE + (size_t)size * sizeof(float);
+	pad_cache_file_header_t *header;
+	struct stat st;
+	void *mapped;
+	int fd;
+
+	fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return NULL;
+	}
+
+	if ((fstat(fd, &st) != 0) || ((size_t)st.st_size != length))
+	{
+		close(fd);
+		return NULL;
+	}
+
+	// Mark as recently used
+	futimens(fd, NULL);
+
+	// The pages are read in now, and locked, so the audio threads that play the
+	// published wavetable never take a page fault (munmap() unlocks them)
+	mapped = mmap(NULL, length, PROT_READ, MAP_SHARED | MAP_POPULATE, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED)
+	{
+		return NULL;
+	}
+
+	if (mlock(mapped, length) != 0)
+	{
+		// e.g. RLIMIT_MEMLOCK is too low: keep the pages resident as long as possible
+		fprintf(stderr, "PAD cache: mlock failed (%s); wavetable is not locked\n", strerror(errno));
+		madvise(mapped, length, MADV_WILLNEED);
+	}
+
+	header = (pad_cache_file_header_t *)mapped;
+	if ((header->magic != _PAD_CACHE_FILE_MAGIC) || (header->version != _PAD_CACHE_FILE_VERSION) ||
+		(header->key != key) || (header->size != size))
+	{
+		fprintf(stderr, "PAD cache: ignoring invalid cache file %s\n", path.c_str());
+		munmap(mapped, length);
+		return NULL;
+	}
+
+	entry->wavetable = new Wavetable();
+	entry->wavetable->size = size;
+	entry->wavetable->base_freq = header->base_freq;
+	// Read-only: published wavetables are never modified
+	entry->wavetable->samples = (float *)((uint8_t *)mapped + _PAD_CACHE_FILE_HEADER_SIZE);
+	entry->ref_count = 1;
+	entry->mapped = mapped;
+	entry->mapped_length = length;
+
+	return entry->wavetable;
+}
+
+/**
+*   @brief  Write a wavetable cache file.
+*   @param  key		wavetable key
+*   @param  wt		a pointer to the Wavetable
+*   @return 0 if OK; -1 otherwise
+*/
+int SynthPADcache::write_file(uint64_t key, Wavetable *wt)
+{
+	std::string path = get_file_path(key);
+	std::string tmp_path = path + ".tmp";
+	pad_cache_file_header_t header;
+	FILE *file;
+	bool ok;
+
+	memset(&header, 0, sizeof(header));
+	header.magic = _PAD_CACHE_FILE_MAGIC;
+	header.version = _PAD_CACHE_FILE_VERSION;
+	header.key = key;
+	header.size = wt->size;
+	header.base_freq = wt->base_freq;
+
+	file = fopen(tmp_path.c_str(), "wb");
+	if (file == NULL)
+	{
+		return -1;
+	}
+
+	ok = (fwrite(&header, sizeof(header), 1, file) == 1) &&
+		 (fwrite(wt->samples, sizeof(float), wt->size, file) == (size_t)wt->size);
+	ok = (fclose(file) == 0) && ok;
+
+	if (!ok || (rename(tmp_path.c_str(), path.c_str()) != 0))
+	{
+		fprintf(stderr, "PAD cache: unable to write %s\n", path.c_str());
+		unlink(tmp_path.c_str());
+		return -1;
+	}
+
+	return 0;
+}
+
+// Least recently used files first
+static bool pad_cache_file_less_recently_used(const pad_cache_file_t &a, const pad_cache_file_t &b)
+{
+	return (a.last_used.tv_sec < b.last_used.tv_sec) ||
+		((a.last_used.tv_sec == b.last_used.tv_sec) && (a.last_used.tv_nsec < b.last_used.tv_nsec));
+}
+
+/**
+*   @brief  Delete the least recently used cache files until the cache directory
+*			size is within its limit.
+*			Must be called with the cache mutex locked.
+*   @param  none
+*   @return void
+*/
+void SynthPADcache::trim_dir()
+{
+	std::vector<pad_cache_file_t> files;
+	std::string name, extension = _PAD_CACHE_FILE_EXTENSION;
+	pad_cache_file_t file;
+	struct dirent *dir_entry;
+	struct stat st;
+	uint64_t total_size = 0, max_size = (uint64_t)max_size_mb * 1024 * 1024;
+	DIR *dir;
+
+	dir = opendir(cache_dir.c_str());
+	if (dir == NULL)
+	{
+		return;
+	}
+
+	while ((dir_entry = readdir(dir)) != NULL)
+	{
+		name = dir_entry->d_name;
+		if ((name.size() <= extension.size()) ||
+			(name.compare(name.size() - extension.size(), extension.size(), extension) != 0))
+		{
+			continue;
+		}
+
+		file.path = cache_dir + "/" + name;
+		if ((stat(file.path.c_str(), &st) != 0) || !S_ISREG(st.st_mode))
+		{
+			continue;
+		}
+
+		file.last_used = st.st_mtim;
+		file.size = (size_t)st.st_size;
+		total_size += file.size;
+		files.push_back(file);
+	}
+
+	closedir(dir);
+
+	if (total_size <= max_size)
+	{
+		return;
+	}
+
+	std::sort(files.begin(), files.end(), pad_cache_file_less_recently_used);
+
+	for (size_t i = 0; (i < files.size()) && (total_size > max_size); i++)
+	{
+		if (unlink(files[i].path.c_str()) == 0)
+		{
+			total_size -= files[i].size;
+		}
+	}
+}
+
+/**
+*   @brief  Free (or unmap) a cache entry wavetable.
+*   @param  entry	a pointer to the cache entry
+*   @return void
+*/
+void SynthPADcache::free_entry(pad_cache_entry_t *entry)
+{
+	if (entry->mapped != NULL)
+	{
+		munmap(entry->mapped, entry->mapped_length);
+	}
+	else
+	{
+		delete[] entry->wavetable->samples;
+	}
+
+	delete entry->wavetable;
+	entry->wavetable = NULL;
+}
@@ -0,0 +1,101 @@
+/**
+*	@file		adjSynthPADcache.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.1
+*					1. Cache directory size limit (least recently used files are deleted).
+*
+*	@version	1.0		17-Oct-2026
+*
+*	@brief		Content addressed cache of generated PAD wavetables.
+*				A PAD wavetable is a pure function of the PAD creator parameters;
+*				generated wavetables are stored in a cache directory by their
+*				parameters key and memory mapped (read-only) when requested again.
+*				Programs that use the same PAD parameters share one wavetable.
+*/
+
+#ifndef _ADJ_SYNTH_PAD_CACHE
+#define _ADJ_SYNTH_PAD_CACHE
+
+#include <stdint.h>
+#include <pthread.h>
+#include <string>
+#include <map>
+#include <vector>
+
+#include "../dsp/dspWavetable.h"
+
+#define _PAD_CACHE_DIR_NAME				"PADcache"
+#define _PAD_CACHE_FILE_EXTENSION		".padw"
+// Cache directory size limit; the least recently used files are deleted above it
+#define _PAD_CACHE_DEFAULT_MAX_SIZE_MB	256
+#define _PAD_CACHE_FILE_MAGIC			0x57444150		// "PADW"
+#define _PAD_CACHE_FILE_VERSION			1
+// Samples start offset in a cache file
+#define _PAD_CACHE_FILE_HEADER_SIZE		64
+
+typedef struct pad_cache_file_header
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	int32_t size;
+	float base_freq;
+	uint8_t reserved[_PAD_CACHE_FILE_HEADER_SIZE - 24];
+} pad_cache_file_header_t;
+
+typedef struct pad_cache_entry
+{
+	Wavetable *wavetable;
+	int ref_count;
+	// Mapped cache file (NULL if the samples are heap allocated)
+	void *mapped;
+	size_t mapped_length;
+} pad_cache_entry_t;
+
+typedef struct pad_cache_file
+{
+	std::string path;
+	// Last used (cache files modification time is updated when mapped)
+	struct timespec last_used;
+	size_t size;
+} pad_cache_file_t;
+
+class SynthPADcache
+{
+public:
+	~SynthPADcache();
+
+	static SynthPADcache *get_instance();
+
+	int set_cache_dir(const std::string &path);
+	std::string get_cache_dir();
+
+	int set_max_size_mb(int size_mb);
+	int get_max_size_mb();
+
+	Wavetable *acquire(uint64_t key, int size);
+	Wavetable *insert(uint64_t key, Wavetable *wt);
+	int release(Wavetable *wt);
+
+	int get_num_of_entries();
+
+private:
+	SynthPADcache();
+
+	Wavetable *map_file(uint64_t key, int size, pad_cache_entry_t *entry);
+	int write_file(uint64_t key, Wavetable *wt);
+	void free_entry(pad_cache_entry_t *entry);
+	void trim_dir();
+	std::string get_file_path(uint64_t key);
+
+	static SynthPADcache *pad_cache_instance;
+
+	pthread_mutex_t cache_mutex;
+	std::string cache_dir;
+	int max_size_mb;
+	// Wavetables in use, by key
+	std::map<uint64_t, pad_cache_entry_t> entries;
+};
+
+#endif
@@ -22,6 +22,12 @@
 
 const int num_of_pad_harmonies = _PAD_NUM_OF_HAROMONIES;
 
+// Wavetable key hash (FNV-1a 64) - bump the version when the generation algorithm
+// (or _PAD_PHASE_SEED) changes
+#define _PAD_KEY_FNV_OFFSET_BASIS	0xcbf29ce484222325ULL
+#define _PAD_KEY_FNV_PRIME			0x100000001b3ULL
+#define _PAD_KEY_ALGORITHM_VERSION	1
+
 /**
 * @brief	intialize the PAD creator
 * @param	wavetable_buff	a pointer to a Wavetable object
@@ -30,7 +36,9 @@ const int num_of_pad_harmonies = _PAD_NUM_OF_HAROMONIES;
 * @return	void.
 */
 SynthPADcreator::SynthPADcreator(Wavetable *wavetable_buff, int size, int samp_rate)
-{	
+	: phase_prng(_PAD_PHASE_SEED)
+{
+	pthread_mutex_init(&generate_mutex, NULL);
 	init(wavetable_buff, size, samp_rate);
 }
 
@@ -70,7 +78,8 @@ void SynthPADcreator::init(Wavetable *wavetable_buff, int size, int samp_rate)
 	base_harmony_bandwidth = 500.f;
 	harmony_shape = _PAD_SHAPE_RECTANGULAR;
 	harmony_shape_cutoff = _PAD_SHAPE_CUTOFF_FULL;
-	spectrum_length = wavetable->size / 2;
+	wavetable_size = wavetable->size;
+	spectrum_length = wavetable_size / 2;
 	set_base_note(wavetable, _PAD_DEFAULT_BASE_NOTE);
 	harmonies_levels[0] = 1.f;
 	for (int i = 1; i < _PAD_NUM_OF_HAROMONIES; i++)
@@ -82,7 +91,7 @@ void SynthPADcreator::init(Wavetable *wavetable_buff, int size, int samp_rate)
 
 	base_harmony_bandwidth = 500.f;
 
-	spectrum = (float*)malloc(spectrum_length * sizeof(float));
+	spectrum = new float[spectrum_length];
 }
 
 SynthPADcreator::~SynthPADcreator()
@@ -97,6 +106,8 @@ SynthPADcreator::~SynthPADcreator()
 	{
 		delete[] spectrum;
 	}
+
+	pthread_mutex_destroy(&generate_mutex);
 }
 
 /**
@@ -263,72 +274,42 @@ float SynthPADcreator::get_harmonies_detune() { return harmonies_detune; }
 
 /**
 * @brief	set wavetable buffer length (1<<(15+len). 
-*			(deletes prev table and allocates a new one)
-* param		wt	a pointer to a wave table object of type Wavetable
+*			The played wavetable is not modified: the new length applies
+*			to the next generated wavetable.
 * @param	int len _PAD_QUALITY_32K - _PAD_QUALITY_1024K (0-5).
 * @return	length (samples) if OK; -1 if params out of range.
 */
-int SynthPADcreator::set_wavetable_length(Wavetable *wt, int len)
+int SynthPADcreator::set_wavetable_length(int len)
 {
-	if (wt == NULL)
-	{
-		return -1;
-	}
-	
 	if ((len >= _PAD_QUALITY_32K) && (len <= _PAD_QUALITY_1024K))
 	{
-		delete[] wt->samples;
-		//	delete(wt);
-		//	wt = new Wavetable();
-		wt->size = (1 << (15 + len));
-		wt->samples = new float[wt->size];
-		wt->samples[0] = 0.0f;
-		wt->base_freq = _PAD_DEFAULT_BASE_NOTE_FREQ;
+		__atomic_store_n(&wavetable_size, (1 << (15 + len)), __ATOMIC_RELAXED);
 		
-		if (spectrum != NULL)
-		{
-			delete[] spectrum;
-		}
-
-		spectrum_length = wt->size / 2;
-		spectrum = (float*)malloc(spectrum_length * sizeof(float));
-		
-		return wt->size;
+		return wavetable_size;
 	}
 
 	return -1;
 }
 
 /**
-* @brief	Returns wavetable buffer length (1<<(15+len). 
-* param		wt	a pointer to a wave table object of type Wavetable
-* @return	length (samples) if OK; -1 if parameter is NULL.
+* @brief	Returns the length of the next generated wavetable (1<<(15+len). 
+* param		none
+* @return	length (samples).
 */
-int SynthPADcreator::get_wavetable_length(Wavetable *wt) 
+int SynthPADcreator::get_wavetable_length() 
 { 
-	if (wt == NULL)
-	{
-		return -1;
-	}
-	else 
-	{
-		return wavetable->size; 
-	}
+	return __atomic_load_n(&wavetable_size, __ATOMIC_RELAXED); 
 }
 
 /**
 * @brief	Sets the wavetable base note. 
 * param		wt	a pointer to a wave table object of type Wavetable
+*			(NULL: applies to the next generated wavetable only)
 * @param	note  _PAD_BASE_NOTE_C2 - _PAD_BASE_NOTE_G6 (0-9).
 * @return	length (samples) if OK; -1 if params out of range.
 */
 int SynthPADcreator::set_base_note(Wavetable *wt, int note)
 {
-	if (wt == NULL)
-	{
-		return -1;
-	}
-	
 	if ((note >= _PAD_BASE_NOTE_C2) && (note <= _PAD_BASE_NOTE_G6))
 	{
 		base_note = note;
@@ -351,16 +332,12 @@ int SynthPADcreator::get_base_note() { return base_note; }
 /**
 * @brief	Sets the wavetable base frequency based on given base-note. 
 * param		wt	a pointer to a wave table object of type Wavetable
+*			(NULL: applies to the next generated wavetable only)
 * @param	base-note  _PAD_BASE_NOTE_C2 - _PAD_BASE_NOTE_G6 (0-9).
 * @return	base-note frequency (Hz) if OK; -1 if params out of range.
 */
 float SynthPADcreator::set_base_frequency(Wavetable *wt, int base_note)
 {
-	if (wt == NULL)
-	{
-		return -1;
-	}
-	
 	if ((base_note >= _PAD_BASE_NOTE_C2) && (base_note <= _PAD_BASE_NOTE_G6))
 	{
 		// C2 65.406Hz
@@ -372,7 +349,10 @@ float SynthPADcreator::set_base_frequency(Wavetable *wt, int base_note)
 		}
 	}
 
-	wt->base_freq = base_frequency;
+	if (wt != NULL)
+	{
+		wt->base_freq = base_frequency;
+	}
 
 	return base_frequency;
 }
@@ -384,6 +364,51 @@ float SynthPADcreator::set_base_frequency(Wavetable *wt, int base_note)
 */
 float SynthPADcreator::get_base_frequency() { return base_frequency; }
 
+/**
+* @brief	Returns a key that identifies the wavetable generated with the current
+*			parameters: a hash of all the parameters the wavetable depends on.
+* param		size	wavetable length (samples)
+* @return	wavetable key.
+*/
+uint64_t SynthPADcreator::get_wavetable_key(int size)
+{
+	uint64_t hash = _PAD_KEY_FNV_OFFSET_BASIS;
+	struct
+	{
+		int32_t version;
+		int32_t size;
+		int32_t sample_rate;
+		int32_t base_note;
+		int32_t harmony_shape;
+		int32_t harmony_shape_cutoff;
+		float base_harmony_bandwidth;
+		float harmonies_detune;
+		float harmonies_levels[_PAD_NUM_OF_HAROMONIES];
+		uint32_t global_seed;
+	} key_params;
+	const uint8_t *bytes = (const uint8_t *)&key_params;
+
+	memset(&key_params, 0, sizeof(key_params));
+	key_params.version = _PAD_KEY_ALGORITHM_VERSION;
+	key_params.size = size;
+	key_params.sample_rate = sample_rate;
+	key_params.base_note = base_note;
+	key_params.harmony_shape = harmony_shape;
+	key_params.harmony_shape_cutoff = harmony_shape_cutoff;
+	key_params.base_harmony_bandwidth = base_harmony_bandwidth;
+	key_params.harmonies_detune = harmonies_detune;
+	memcpy(key_params.harmonies_levels, harmonies_levels, sizeof(harmonies_levels));
+	// Phases generator sequence depends also on the global seed
+	key_params.global_seed = DSP_Prng::get_global_seed();
+
+	for (size_t i = 0; i < sizeof(key_params); i++)
+	{
+		hash = (hash ^ bytes[i]) * _PAD_KEY_FNV_PRIME;
+	}
+
+	return hash;
+}
+
 /**
 * @brief	Returns the profile size. 
 * param		none
@@ -553,28 +578,45 @@ void SynthPADcreator::generate_spectrum_bandwidth_mode(
 }
 
 /**
-* @brief  Generates the wavetable
-* @param  wt	a pointer to a wave table object of type Wavetable
-* @return 0 if OK; -1; if wt is NULL; -2 wt size out of range or null data
+* @brief  Generates the wavetable (may be called from a background thread)
+* @param  wt		a pointer to a wave table object of type Wavetable
+* @param  cancel	if not NULL, generation is abandoned when set to true
+* @param  key		if not NULL, returns the generated wavetable key 
+*					(0 if parameters were changed while generating)
+* @return 0 if OK; -1; if wt is NULL; -2 wt size out of range or null data;
+*		  -3 if canceled
 */
-int SynthPADcreator::generate_wavetable(Wavetable *wt)
+int SynthPADcreator::generate_wavetable(Wavetable *wt, bool *cancel, uint64_t *key)
 {
 	int i;
+	uint64_t start_key;
 
 	if (wt == NULL)
 	{
 		return -1;
 	}
 
-	if ((wt->size <= 0) || (wt->samples == NULL))
+	if ((wt->size <= 0) || (wt->samples == NULL) || ((wt->size & (wt->size - 1)) != 0))
 	{
 		return -2;
 	}
 
+	pthread_mutex_lock(&generate_mutex);
+
+	start_key = get_wavetable_key(wt->size);
+	phase_prng.set_stream(_PAD_PHASE_SEED);
+
+	if (spectrum_length != wt->size / 2)
+	{
+		delete[] spectrum;
+		spectrum_length = wt->size / 2;
+		spectrum = new float[spectrum_length];
+	}
+
 	const float bwadjust = get_profile(&profile[0], profile_size);
 	
 	// prepare the IFFT
-	FFTwrapper *fft = new FFTwrapper(wavetable->size);
+	FFTwrapper *fft = new FFTwrapper(wt->size);
 	fft_t      *fftfreqs = new fft_t[spectrum_length];
 
 	generate_spectrum_bandwidth_mode(
@@ -588,11 +630,22 @@ int SynthPADcreator::generate_wavetable(Wavetable *wt)
 	//randomize the phases
 	for(i = 1 ; i < spectrum_length ; ++i) 
 	{
-		fftfreqs[i] = FFTpolar(spectrum[i], (float)RND * 2 * PI);
+		fftfreqs[i] = FFTpolar(spectrum[i], phase_prng.next_unipolar() * 2 * PI);
+	}
+
+	if ((cancel != NULL) && __atomic_load_n(cancel, __ATOMIC_ACQUIRE))
+	{
+		delete(fft);
+		delete[] fftfreqs;
+		pthread_mutex_unlock(&generate_mutex);
+		
+		return -3;
 	}
+	
 	//that's all; here is the only ifft for the whole sample;
 	//no windows are used ;-)
 	fft->freqs2smps(fftfreqs, wt->samples);
+	wt->base_freq = base_frequency;
 	//normalize(rms)
 	float rms = 0.0f;
 	for (int i = 0; i < wt->size; ++i)
@@ -613,6 +666,13 @@ int SynthPADcreator::generate_wavetable(Wavetable *wt)
 	//Cleanup
 	delete(fft);
 	delete[] fftfreqs;
+
+	if (key != NULL)
+	{
+		*key = (get_wavetable_key(wt->size) == start_key) ? start_key : 0;
+	}
+
+	pthread_mutex_unlock(&generate_mutex);
 	
 	return 0;
 }
@@ -15,7 +15,10 @@
 #ifndef _PAD_CREATOR
 #define _PAD_CREATOR
 
+#include <pthread.h>
+
 #include "../dsp/dspWavetable.h"
+#include "../dsp/dspPrng.h"
 #include "../libAdjHeartModSynth_2.h"
 
 extern const int numOfPadHarmonies;
@@ -25,6 +28,8 @@ extern const int numOfPadHarmonies;
 #define _PAD_MAX_WAVETABLE_SIZE	(1 << (15 + _PAD_QUALITY_1024K))
 #define _PAD_DEFAULT_BASE_NOTE	_PAD_BASE_NOTE_C3
 #define _PAD_DEFAULT_BASE_NOTE_FREQ	(float)(65.406f * powf(2.0f, ((float)_PAD_BASE_NOTE_C3 / 2)))
+// Random phases seed (fixed: a wavetable depends only on the PAD parameters)
+#define _PAD_PHASE_SEED				0x50ad
 
 //struct Wavetable;
 
@@ -56,8 +61,8 @@ public:
 	float set_harmonies_detune(float det);
 	float get_harmonies_detune();
 
-	int set_wavetable_length(Wavetable *wt = NULL, int len = _PAD_DEFAULT_WAVETABLE_SIZE);
-	int get_wavetable_length(Wavetable *wt = NULL);
+	int set_wavetable_length(int len = _PAD_QUALITY_128K);
+	int get_wavetable_length();
 
 	int set_base_note(Wavetable *wt = NULL, int note = _PAD_DEFAULT_BASE_NOTE);
 	int get_base_note();
@@ -73,7 +78,9 @@ public:
 
 	float get_profile(float *smp = NULL, int size = profile_size);
 
-	int generate_wavetable(Wavetable *wt = NULL);
+	uint64_t get_wavetable_key(int size);
+
+	int generate_wavetable(Wavetable *wt = NULL, bool *cancel = NULL, uint64_t *key = NULL);
 
 	static const int profile_size = 512;
 	
@@ -102,6 +109,8 @@ private:
 	float harmonies_levels[_PAD_NUM_OF_HAROMONIES];
 	float harmonies_detune;
 	int spectrum_length;
+	// Length of the next generated wavetable
+	int wavetable_size;
 	int base_note;
 	float base_frequency;
 
@@ -111,6 +120,11 @@ private:
 	Wavetable *wavetable;
 	
 	int sample_rate;
+
+	// Random phases generator (restarted from the phase seed on every generation)
+	DSP_Prng phase_prng;
+	// Serializes wavetables generation (spectrum buffer)
+	pthread_mutex_t generate_mutex;
 }
 ;
 
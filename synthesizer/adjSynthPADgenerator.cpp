@@ -0,0 +1,764 @@
+/**
+*	@file		adjSynthPADgenerator.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.1
+*					1. Parallel programs wavetables generation on a workers pool.
+*					2. MSO wavetables jobs.
+*					3. Batches (preset loading) with progress reporting.
+*					4. Batch commit callback (the preset patches are switched with
+*					   their wavetables).
+*
+*	@version	1.0		17-Oct-2026
+*
+*	@brief		Background programs wavetables (PAD and MSO) generator.
+*
+*				Generation requests are queued per program (a program is queued
+*				once, repeated requests are coalesced) and served by a pool of
+*				worker threads, one per core, running with the default (non
+*				real-time) scheduling, so they only use the cpu time left by the
+*				audio threads. Different programs are generated in parallel; a
+*				program is generated by one worker at a time.
+*				A new PAD wavetable is taken from the PAD cache or generated into a
+*				newly allocated buffer, and then published by an atomic exchange of
+*				the program wavetable pointer; the voices pick it up when their next
+*				audio block starts. The replaced wavetable is freed only after the
+*				audio update cycles that could still read it have ended.
+*				A request for a program that is being generated cancels the running
+*				(outdated) generation.
+*				While a batch is open (e.g. a preset is loaded), the results are held
+*				and all the batch programs wavetables are switched together when the
+*				batch jobs are all done; then the batch commit callback is called
+*				(e.g. the preset patches are switched).
+*				A new MSO wavetable is calculated into a new table that is published
+*				by an atomic exchange too, and the replaced table is retired the
+*				same way.
+*				Publishing is always done with the queue mutex locked, so results are
+*				published in their completion order.
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include "adjSynthPADgenerator.h"
+#include "adjSynthPADcache.h"
+#include "adjSynth.h"
+#include "../audio/audioManager.h"
+#include "../utils/FFTwrapper.h"
+
+SynthPADgenerator *SynthPADgenerator::pad_generator_instance = NULL;
+
+/**
+*   @brief  Create a SynthPADgenerator object instance and start its workers.
+*   @param  none
+*   @return none
+*/
+SynthPADgenerator::SynthPADgenerator()
+{
+	for (int prog = 0; prog < _SYNTH_MAX_NUM_OF_PROGRAMS; prog++)
+	{
+		pending_jobs[prog] = 0;
+		running[prog] = false;
+		cancel[prog] = false;
+		held_wavetables[prog] = NULL;
+		held_jobs[prog] = 0;
+	}
+
+	num_of_workers = 0;
+	num_of_running = 0;
+	stop_request = false;
+	batch_open = false;
+	batch_holding = false;
+	batch_committing = false;
+	batch_commit_callback_ptr = NULL;
+	requested_count = 0;
+	completed_count = 0;
+	progress_callback_ptr = NULL;
+
+	pthread_mutex_init(&queue_mutex, NULL);
+	pthread_cond_init(&request_cond, NULL);
+	pthread_cond_init(&idle_cond, NULL);
+
+	start_workers();
+}
+
+SynthPADgenerator::~SynthPADgenerator()
+{
+	stop_workers();
+
+	for (int prog = 0; prog < _SYNTH_MAX_NUM_OF_PROGRAMS; prog++)
+	{
+		if (held_wavetables[prog] != NULL)
+		{
+			free_wavetable(held_wavetables[prog]);
+		}
+	}
+
+	pthread_cond_destroy(&idle_cond);
+	pthread_cond_destroy(&request_cond);
+	pthread_mutex_destroy(&queue_mutex);
+}
+
+/**
+*   @brief  Return the SynthPADgenerator instance (created on first call).
+*   @param  none
+*   @return a pointer to the SynthPADgenerator instance
+*/
+SynthPADgenerator *SynthPADgenerator::get_instance()
+{
+	if (pad_generator_instance == NULL)
+	{
+		pad_generator_instance = new SynthPADgenerator();
+	}
+
+	return pad_generator_instance;
+}
+
+/**
+*   @brief  Start the worker threads, one per core (default scheduling - they
+*			must never preempt the audio threads).
+*   @param  none
+*   @return void
+*/
+void SynthPADgenerator::start_workers()
+{
+	int ret, num;
+	char name[16];
+
+	num = mod_synth_get_number_of_cores();
+	if (num > _SYNTH_MAX_NUM_OF_CORES)
+	{
+		num = _SYNTH_MAX_NUM_OF_CORES;
+	}
+
+	for (int w = 0; w < num; w++)
+	{
+		ret = pthread_create(&thread_ids[w], NULL, worker_thread, this);
+		if (ret != 0)
+		{
+			fprintf(stderr, "PAD generator: Unable to create worker %i\n", w);
+			break;
+		}
+
+		snprintf(name, sizeof(name), "pad_gen_wrk_%i", w);
+		pthread_setname_np(thread_ids[w], name);
+		num_of_workers++;
+	}
+}
+
+/**
+*   @brief  Stop and join the worker threads (running generations are canceled).
+*   @param  none
+*   @return void
+*/
+void SynthPADgenerator::stop_workers()
+{
+	if (num_of_workers == 0)
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&queue_mutex);
+	stop_request = true;
+	for (int prog = 0; prog < _SYNTH_MAX_NUM_OF_PROGRAMS; prog++)
+	{
+		if (running[prog])
+		{
+			__atomic_store_n(&cancel[prog], true, __ATOMIC_RELEASE);
+		}
+	}
+	pthread_cond_broadcast(&request_cond);
+	pthread_mutex_unlock(&queue_mutex);
+
+	for (int w = 0; w < num_of_workers; w++)
+	{
+		pthread_join(thread_ids[w], NULL);
+	}
+
+	num_of_workers = 0;
+}
+
+/**
+*   @brief  Return the number of worker threads.
+*   @param  none
+*   @return number of worker threads
+*/
+int SynthPADgenerator::get_num_of_workers() { return num_of_workers; }
+
+/**
+*   @brief  Request a program wavetables generation. Returns immediately.
+*			If the program is being generated, the running generation is canceled
+*			and restarted with the current parameters.
+*   @param  prog	program number
+*   @param	jobs	_PAD_GEN_JOB_PAD and/or _PAD_GEN_JOB_MSO
+*   @return 0 if OK; -1 if program number is out of range or no worker threads
+*/
+int SynthPADgenerator::request_generate(int prog, int jobs)
+{
+	return_val_if_true((prog < 0) || (prog >= _SYNTH_MAX_NUM_OF_PROGRAMS), -1);
+	return_val_if_true(num_of_workers == 0, -1);
+
+	pthread_mutex_lock(&queue_mutex);
+
+	if (running[prog] && (jobs & _PAD_GEN_JOB_PAD))
+	{
+		// Outdated - abandon it
+		__atomic_store_n(&cancel[prog], true, __ATOMIC_RELEASE);
+	}
+
+	if (pending_jobs[prog] == 0)
+	{
+		pending_programs.push_back(prog);
+		requested_count++;
+		pthread_cond_signal(&request_cond);
+	}
+	pending_jobs[prog] |= jobs;
+
+	pthread_mutex_unlock(&queue_mutex);
+
+	return 0;
+}
+
+/**
+*   @brief  Open a batch: the results of the following requests are held until
+*			the batch is ended and all its jobs are done, and then switched together.
+*   @param  none
+*   @return void
+*/
+void SynthPADgenerator::begin_batch()
+{
+	pthread_mutex_lock(&queue_mutex);
+	batch_open = true;
+	batch_holding = true;
+	pthread_mutex_unlock(&queue_mutex);
+}
+
+/**
+*   @brief  End a batch. Returns immediately; the batch results are switched
+*			when all its jobs are done (see register_progress_callback() and
+*			register_batch_commit_callback()).
+*   @param  none
+*   @return void
+*/
+void SynthPADgenerator::end_batch()
+{
+	func_ptr_void_int_int_t progress_callback = NULL;
+	func_ptr_void_void_t batch_commit_callback = NULL;
+	int done = 0, requested = 0;
+	
+	pthread_mutex_lock(&queue_mutex);
+
+	batch_open = false;
+	if (batch_holding && pending_programs.empty() && (num_of_running == 0))
+	{
+		// All the batch jobs are already done
+		batch_commit_callback = commit_batch();
+		
+		done = completed_count;
+		requested = completed_count;
+		progress_callback = progress_callback_ptr;
+		completed_count = 0;
+		requested_count = 0;
+		
+		pthread_cond_broadcast(&request_cond);
+		pthread_cond_broadcast(&idle_cond);
+	}
+
+	pthread_mutex_unlock(&queue_mutex);
+
+	if (batch_commit_callback != NULL)
+	{
+		end_batch_commit(batch_commit_callback);
+	}
+
+	if (progress_callback != NULL)
+	{
+		progress_callback(done, requested);
+	}
+}
+
+/**
+*   @brief  Register a callback function that reports the generation progress.
+*			Called from a worker thread each time a program is done.
+*   @param  ptr	a pointer to a function void foo(int done, int requested)
+*				(done == requested when all the requested programs are done)
+*   @return void
+*/
+void SynthPADgenerator::register_progress_callback(func_ptr_void_int_int_t ptr)
+{
+	pthread_mutex_lock(&queue_mutex);
+	progress_callback_ptr = ptr;
+	pthread_mutex_unlock(&queue_mutex);
+}
+
+/**
+*   @brief  Register a callback function that is called when a batch results were
+*			switched (from the thread that completed the batch; the generator is not
+*			idle until it returns).
+*   @param  ptr	a pointer to a function void foo()
+*   @return void
+*/
+void SynthPADgenerator::register_batch_commit_callback(func_ptr_void_void_t ptr)
+{
+	pthread_mutex_lock(&queue_mutex);
+	batch_commit_callback_ptr = ptr;
+	pthread_mutex_unlock(&queue_mutex);
+}
+
+/**
+*   @brief  Return true if generations are pending, running or held.
+*   @param  none
+*   @return true if busy
+*/
+bool SynthPADgenerator::is_busy()
+{
+	bool busy;
+
+	pthread_mutex_lock(&queue_mutex);
+	busy = !is_idle();
+	pthread_mutex_unlock(&queue_mutex);
+
+	return busy;
+}
+
+/**
+*   @brief  Return true if no generations are pending, running or held.
+*			Must be called with the queue mutex locked.
+*   @param  none
+*   @return true if idle
+*/
+bool SynthPADgenerator::is_idle()
+{
+	return pending_programs.empty() && (num_of_running == 0) && !batch_holding && !batch_committing;
+}
+
+/**
+*   @brief  Wait until all requested generations were completed and published
+*			(e.g. offline rendering after a program or preset change).
+*   @param  timeout_ms	maximum waiting time (mSec)
+*   @return true if idle; false if timed out
+*/
+bool SynthPADgenerator::wait_for_idle(int timeout_ms)
+{
+	struct timespec deadline;
+	int ret = 0;
+	bool idle;
+
+	clock_gettime(CLOCK_REALTIME, &deadline);
+	deadline.tv_sec += timeout_ms / 1000;
+	deadline.tv_nsec += (long)(timeout_ms % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L)
+	{
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	pthread_mutex_lock(&queue_mutex);
+
+	while (!is_idle() && (ret != ETIMEDOUT))
+	{
+		ret = pthread_cond_timedwait(&idle_cond, &queue_mutex, &deadline);
+	}
+
+	idle = is_idle();
+
+	pthread_mutex_unlock(&queue_mutex);
+
+	return idle;
+}
+
+/**
+*   @brief  Take the first queued program that is not being generated.
+*			Must be called with the queue mutex locked.
+*   @param  none
+*   @return program number; -1 if none
+*/
+int SynthPADgenerator::take_next_program()
+{
+	int prog;
+
+	for (std::deque<int>::iterator it = pending_programs.begin(); it != pending_programs.end(); ++it)
+	{
+		prog = *it;
+		if (!running[prog])
+		{
+			pending_programs.erase(it);
+			return prog;
+		}
+	}
+
+	return -1;
+}
+
+/**
+*   @brief  Get a program PAD wavetable from the PAD cache, or generate it into
+*			a new buffer (and add it to the cache).
+*   @param  prog	program number
+*   @param	new_wt	a pointer to the returned new Wavetable (NULL if none)
+*   @return 0 if OK; -3 if canceled; other negative values on errors
+*/
+int SynthPADgenerator::generate(int prog, Wavetable **new_wt)
+{
+	SynthProgram *program = AdjSynth::get_instance()->synth_program[prog];
+	SynthPADcache *pad_cache = SynthPADcache::get_instance();
+	Wavetable *wt;
+	uint64_t key;
+	int size, res;
+
+	*new_wt = NULL;
+	return_val_if_true((program == NULL) || (program->synth_pad_creator == NULL), -1);
+
+	size = program->synth_pad_creator->get_wavetable_length();
+	key = program->synth_pad_creator->get_wavetable_key(size);
+
+	wt = pad_cache->acquire(key, size);
+	if (wt == NULL)
+	{
+		wt = new Wavetable();
+		wt->size = size;
+		wt->base_freq = program->synth_pad_creator->get_base_frequency();
+		wt->samples = new float[wt->size];
+
+		res = program->synth_pad_creator->generate_wavetable(wt, &cancel[prog], &key);
+		if (res != 0)
+		{
+			if (res != -3)
+			{
+				fprintf(stderr, "PAD generator: program %i wavetable generation failed (%i)\n", prog, res);
+			}
+
+			delete[] wt->samples;
+			delete wt;
+
+			return res;
+		}
+
+		// Not cached if the parameters were changed while generating (key 0)
+		wt = pad_cache->insert(key, wt);
+	}
+
+	*new_wt = wt;
+
+	return 0;
+}
+
+/**
+*   @brief  Hold a program batch results. A previously held (never published)
+*			wavetable of the program is replaced.
+*			Must be called with the queue mutex locked.
+*   @param  prog	program number
+*   @param	wt		a pointer to the new Wavetable (NULL if none)
+*   @param	jobs	done jobs
+*   @return void
+*/
+void SynthPADgenerator::hold(int prog, Wavetable *wt, int jobs)
+{
+	if (wt != NULL)
+	{
+		if (held_wavetables[prog] != NULL)
+		{
+			free_wavetable(held_wavetables[prog]);
+		}
+		held_wavetables[prog] = wt;
+	}
+
+	held_jobs[prog] |= jobs;
+}
+
+/**
+*   @brief  Publish a program results: calculate its new MSO wavetable and switch
+*			to its new MSO and PAD wavetables. The replaced ones are queued to be freed.
+*			Must be called with the queue mutex locked.
+*   @param  prog	program number
+*   @param	wt		a pointer to the new Wavetable (NULL if none)
+*   @param	jobs	done jobs
+*   @return void
+*/
+void SynthPADgenerator::publish(int prog, Wavetable *wt, int jobs)
+{
+	SynthProgram *program = AdjSynth::get_instance()->synth_program[prog];
+	DSP_WaveformTab *mso_tab;
+	Wavetable *prev_wt;
+
+	if (program == NULL)
+	{
+		return;
+	}
+
+	if (jobs & _PAD_GEN_JOB_MSO)
+	{
+		// A small wavetable - calculated into a new table, never the played one
+		mso_tab = new DSP_WaveformTab(program->mso_wtab->get_wavetable_length());
+		program->mso_wtab->calc_segments_lengths(
+			&program->mso_wtab->morphed_segment_lengths,
+			&program->mso_wtab->morphed_segment_positions);
+		program->mso_wtab->calc_wtab(
+			mso_tab,
+			&program->mso_wtab->morphed_segment_lengths,
+			&program->mso_wtab->morphed_segment_positions);
+		replaced_mso_tabs.push_back(program->mso_wtab->publish_morphed_waveform_tab(mso_tab));
+	}
+
+	if (wt == NULL)
+	{
+		return;
+	}
+
+	if (wt == __atomic_load_n(&program->program_wavetable, __ATOMIC_ACQUIRE))
+	{
+		// Already playing this (shared) wavetable
+		free_wavetable(wt);
+		return;
+	}
+
+	prev_wt = program->publish_pad_wavetable(wt);
+	if (prev_wt != NULL)
+	{
+		replaced_wavetables.push_back(prev_wt);
+	}
+}
+
+/**
+*   @brief  Publish all the held batch results together.
+*			Must be called with the queue mutex locked.
+*   @param  none
+*   @return the batch commit callback to call by end_batch_commit() after the 
+*			queue mutex is unlocked; NULL if none
+*/
+func_ptr_void_void_t SynthPADgenerator::commit_batch()
+{
+	for (int prog = 0; prog < _SYNTH_MAX_NUM_OF_PROGRAMS; prog++)
+	{
+		if ((held_wavetables[prog] != NULL) || (held_jobs[prog] != 0))
+		{
+			publish(prog, held_wavetables[prog], held_jobs[prog]);
+			held_wavetables[prog] = NULL;
+			held_jobs[prog] = 0;
+		}
+	}
+
+	batch_holding = false;
+	batch_committing = (batch_commit_callback_ptr != NULL);
+
+	return batch_commit_callback_ptr;
+}
+
+/**
+*   @brief  Call the batch commit callback, and then mark the batch done.
+*			Must be called with the queue mutex unlocked.
+*   @param  batch_commit_callback	the callback returned by commit_batch()
+*   @return void
+*/
+void SynthPADgenerator::end_batch_commit(func_ptr_void_void_t batch_commit_callback)
+{
+	batch_commit_callback();
+
+	pthread_mutex_lock(&queue_mutex);
+
+	batch_committing = false;
+	if (is_idle())
+	{
+		completed_count = 0;
+		requested_count = 0;
+		pthread_cond_broadcast(&idle_cond);
+	}
+
+	pthread_mutex_unlock(&queue_mutex);
+}
+
+/**
+*   @brief  Free (or release to the PAD cache) replaced wavetables once no
+*			voice can still play them:
+*			voices sample the published wavetable pointer when an audio block
+*			starts, so after the update cycle running when they were replaced
+*			and one more cycle have ended, they are no longer used.
+*			If the audio is not running (no cycles are executed), they are freed
+*			after a few idle audio periods.
+*   @param  wavetables	a pointer to a vector of replaced Wavetables
+*   @param	mso_tabs	a pointer to a vector of replaced MSO waveform tables
+*   @return void
+*/
+void SynthPADgenerator::retire_wavetables(std::vector<Wavetable*> *wavetables, std::vector<DSP_WaveformTab*> *mso_tabs)
+{
+	AudioManager *audio_manager = AudioManager::get_instance();
+	uint64_t retire_cycle = audio_manager->get_update_cycles_count() + _PAD_GEN_RETIRE_CYCLES;
+	uint64_t cycles_count = audio_manager->get_update_cycles_count();
+	unsigned long idle_time_us = 0;
+	unsigned long max_idle_time_us = audio_manager->get_period_time_us() * _PAD_GEN_RETIRE_IDLE_PERIODS;
+
+	while (cycles_count < retire_cycle)
+	{
+		usleep(_PAD_GEN_RETIRE_POLL_US);
+
+		if (audio_manager->get_update_cycles_count() != cycles_count)
+		{
+			cycles_count = audio_manager->get_update_cycles_count();
+			idle_time_us = 0;
+		}
+		else if (!audio_manager->is_update_cycle_in_progress())
+		{
+			idle_time_us += _PAD_GEN_RETIRE_POLL_US;
+			if (idle_time_us > max_idle_time_us)
+			{
+				// Audio is not running
+				break;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < wavetables->size(); i++)
+	{
+		free_wavetable((*wavetables)[i]);
+	}
+	wavetables->clear();
+
+	for (size_t i = 0; i < mso_tabs->size(); i++)
+	{
+		delete (*mso_tabs)[i];
+	}
+	mso_tabs->clear();
+}
+
+/**
+*   @brief  Free (or release to the PAD cache) a wavetable that is not played.
+*   @param  wt	a pointer to the Wavetable
+*   @return void
+*/
+void SynthPADgenerator::free_wavetable(Wavetable *wt)
+{
+	if (SynthPADcache::get_instance()->release(wt) != 0)
+	{
+		// Not held by the PAD cache
+		delete[] wt->samples;
+		delete wt;
+	}
+}
+
+/**
+*   @brief  Worker thread - serves the queued programs generation requests
+*			and frees the replaced wavetables.
+*   @param  arg	a pointer to the SynthPADgenerator instance
+*   @return void*
+*/
+void *SynthPADgenerator::worker_thread(void *arg)
+{
+	SynthPADgenerator *generator = (SynthPADgenerator *)arg;
+	std::vector<Wavetable*> retired;
+	std::vector<DSP_WaveformTab*> retired_mso_tabs;
+	func_ptr_void_int_int_t progress_callback;
+	func_ptr_void_void_t batch_commit_callback;
+	Wavetable *wt;
+	int prog, jobs, done, requested;
+
+	// Create the FFT plans of all the PAD qualities sizes ahead of the first requests
+	// (the default size first)
+	FFT_prepare_plans(_PAD_DEFAULT_WAVETABLE_SIZE);
+	for (int quality = _PAD_QUALITY_32K; quality <= _PAD_QUALITY_1024K; quality++)
+	{
+		FFT_prepare_plans(1 << (15 + quality));
+	}
+
+	pthread_mutex_lock(&generator->queue_mutex);
+
+	while (true)
+	{
+		prog = -1;
+		while (!generator->stop_request && generator->replaced_wavetables.empty() &&
+			   generator->replaced_mso_tabs.empty() &&
+			   ((prog = generator->take_next_program()) < 0))
+		{
+			pthread_cond_wait(&generator->request_cond, &generator->queue_mutex);
+		}
+
+		if (generator->stop_request)
+		{
+			break;
+		}
+
+		if (prog < 0)
+		{
+			// Free replaced wavetables
+			retired.swap(generator->replaced_wavetables);
+			retired_mso_tabs.swap(generator->replaced_mso_tabs);
+			pthread_mutex_unlock(&generator->queue_mutex);
+
+			generator->retire_wavetables(&retired, &retired_mso_tabs);
+
+			pthread_mutex_lock(&generator->queue_mutex);
+			continue;
+		}
+
+		jobs = generator->pending_jobs[prog];
+		generator->pending_jobs[prog] = 0;
+		generator->running[prog] = true;
+		generator->num_of_running++;
+		__atomic_store_n(&generator->cancel[prog], false, __ATOMIC_RELEASE);
+
+		pthread_mutex_unlock(&generator->queue_mutex);
+
+		wt = NULL;
+		if (jobs & _PAD_GEN_JOB_PAD)
+		{
+			generator->generate(prog, &wt);
+		}
+
+		pthread_mutex_lock(&generator->queue_mutex);
+
+		generator->running[prog] = false;
+		generator->num_of_running--;
+		generator->completed_count++;
+
+		batch_commit_callback = NULL;
+		if (generator->batch_holding)
+		{
+			generator->hold(prog, wt, jobs);
+			if (!generator->batch_open && generator->pending_programs.empty() && (generator->num_of_running == 0))
+			{
+				batch_commit_callback = generator->commit_batch();
+			}
+		}
+		else
+		{
+			generator->publish(prog, wt, jobs);
+		}
+
+		done = generator->completed_count;
+		requested = generator->requested_count;
+		progress_callback = generator->progress_callback_ptr;
+
+		if (generator->is_idle())
+		{
+			generator->completed_count = 0;
+			generator->requested_count = 0;
+			pthread_cond_broadcast(&generator->idle_cond);
+		}
+
+		// Wake workers for a program that was skipped while running, or for
+		// freeing the replaced wavetables
+		pthread_cond_broadcast(&generator->request_cond);
+
+		if ((batch_commit_callback != NULL) || (progress_callback != NULL))
+		{
+			pthread_mutex_unlock(&generator->queue_mutex);
+			
+			if (batch_commit_callback != NULL)
+			{
+				// The batch is reported done after it was switched
+				generator->end_batch_commit(batch_commit_callback);
+			}
+			
+			if (progress_callback != NULL)
+			{
+				progress_callback(done, requested);
+			}
+			
+			pthread_mutex_lock(&generator->queue_mutex);
+		}
+	}
+
+	pthread_mutex_unlock(&generator->queue_mutex);
+
+	return NULL;
+}
@@ -0,0 +1,123 @@
+/**
+*	@file		adjSynthPADgenerator.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.1
+*					1. Parallel programs wavetables generation on a workers pool.
+*					2. MSO wavetables jobs.
+*					3. Batches (preset loading) with progress reporting.
+*					4. Batch commit callback (the preset patches are switched with
+*					   their wavetables).
+*
+*	@version	1.0		17-Oct-2026
+*
+*	@brief		Background programs wavetables (PAD and MSO) generator.
+*				Generates the programs wavetables off the control (MIDI/GUI)
+*				threads and publishes each new PAD and MSO wavetable by an atomic pointer swap.
+*/
+
+#ifndef _ADJ_SYNTH_PAD_GENERATOR
+#define _ADJ_SYNTH_PAD_GENERATOR
+
+#include <stdint.h>
+#include <pthread.h>
+#include <deque>
+#include <vector>
+
+#include "adjSynthPADcreator.h"
+#include "../libAdjHeartModSynth_2.h"
+#include "../dsp/dspWaveformTable.h"
+
+// Generation jobs (bit mask)
+#define _PAD_GEN_JOB_PAD					1
+#define _PAD_GEN_JOB_MSO					2
+
+// A replaced wavetable is freed after this number of audio update cycles ended
+#define _PAD_GEN_RETIRE_CYCLES				2
+// Audio update cycles ending polling interval while retiring a wavetable
+#define _PAD_GEN_RETIRE_POLL_US				1000
+// Number of idle audio periods after which audio is assumed stopped
+#define _PAD_GEN_RETIRE_IDLE_PERIODS		4
+
+class SynthPADgenerator
+{
+public:
+	~SynthPADgenerator();
+
+	static SynthPADgenerator *get_instance();
+
+	int request_generate(int prog, int jobs = _PAD_GEN_JOB_PAD);
+
+	void begin_batch();
+	void end_batch();
+
+	void register_progress_callback(func_ptr_void_int_int_t ptr);
+	void register_batch_commit_callback(func_ptr_void_void_t ptr);
+
+	int get_num_of_workers();
+	bool is_busy();
+	bool wait_for_idle(int timeout_ms);
+
+private:
+	SynthPADgenerator();
+
+	void start_workers();
+	void stop_workers();
+
+	int take_next_program();
+	bool is_idle();
+
+	int generate(int prog, Wavetable **new_wt);
+	void hold(int prog, Wavetable *wt, int jobs);
+	void publish(int prog, Wavetable *wt, int jobs);
+	func_ptr_void_void_t commit_batch();
+	void end_batch_commit(func_ptr_void_void_t batch_commit_callback);
+	void retire_wavetables(std::vector<Wavetable*> *wavetables, std::vector<DSP_WaveformTab*> *mso_tabs);
+
+	static void free_wavetable(Wavetable *wt);
+
+	static void *worker_thread(void *arg);
+
+	static SynthPADgenerator *pad_generator_instance;
+
+	int num_of_workers;
+	pthread_t thread_ids[_SYNTH_MAX_NUM_OF_CORES];
+	bool stop_request;
+
+	pthread_mutex_t queue_mutex;
+	// Signaled when a generation is requested, a program is done (or stop)
+	pthread_cond_t request_cond;
+	// Signaled when no generations are queued, running or held
+	pthread_cond_t idle_cond;
+
+	// Programs waiting for generation (each program is queued once)
+	std::deque<int> pending_programs;
+	// Requested jobs of each queued program
+	int pending_jobs[_SYNTH_MAX_NUM_OF_PROGRAMS];
+	// Programs being generated (a program is generated by one worker at a time)
+	bool running[_SYNTH_MAX_NUM_OF_PROGRAMS];
+	int num_of_running;
+	// Set to abandon a running (outdated) generation
+	bool cancel[_SYNTH_MAX_NUM_OF_PROGRAMS];
+
+	// From begin_batch() until all the batch jobs are done, results are held
+	// and then published together
+	bool batch_open;
+	bool batch_holding;
+	// Set while the batch commit callback is running (the batch is not done yet)
+	bool batch_committing;
+	func_ptr_void_void_t batch_commit_callback_ptr;
+	Wavetable *held_wavetables[_SYNTH_MAX_NUM_OF_PROGRAMS];
+	int held_jobs[_SYNTH_MAX_NUM_OF_PROGRAMS];
+
+	// Replaced wavetables waiting to be freed (by a worker)
+	std::vector<Wavetable*> replaced_wavetables;
+	std::vector<DSP_WaveformTab*> replaced_mso_tabs;
+
+	// Progress (completed programs / requested programs since idle)
+	int requested_count;
+	int completed_count;
+	func_ptr_void_int_int_t progress_callback_ptr;
+};
+
+#endif
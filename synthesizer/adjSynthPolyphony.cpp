@@ -51,17 +51,12 @@ AdjSynthPolyphony *AdjSynthPolyphony::get_instance()
 *   @param  note	requested note
 *   @param	program	requested program
 *   @return a voice num that is already assigned to this note and program;
-*			-2 if CPU is too loaded; -3 if params are out of range
+*			-3 if params are out of range
+*			(a reused voice adds no DSP load - no admission control is required)
 */
 int AdjSynthPolyphony::get_reused_note(int note, int program)
 {
 	int i, result = -1;
-	
-	if (mod_synth_get_cpu_utilization() > 90)
-	// CPU is too loaded
-	{	
-		return -2;
-	}
 
 	if ((note < 0) || (note > 127) || (program < 0) ||
 		(program >= mod_synth_get_synthesizer_num_of_programs()))
@@ -189,6 +184,56 @@ int AdjSynthPolyphony::get_oldest_voice()
 	return minvoice;	
 }
 
+/**
+*   @brief  Returns the voice number of the quietest playing voice, to be stolen
+*			when another voice can not be rendered within the audio period.
+*			Released voices (decaying) are preferred, then the lowest magnitude,
+*			then the oldest.
+*   @param  none
+*   @return the voice number of the quietest playing voice; -1 if no voice is playing
+*/
+int AdjSynthPolyphony::get_quietest_voice()
+{
+	int i;
+	int quietest_voice = -1;
+	bool released, quietest_released = false;
+	float magnitude, quietest_magnitude = 0.0f;
+	uint64_t timestamp, quietest_timestamp = UINT64_MAX;
+	AudioVoiceFloat *audio_voice;
+
+	for (i = 0; i < mod_synth_get_synthesizer_num_of_polyphonic_voices(); i++)
+	{
+		if (AdjSynth::get_instance()->synth_voice[i] == NULL)
+		{
+			continue;
+		}
+
+		audio_voice = AdjSynth::get_instance()->synth_voice[i]->audio_voice;
+		released = audio_voice->is_voice_wait_for_not_active();
+		if (!released && !audio_voice->is_voice_active())
+		{
+			continue;
+		}
+
+		magnitude = audio_voice->get_magnitude();
+		timestamp = audio_voice->get_timestamp();
+
+		if ((quietest_voice < 0) ||
+			(released && !quietest_released) ||
+			((released == quietest_released) &&
+				((magnitude < quietest_magnitude) ||
+				((magnitude == quietest_magnitude) && (timestamp < quietest_timestamp)))))
+		{
+			quietest_voice = i;
+			quietest_released = released;
+			quietest_magnitude = magnitude;
+			quietest_timestamp = timestamp;
+		}
+	}
+
+	return quietest_voice;
+}
+
 /**
 *   @brief  Returns the voice number of the voice that is part of the
 *			provided program and plays the provided note
@@ -258,7 +303,7 @@ int AdjSynthPolyphony::get_voice_note(int note, int program)
 */
 void AdjSynthPolyphony::free_voice(int voice, bool pend)
 {
-	int program = 0, progvoice = 0;
+	int program = 0;
 	
 	if ((voice >= 0) && (voice < mod_synth_get_synthesizer_num_of_polyphonic_voices()))
 	{
@@ -274,14 +319,9 @@ void AdjSynthPolyphony::free_voice(int voice, bool pend)
 		{
 			// Free now
 			program = AdjSynth::get_instance()->synth_voice[voice]->allocated_to_program_num;  
-			progvoice = AdjSynth::get_instance()->synth_voice[voice]->allocated_to_program_voice_num;
-			if (AdjSynth::get_instance()->get_midi_mapping_mode() == _MIDI_MAPPING_MODE_SKETCH)
-			{
-				program = AdjSynth::get_instance()->get_active_sketch();
-			}
-			fprintf(stderr, "free program: %i voice: %i\n", program, progvoice);
+			fprintf(stderr, "free program: %i voice: %i\n", program, voice);
 
-			AdjSynth::get_instance()->synth_program[program]->free_voice(progvoice);
+			AdjSynth::get_instance()->release_program_voice(voice);
 
 			AdjSynth::get_instance()->synth_voice[voice]->audio_voice->reset_wait_for_not_active();
 			AdjSynth::get_instance()->synth_voice[voice]->audio_voice->set_note(-1);
@@ -28,6 +28,7 @@ public:
 	int get_less_busy_core();
 	int get_free_voice(int core);
 	int get_oldest_voice();
+	int get_quietest_voice();
 	int get_voice_note(int note = -1, int program = 0);
 	void free_voice(int voice = -1, bool pend = true);
 
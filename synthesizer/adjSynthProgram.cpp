@@ -19,6 +19,8 @@
 #include "adjSynth.h"
 #include "adjSynthVoice.h"
 #include "adjSynthProgram.h"
+#include "adjSynthPADgenerator.h"
+#include "adjSynthPADcache.h"
 #include "synthKeyboard.h"
 #include "../utils/utils.h"
 
@@ -82,10 +84,12 @@ SynthProgram::SynthProgram(
 	active_patch_params.settings_type = _PARAM_TYPE_ADJ_SYNTH_PATCH;
 	settings_manager = new ModSynthSettings(&active_patch_params);
 	active_patch_params.version = settings_manager->get_settings_version();
+	pthread_mutex_init(&patch_snapshot_mutex, NULL);
+	publish_patch_snapshot();
 
 	program_wavetable = new Wavetable();
 	program_wavetable->size = wt_size;
-	program_wavetable->samples = (float*)malloc(wt_size * sizeof(float));
+	program_wavetable->samples = new float[wt_size]();
 	synth_pad_creator = new SynthPADcreator(program_wavetable, program_wavetable->size);
 	program_wavetable->base_freq =
 		synth_pad_creator->set_base_frequency(program_wavetable, _PAD_DEFAULT_BASE_NOTE);
@@ -96,23 +100,26 @@ SynthProgram::SynthProgram(
 	mso_wtab->calc_segments_lengths(&mso_wtab->morphed_segment_lengths, &mso_wtab->morphed_segment_positions);
 	mso_wtab->calc_wtab(mso_wtab->morphed_waveform_tab, &mso_wtab->morphed_segment_lengths, &mso_wtab->morphed_segment_positions);	
 
-	// synthVoice instances are dynamiclly created in set_num_of_voices(int nov) hereafter
-	for(i = 0 ; i < mod_synth_get_synthesizer_num_of_polyphonic_voices(); i++)
-	{
-		synth_voices[i] = NULL;
-	}
-
+	// The program holds no voices: the synthesizer voices are bound to the program
+	// patch parameters when a note is played (see AdjSynth::midi_play_note_on()).
+	num_of_active_voices = 0;
 	num_of_voices = 4;  // Just in case illegal num of voices was provided (something to start with
-	set_num_of_voices(voices);  // This will also create the synthVoice objects
+	set_num_of_voices(voices);
 }
 
 SynthProgram::~SynthProgram()
 {
-	delete[] program_wavetable->samples;
-	delete program_wavetable;
+	if (SynthPADcache::get_instance()->release(program_wavetable) != 0)
+	{
+		delete[] program_wavetable->samples;
+		delete program_wavetable;
+	}
 
 	delete[] mso_wtab->base_waveform_tab;
 	delete[] mso_wtab->morphed_waveform_tab;
+
+	ModSynthSettings::release_snapshot(patch_snapshot);
+	pthread_mutex_destroy(&patch_snapshot_mutex);
 }
 
 /**
@@ -219,6 +226,9 @@ void SynthProgram::set_program_patch_params(_setting_params_t *params)
 	settings_res_t res;
 	mod_synth_settings_str_param_t str_param;
 	
+	// The program voices are updated once, when all the parameters are set
+	ModSynthSettings::begin_params_batch();
+	
 	// Go over all string parameters
 	for(std::map<std::string,
 		mod_synth_settings_str_param_t>::iterator param = params->string_parameters_map.begin();
@@ -272,107 +282,255 @@ void SynthProgram::set_program_patch_params(_setting_params_t *params)
 			_EXEC_CALLBACK | _EXEC_BLOCK_CALLBACK,
 			prog_num);
 	}
+	
+	ModSynthSettings::commit_params_batch();
 
-	synth_pad_creator->generate_wavetable(program_wavetable);
+	// PAD and MSO wavetables are built in the background
+	request_pad_wavetable_generation(_PAD_GEN_JOB_PAD | _PAD_GEN_JOB_MSO);
+}
 
-	mso_wtab->calc_segments_lengths(&mso_wtab->morphed_segment_lengths, &mso_wtab->morphed_segment_positions);
-	mso_wtab->calc_wtab(mso_wtab->morphed_waveform_tab, &mso_wtab->morphed_segment_lengths, &mso_wtab->morphed_segment_positions);
+/**
+*   @brief  Set the program patch from a patch snapshot (e.g. another program patch):
+*			the parameters are copied as a whole, and the snapshot is shared as this
+*			program patch snapshot (no snapshot is created).
+*			The program voices are updated by the caller (as on a parameters batch commit).
+*   @param  snapshot	a patch parameters snapshot
+*   @return void
+*/
+void SynthProgram::set_program_patch_snapshot(settings_snapshot_t *snapshot)
+{
+	if (snapshot == NULL)
+	{
+		return;
+	}
+	
+	// All programs patch parameters have the same callbacks (the program is a callback argument)
+	ModSynthSettings::settings_params_deep_copy(&active_patch_params, &snapshot->params);
+	ModSynthSettings::exec_setup_callbacks(&active_patch_params, prog_num);
+	
+	share_patch_snapshot(ModSynthSettings::retain_snapshot(snapshot), active_patch_params.changes_count);
+	
+	// PAD and MSO wavetables are built in the background
+	request_pad_wavetable_generation(_PAD_GEN_JOB_PAD | _PAD_GEN_JOB_MSO);
 }
 
 /**
-*   @brief  Return a free program voice resource.
+*   @brief  Publish a new snapshot of the program patch parameters, if the patch was 
+*			changed since the last one was published and the snapshot is not held.
+*			Called by the editing threads after the patch is modified (the snapshot
+*			is created here, never when a note is played).
 *   @param  none
-*   @return a pointer to a free program voice resource.
+*   @return void
 */
-SynthVoice *SynthProgram::get_free_voice()
+void SynthProgram::publish_patch_snapshot()
 {
-	int voice = 0;
-	struct timeval timestamp;
-	uint64_t mintime = UINT64_MAX;
-	int minvoice = -1, mincore = -1;
-	bool reused = false;
+	bool up_to_date;
+	settings_snapshot_t *snapshot;
 
-	if (mod_synth_get_cpu_utilization() > 90)
-	{	
-		// DSP urilization is too high
-		return NULL;
+	pthread_mutex_lock(&patch_snapshot_mutex);
+	up_to_date = patch_snapshot_held || ((patch_snapshot != NULL) && 
+		(patch_snapshot_changes_count == active_patch_params.changes_count));
+	pthread_mutex_unlock(&patch_snapshot_mutex);
+
+	if (up_to_date)
+	{
+		return;
+	}
+
+	snapshot = ModSynthSettings::create_snapshot(&active_patch_params);
+	share_patch_snapshot(snapshot, snapshot->source_changes_count);
+}
+
+/**
+*   @brief  Replace the published program patch snapshot.
+*   @param  snapshot	a snapshot reference (owned by the program from now)
+*   @param	changes_count	the program patch changes count the snapshot reflects
+*   @return void
+*/
+void SynthProgram::share_patch_snapshot(settings_snapshot_t *snapshot, uint32_t changes_count)
+{
+	settings_snapshot_t *replaced;
+
+	pthread_mutex_lock(&patch_snapshot_mutex);
+	replaced = patch_snapshot;
+	patch_snapshot = snapshot;
+	patch_snapshot_changes_count = changes_count;
+	pthread_mutex_unlock(&patch_snapshot_mutex);
+
+	ModSynthSettings::release_snapshot(replaced);
+}
+
+/**
+*   @brief  Return the published snapshot of the program patch parameters (a reference 
+*			is taken; no parameters are copied and no memory is allocated, so it may be
+*			called by the MIDI and audio threads).
+*			Must be released by ModSynthSettings::release_snapshot().
+*   @param  none
+*   @return a pointer to a snapshot of the program patch parameters
+*/
+settings_snapshot_t *SynthProgram::get_patch_snapshot()
+{
+	settings_snapshot_t *snapshot;
+
+	pthread_mutex_lock(&patch_snapshot_mutex);
+	snapshot = ModSynthSettings::retain_snapshot(patch_snapshot);
+	pthread_mutex_unlock(&patch_snapshot_mutex);
+
+	return snapshot;
+}
+
+/**
+*   @brief  Hold (or release) the program patch snapshot: while held, new voices are bound
+*			to the patch as it was when the hold started, e.g. while a preset is loaded and
+*			its wavetables are not ready yet. When released, the current patch is published.
+*   @param  hold	true to hold; false to release
+*   @return void
+*/
+void SynthProgram::hold_patch_snapshot(bool hold)
+{
+	if (hold)
+	{
+		// Hold the current patch
+		publish_patch_snapshot();
+	}
+
+	pthread_mutex_lock(&patch_snapshot_mutex);
+	patch_snapshot_held = hold;
+	pthread_mutex_unlock(&patch_snapshot_mutex);
+
+	if (!hold)
+	{
+		publish_patch_snapshot();
 	}
+}
 
+/**
+*   @brief  Request the program wavetables generation on the background
+*			wavetables generator workers (returns immediately).
+*   @param  jobs	_PAD_GEN_JOB_PAD and/or _PAD_GEN_JOB_MSO
+*   @return 0 if OK; -1 otherwise
+*/
+int SynthProgram::request_pad_wavetable_generation(int jobs)
+{
+	return SynthPADgenerator::get_instance()->request_generate(prog_num, jobs);
+}
+
+/**
+*   @brief  Publish a new program PAD wavetable. Voices playing the program
+*			switch to it when their next audio block starts.
+*   @param  wt	a pointer to a generated Wavetable
+*   @return a pointer to the replaced Wavetable (to be freed when no longer played)
+*/
+Wavetable *SynthProgram::publish_pad_wavetable(Wavetable *wt)
+{
+	return __atomic_exchange_n(&program_wavetable, wt, __ATOMIC_ACQ_REL);
+}
+
+/**
+*   @brief  Acquire a program voice: a synthesizer voice is going to play this program.
+*   @param  none
+*   @return true if the program polyphony allows another voice; false otherwise.
+*/
+bool SynthProgram::acquire_voice()
+{
 	if (portamento_enabled)
 	{
-		synth_voices[_SYNTH_VOICE_1]->audio_voice->set_active();
-		synth_voices[_SYNTH_VOICE_1]->audio_voice->reset_wait_for_not_active();
+		// A single (gliding) voice
 		if (mark_voice_bussy_callback_ptr)
 		{
 			mark_voice_bussy_callback_ptr(first_voice_index);
 		}
-		//		return synthVoices[firstVoiceIndex];
-		return synth_voices[0];
+		
+		return true;
 	}
 
-	// Look for a free voice
-	voice = 0;
-	while ((voice < num_of_voices) && synth_voices[voice]->dsp_voice->is_in_use())
+	// Incremented by the MIDI thread, decremented also by the audio update thread
+	int count = __atomic_load_n(&num_of_active_voices, __ATOMIC_ACQUIRE);
+	
+	do
 	{
-		voice++;
+		if (count >= num_of_voices)
+		{
+			return false;
+		}
+	} while (!__atomic_compare_exchange_n(&num_of_active_voices, &count, count + 1,
+				false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+	
+	return true;
+}
+
+/**
+*   @brief  Return the program voice type - its DSP cost class, set by the most
+*			expensive enabled synthesizer (PAD, MSO, Karplus-Strong or additive).
+*   @param  none
+*   @return _PROGRAM_VOICE_TYPE_ADDITIVE ... _PROGRAM_VOICE_TYPE_PAD
+*/
+int SynthProgram::get_voice_type()
+{
+	bool enabled;
+
+	if ((settings_manager->get_bool_param_value(&active_patch_params,
+			_PARAM_ID_PAD_SYNTH_ENABLED, &enabled) == _SETTINGS_KEY_FOUND) && enabled)
+	{
+		return _PROGRAM_VOICE_TYPE_PAD;
 	}
 
-	if (voice < num_of_voices)
+	if ((settings_manager->get_bool_param_value(&active_patch_params,
+			_PARAM_ID_MSO_SYNTH_ENABLED, &enabled) == _SETTINGS_KEY_FOUND) && enabled)
 	{
-		synth_voices[voice]->dsp_voice->in_use();
-		return synth_voices[voice];
+		return _PROGRAM_VOICE_TYPE_MSO;
 	}
-	else
+
+	if ((settings_manager->get_bool_param_value(&active_patch_params,
+			_PARAM_ID_KARPLUS_SYNTH_ENABLED, &enabled) == _SETTINGS_KEY_FOUND) && enabled)
 	{
-		return NULL;
+		return _PROGRAM_VOICE_TYPE_KARPLUS;
 	}
+
+	return _PROGRAM_VOICE_TYPE_ADDITIVE;
 }
 
 /**
-*   @brief  Free in-use program voice resource.
-*   @param  voice	voice resource number
+*   @brief  Release a program voice acquired by acquire_voice().
+*			Use AdjSynth::release_program_voice() to release a synthesizer voice once.
+*   @param  none
 *   @return void
 */
-void SynthProgram::free_voice(int voice)
+void SynthProgram::release_voice()
 {
-	if ((voice >= 0) && (voice < num_of_voices))
+	int count = __atomic_load_n(&num_of_active_voices, __ATOMIC_ACQUIRE);
+	
+	while ((count > 0) &&
+		   !__atomic_compare_exchange_n(&num_of_active_voices, &count, count - 1,
+				false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
 	{
-		synth_voices[voice]->dsp_voice->not_in_use();
-		printf("program: %i free voice: %i\n", prog_num, voice);
 	}
-		
 }
 
 /**
-*   @brief  Set the number of voices.
-*			Create additional new voices if required.
-*   @param  nov	number of voice resources to create.
+*   @brief  Release all program voices.
+*   @param  none
+*   @return void
+*/
+void SynthProgram::release_all_voices() { __atomic_store_n(&num_of_active_voices, 0, __ATOMIC_RELEASE); }
+
+/**
+*   @brief  Return the number of synthesizer voices currently playing this program.
+*   @param  none
+*   @return the number of active voices
+*/
+int SynthProgram::get_num_of_active_voices() { return __atomic_load_n(&num_of_active_voices, __ATOMIC_ACQUIRE); }
+
+/**
+*   @brief  Set the maximum number of voices (polyphony) of this program.
+*   @param  nov	number of voices.
 *   @return void
 */
 void SynthProgram::set_num_of_voices(int nov)
 {	
-	int i;	
-
 	if ((nov > 0) && (nov <= mod_synth_get_synthesizer_num_of_polyphonic_voices()))
 	{
 		num_of_voices = nov;
-		// Increase num of voices per demand.
-		for(i = 0 ; i < num_of_voices ; i++)
-		{
-			if (synth_voices[i] == NULL)
-			{				
-				synth_voices[i] = new SynthVoice(
-					i,
-					prog_num,
-					sample_rate,
-					audio_block_size,
-					&active_patch_params, 
-					mso_wtab,
-					program_wavetable,
-					audio_manager);
-				synth_voices[i]->set_voice_params(&active_patch_params);
-			}
-		}
 	}	
 }
 
@@ -19,11 +19,18 @@
 
 #include "synthSettings.h"
 #include "adjSynthPADcreator.h"
+#include "adjSynthPADgenerator.h"
 #include "adjSynthVoice.h"
 #include "../libAdjHeartModSynth_2.h"
 #include "../audio/audioManager.h"
 #include "../dsp/dspMorphedSineOsc.h"
 
+// Program voice types (DSP cost classes) - by the most expensive enabled synthesizer
+#define _PROGRAM_VOICE_TYPE_ADDITIVE		0
+#define _PROGRAM_VOICE_TYPE_KARPLUS			1
+#define _PROGRAM_VOICE_TYPE_MSO				2
+#define _PROGRAM_VOICE_TYPE_PAD				3
+
 /*
 typedef struct voice_resource
 {
@@ -71,6 +78,10 @@ public:
 	int get_num_of_voices();
 
 	void set_program_patch_params(_setting_params_t *patch_params);
+	void set_program_patch_snapshot(settings_snapshot_t *snapshot);
+	void publish_patch_snapshot();
+	settings_snapshot_t *get_patch_snapshot();
+	void hold_patch_snapshot(bool hold);
 
 	void set_portamento_time(float porta);
 	void set_portamento_time(int porta);
@@ -83,17 +94,21 @@ public:
 	float get_note_frequency();
 	void update_actual_frequency();
 
-	SynthVoice *get_free_voice();
-	void free_voice(int voice);
+	bool acquire_voice();
+	void release_voice();
+	void release_all_voices();
+	int get_num_of_active_voices();
+	int get_voice_type();
 
-	SynthVoice *synth_voices[_SYNTH_MAX_NUM_OF_VOICES] = { NULL };
+	int request_pad_wavetable_generation(int jobs = _PAD_GEN_JOB_PAD);
+	Wavetable *publish_pad_wavetable(Wavetable *wt);
 
 	ModSynthSettings *settings_manager = NULL; 
 	_setting_params_t active_patch_params, prev_active_patch_params_x;  
 
 	DSP_MorphingSinusOscWTAB *mso_wtab = NULL;
 
-	// synthPAD wavetable
+	// synthPAD wavetable (replaced by an atomic exchange when regenerated)
 	SynthPADcreator *synth_pad_creator = NULL;
 	Wavetable *program_wavetable = NULL;
 	
@@ -106,6 +121,8 @@ private:
 	static int prog_numbers;
 	// Maximum number of polyphonic voices assigned to this program
 	int num_of_voices;
+	// Number of synthesizer voices currently playing this program (atomic)
+	int num_of_active_voices;
 	// Indicates 1st voice index out of all synthesizer voices. 
 	// e.g. firstVoiceIndex = 10 and numOfVoices = 12 => program voices: 10 to 21.
 	int first_voice_index;
@@ -130,6 +147,16 @@ private:
 	
 	func_ptr_int_settings_parms_ptr_int_t set_patch_settings_default_params_callback_ptr = NULL;
 	func_ptr_void_int_t mark_voice_bussy_callback_ptr = NULL;
+
+	void share_patch_snapshot(settings_snapshot_t *snapshot, uint32_t changes_count);
+
+	// Published patch parameters snapshot (replaced by the editing threads when the patch is changed)
+	settings_snapshot_t *patch_snapshot = NULL;
+	// The patch changes count the published snapshot reflects
+	uint32_t patch_snapshot_changes_count = 0;
+	// While held, the last snapshot is not replaced (patch changes are not bound yet)
+	bool patch_snapshot_held = false;
+	pthread_mutex_t patch_snapshot_mutex;
 };
 
 #endif
@@ -153,15 +153,20 @@ int set_voice_block_amp_ch_2_pan_modulation_lfo_level_cb(int lev, int voice, int
 
 int set_voice_block_amp_fixed_levels_state_cb(bool en, int voice, int prog)
 {
+	SynthVoice *bound_voice;
+
 	if ((prog >= 0) && (prog < mod_synth_get_synthesizer_num_of_programs()))
 	{
+		bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+		return_val_if_true(bound_voice == NULL, 0);
+
 		if (en == _AMP_FIXED_LEVELS_ENABLE)
 		{
-			AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->out_amp->enable_fixed_levels();
+			bound_voice->dsp_voice->out_amp->enable_fixed_levels();
 		}
 		else if (en == _AMP_FIXED_LEVELS_DISABLE)
 		{
-			AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->out_amp->disable_fixed_levels();
+			bound_voice->dsp_voice->out_amp->disable_fixed_levels();
 		}
 
 		return 0;
@@ -19,13 +19,16 @@
 
 int set_voice_block_distortion_enabled_cb(bool enable, int voice, int prog)
 {
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
 	if (enable)
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->enable_distortion();
+		bound_voice->dsp_voice->enable_distortion();
 	}
 	else
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->disable_distortion();
+		bound_voice->dsp_voice->disable_distortion();
 	}
 
 	return 0;
@@ -33,15 +36,18 @@ int set_voice_block_distortion_enabled_cb(bool enable, int voice, int prog)
 
 int set_voice_block_distortion_auto_gain_enabled_cb(bool enable, int voice, int prog)
 {
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
 	if (enable)
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->enable_distortion1_auto_gain();
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->enable_distortion2_auto_gain();
+		bound_voice->dsp_voice->enable_distortion1_auto_gain();
+		bound_voice->dsp_voice->enable_distortion2_auto_gain();
 	}
 	else
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->disable_distortion1_auto_gain();
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->disable_distortion2_auto_gain();
+		bound_voice->dsp_voice->disable_distortion1_auto_gain();
+		bound_voice->dsp_voice->disable_distortion2_auto_gain();
 	}
 
 	return 0;
@@ -50,41 +56,59 @@ int set_voice_block_distortion_auto_gain_enabled_cb(bool enable, int voice, int
 
 int set_voice_block_distortion_1_drive_cb(int drv, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->distortion1->set_drive((float)drv / 100.f);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->distortion1->set_drive((float)drv / 100.f);
 	return 0;
 }
 
 int set_voice_block_distortion_1_range_cb(int rng, int voice, int prog)
 {
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
 	float value = ((float)rng / 100.f) * (_DISTORTION_MAX_RANGE - _DISTORTION_MIN_RANGE) + _DISTORTION_MIN_RANGE;
 
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->distortion1->set_range(value);
+	bound_voice->dsp_voice->distortion1->set_range(value);
 	return 0;
 }
 
 int set_voice_block_distortion_1_blend_cb(int blnd, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->distortion1->set_blend((float)blnd / 100.f);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->distortion1->set_blend((float)blnd / 100.f);
 	return 0;
 }
 
 
 int set_voice_block_distortion_2_drive_cb(int drv, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->distortion2->set_drive((float)drv / 100.f);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->distortion2->set_drive((float)drv / 100.f);
 	return 0;
 }
 
 int set_voice_block_distortion_2_range_cb(int rng, int voice, int prog)
 {
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
 	float value = ((float)rng / 100.f) * (_DISTORTION_MAX_RANGE - _DISTORTION_MIN_RANGE) + _DISTORTION_MIN_RANGE;
 
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->distortion2->set_range(value);
+	bound_voice->dsp_voice->distortion2->set_range(value);
 	return 0;
 }
 
 int set_voice_block_distortion_2_blend_cb(int blnd, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->distortion2->set_blend((float)blnd / 100.f);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->distortion2->set_blend((float)blnd / 100.f);
 	return 0;
 }
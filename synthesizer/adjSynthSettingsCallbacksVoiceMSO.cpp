@@ -19,116 +19,170 @@
 
 int set_voice_block_mso_synth_enabled_cb(bool enable, int voice, int prog)
 {
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
 	if (enable)
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->enable_morphed_sin();
+		bound_voice->dsp_voice->enable_morphed_sin();
 	}
 	else
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->disable_morphed_sin();
+		bound_voice->dsp_voice->disable_morphed_sin();
 	}
 	return 0;
 }
 
 int set_voice_block_mso_synth_tune_offset_oct_cb(int oct, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->mso1->set_freq_detune_oct(oct);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->mso1->set_freq_detune_oct(oct);
 	return 0;
 }
 
 int set_voice_block_mso_synth_tune_offset_semitones_cb(int semi, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->mso1->set_freq_detune_semitones(semi);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->mso1->set_freq_detune_semitones(semi);
 	return 0;
 }
 
 int set_voice_block_mso_synth_tune_offset_cents_cb(int cnt, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->mso1->set_freq_detune_cents(cnt);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->mso1->set_freq_detune_cents(cnt);
 	return 0;
 }
 
 int set_voice_block_mso_synth_send_filter_1_cb(int send, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_send_filter1_level(send);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_send_filter1_level(send);
 	return 0;
 }
 
 int set_voice_block_mso_synth_send_filter_2_cb(int send, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_send_filter2_level(send);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_send_filter2_level(send);
 	return 0;
 }
 
 int set_voice_block_mso_synth_freq_modulation_lfo_num_cb(int lfon, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_freq_mod_lfo(lfon);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_freq_mod_lfo(lfon);
 	return 0;
 }
 
 int set_voice_block_mso_synth_freq_modulation_lfo_level_cb(int lfolev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_freq_mod_lfo_level(lfolev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_freq_mod_lfo_level(lfolev);
 	return 0;
 }
 
 int set_voice_block_mso_synth_freq_modulation_env_num_cb(int envn, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_freq_mod_env(envn);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_freq_mod_env(envn);
 	return 0;
 }
 
 int set_voice_block_mso_synth_freq_modulation_env_level_cb(int envlev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_freq_mod_env_level(envlev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_freq_mod_env_level(envlev);
 	return 0;
 }
 
 int set_voice_block_mso_synth_pwm_modulation_lfo_num_cb(int lfon, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_pwm_mod_lfo(lfon);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_pwm_mod_lfo(lfon);
 	return 0;
 }
 
 int set_voice_block_mso_synth_pwm_modulation_lfo_level_cb(int lfolev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_pwm_mod_lfo_level(lfolev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_pwm_mod_lfo_level(lfolev);
 	return 0;
 }
 
 int set_voice_block_mso_synth_pwm_modulation_env_num_cb(int envn, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_pwm_mod_env(envn);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_pwm_mod_env(envn);
 	return 0;
 }
 
 int set_voice_block_mso_synth_pwm_modulation_env_level_cb(int envlev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_pwm_mod_env_level(envlev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_pwm_mod_env_level(envlev);
 	return 0;
 }
 
 int set_voice_block_mso_synth_amp_modulation_lfo_num_cb(int lfon, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_amp_mod_lfo(lfon);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_amp_mod_lfo(lfon);
 	return 0;
 }
 
 int set_voice_block_mso_synth_amp_modulation_lfo_level_cb(int lfolev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_amp_mod_lfo_level(lfolev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_amp_mod_lfo_level(lfolev);
 	return 0;
 }
 
 int set_voice_block_mso_synth_amp_modulation_env_num_cb(int envn, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_amp_mod_env(envn);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_amp_mod_env(envn);
 	return 0;
 }
 
 int set_voice_block_mso_synth_amp_modulation_env_level_cb(int envlev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_mso1_amp_mod_env_level(envlev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_mso1_amp_mod_env_level(envlev);
 	return 0;
 }
 
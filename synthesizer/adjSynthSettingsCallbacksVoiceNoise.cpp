@@ -18,56 +18,80 @@
 
 int set_voice_block_noise_enabled_cb(bool enable, int voice, int prog)
 {
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
 	if (enable)
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->enable_noise();
+		bound_voice->dsp_voice->enable_noise();
 	}
 	else
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->disable_noise();
+		bound_voice->dsp_voice->disable_noise();
 	}
 	return 0;
 }
 
 int set_voice_block_noise_color_cb(int typ, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->noise1->set_noise_type(typ);	
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->noise1->set_noise_type(typ);	
 	return 0;
 }
 
 int set_voice_block_noise_send_filter_1_cb(int snd, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_noise1_send_filter1_level(snd);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_noise1_send_filter1_level(snd);
 	return 0;
 }
 
 int set_voice_block_noise_send_filter_2_cb(int snd, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_noise1_send_filter2_level(snd);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_noise1_send_filter2_level(snd);
 	return 0;
 }
 
 int set_voice_block_noise_amp_modulation_lfo_num_cb(int lfon, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_noise_amp_mod_lfo(lfon);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_noise_amp_mod_lfo(lfon);
 	return 0;
 }
 
 int set_voice_block_noise_amp_modulation_lfo_level_cb(int lfolev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_noise_amp_mod_lfo_level(lfolev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_noise_amp_mod_lfo_level(lfolev);
 	return 0;
 }
 
 int set_voice_block_noise_amp_modulation_env_num_cb(int envn, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_noise_amp_mod_env(envn);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_noise_amp_mod_env(envn);
 	return 0;
 }
 
 int set_voice_block_noise_amp_modulation_env_level_cb(int envlev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_noise_amp_mod_env_level(envlev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_noise_amp_mod_env_level(envlev);
 	return 0;
 }
 
@@ -19,106 +19,148 @@
 
 int set_voice_block_pad_synth_enabled_cb(bool enable, int voice, int prog)
 {
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
 	if (enable)
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->enable_pad_synth();
+		bound_voice->dsp_voice->enable_pad_synth();
 	}
 	else
 	{
-		AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->disable_pad_synth();
+		bound_voice->dsp_voice->disable_pad_synth();
 	}
 	return 0;
 }
 
 int set_voice_block_pad_synth_detune_octave_cb(int oct, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->wavetable1->set_freq_detune_oct(oct);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->wavetable1->set_freq_detune_oct(oct);
 	return 0;
 }
 
 int set_voice_block_pad_synth_detune_semitones_cb(int semt, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->wavetable1->set_freq_detune_semitones(semt);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->wavetable1->set_freq_detune_semitones(semt);
 	return 0;
 }
 
 int set_voice_block_pad_synth_detune_cents_cb(int cnts, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->wavetable1->set_freq_detune_cents(cnts);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->wavetable1->set_freq_detune_cents(cnts);
 	return 0;
 }
 
 int set_voice_block_pad_synth_send_filter_1_cb(int snd, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_send_filter1_level(snd);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_send_filter1_level(snd);
 	return 0;
 }
 
 int set_voice_block_pad_synth_send_filter_2_cb(int snd, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_send_filter2_level(snd);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_send_filter2_level(snd);
 	return 0;
 }
 
 int set_voice_block_pad_synth_freq_modulation_lfo_num_cb(int lfo, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_freq_mod_lfo(lfo);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_freq_mod_lfo(lfo);
 	return 0;
 }
 
 int set_voice_block_pad_synth_freq_modulation_lfo_level_cb(int lev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_freq_mod_lfo_level(lev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_freq_mod_lfo_level(lev);
 	return 0;
 }
 
 int set_voice_block_pad_synth_freq_modulation_env_num_cb(int env, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_freq_mod_env(env);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_freq_mod_env(env);
 	return 0;
 }
 
 int set_voice_block_pad_synth_freq_modulation_env_level_cb(int lev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_freq_mod_env_level(lev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_freq_mod_env_level(lev);
 	return 0;
 }
 
 int set_voice_block_pad_synth_amp_modulation_lfo_num_cb(int lfo, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_amp_mod_lfo(lfo);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_amp_mod_lfo(lfo);
 	return 0;
 }
 
 int set_voice_block_pad_synth_amp_modulation_lfo_level_cb(int lev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_amp_mod_lfo_level(lev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_amp_mod_lfo_level(lev);
 	return 0;
 }
 
 int set_voice_block_pad_synth_amp_modulation_env_num_cb(int env, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_amp_mod_env(env);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_amp_mod_env(env);
 	return 0;
 }
 
 int set_voice_block_pad_synth_amp_modulation_env_level_cb(int lev, int voice, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_voices[voice]->dsp_voice->set_pad1_amp_mod_env_level(lev);
+	SynthVoice *bound_voice = AdjSynth::get_instance()->get_program_bound_voice(prog, voice);
+	return_val_if_true(bound_voice == NULL, 0);
+
+	bound_voice->dsp_voice->set_pad1_amp_mod_env_level(lev);
 	return 0;
 }
 
 int set_voice_block_pad_synth_quality_cb(int qlt, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_pad_creator->set_wavetable_length(
-		AdjSynth::get_instance()->synth_program[prog]->program_wavetable, qlt);
+	// Applies to the next generated wavetable
+	AdjSynth::get_instance()->synth_program[prog]->synth_pad_creator->set_wavetable_length(qlt);
 	return 0;
 }
 
 int set_voice_block_pad_synth_base_note_cb(int bnot, int prog)
 {
-	AdjSynth::get_instance()->synth_program[prog]->synth_pad_creator->set_base_note(
-		AdjSynth::get_instance()->synth_program[prog]->program_wavetable, bnot);
+	// Applies to the next generated wavetable
+	AdjSynth::get_instance()->synth_program[prog]->synth_pad_creator->set_base_note(NULL, bnot);
 	return 0;
 }
 
@@ -44,7 +44,8 @@ SynthVoice::SynthVoice(
 
 	voice_num = vnum;
 	set_allocated_program(prg);
-	allocated_to_program_voice_num = -1;
+	active_count_program = -1;
+	params_program = -1;
 	ModSynthSettings::settings_params_deep_copy(&active_params, params);
 		
 	dsp_voice = new DSP_Voice(voice_num, sample_rate, audio_block_size, mso_wtab, pad_wavetable);
@@ -181,6 +182,75 @@ void SynthVoice::set_allocated_program(int prg)
 */
 int SynthVoice::get_allocated_program() { return allocated_to_program_num;  }
 
+/**
+*   @brief  Bind the voice to a program: the voice plays the program wavetables and
+*			its dsp voice is set with the program patch parameters.
+*			The parameters are applied only if the dsp voice does not already hold them:
+*			a program patch snapshot is shared while the patch is not changed, so the
+*			voice is set again only if the program or its patch were changed.
+*   @param  prg					program number
+*   @param	patch_snapshot		a pointer to a program patch snapshot; the caller reference 
+*								is taken by the voice
+*   @param	mso_tab				a pointer to the program DSP_MorphingSinusOscWTAB object
+*   @param	synth_pad_wavetable_source	a pointer to the program published PAD Wavetable pointer
+*   @return void
+*/
+void SynthVoice::bind_program(int prg, 
+	settings_snapshot_t *patch_snapshot,
+	DSP_MorphingSinusOscWTAB *mso_tab,
+	Wavetable **synth_pad_wavetable_source)
+{
+	set_allocated_program(prg);
+
+	mso_wtab = mso_tab;
+	dsp_voice->set_wavetables(mso_wtab, synth_pad_wavetable_source);
+	pad_wavetable = dsp_voice->pad_wavetable;
+
+	set_patch_snapshot(prg, patch_snapshot);
+}
+
+/**
+*   @brief  Set the dsp voice with a program patch snapshot parameters, if it does not
+*			already hold them. Snapshots released here are deleted later by the editing
+*			threads (see ModSynthSettings::release_snapshot()).
+*   @param  prg					program number
+*   @param	patch_snapshot		a pointer to a program patch snapshot; the caller reference 
+*								is taken by the voice (NULL: the parameters are not changed)
+*   @return void
+*/
+void SynthVoice::set_patch_snapshot(int prg, settings_snapshot_t *patch_snapshot)
+{
+	if (patch_snapshot == NULL)
+	{
+		return;
+	}
+
+	if ((params_program != prg) || (params_snapshot != patch_snapshot))
+	{
+		params_program = prg;
+		set_voice_params(&patch_snapshot->params);
+		ModSynthSettings::release_snapshot(params_snapshot);
+		params_snapshot = patch_snapshot;
+	}
+	else
+	{
+		// Already set from this snapshot
+		ModSynthSettings::release_snapshot(patch_snapshot);
+	}
+}
+
+/**
+*   @brief  Return true if the voice is playing (releasing, or about to start) a note of the program
+*   @param  prg		program number
+*   @return true if the voice is playing (releasing, or about to start) a note of the program
+*/
+bool SynthVoice::is_bound_to_program(int prg)
+{
+	return (audio_voice->is_voice_active() || audio_voice->is_voice_wait_for_not_active() ||
+			audio_voice->has_pending_events()) &&
+		(allocated_to_program_num == prg) && (params_program == prg);
+}
+
 /**
 *   @brief  Calculate next voice output audio block samples and transmit the blocks
 *   @param  none
@@ -239,91 +309,89 @@ void SynthVoice::assign_dsp_voice(DSP_Voice *dspv)
 _setting_params_t *SynthVoice::get_voice_params() { return &active_params;  }
 
 /**
-*   @brief  Set the paramters (patch) using the setting parameters
+*   @brief  Set the paramters (patch) using the setting parameters.
+*			Parameters are read by their identifiers (no string keys lookups); a program 
+*			patch snapshot index is built once, when the snapshot is taken.
 *   @parm	params	 a pointer to a _setting_params_t struct holding the parameters (patch)
 *   @return void
 */
 void SynthVoice::set_voice_params(_setting_params_t *params)
 {
 	int i, j = 0, res;
+	int int_value;
+	bool bool_value;
 	
-	_mod_synth_settings_bool_param_t bool_param;
-	_mod_synth_settings_int_param_t int_param;
-	
-	res = settings_manager->get_bool_param(params, "adjsynth.osc1.enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_OSC1_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1_active = bool_param.value;
+		dsp_voice->osc1_active = bool_value;
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.waveform", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_WAVEFORM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_waveform(int_param.value);
+		dsp_voice->osc1->set_waveform(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.tune_offset_oct", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_TUNE_OFFSET_OCT, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_freq_detune_oct(int_param.value);
+		dsp_voice->osc1->set_freq_detune_oct(int_value);
 	}
 	 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.tune_offset_semitones", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_TUNE_OFFSET_SEMITONES, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_freq_detune_semitones(int_param.value);
+		dsp_voice->osc1->set_freq_detune_semitones(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.tune_offset_cents", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_TUNE_OFFSET_CENTS, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_freq_detune_cents_set_value(int_param.value);
+		dsp_voice->osc1->set_freq_detune_cents_set_value(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_pwm_dcycle_set_val(int_param.value);
-		dsp_voice->osc1->set_pwm_dcycle(int_param.value);
+		dsp_voice->osc1->set_pwm_dcycle_set_val(int_value);
+		dsp_voice->osc1->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.send_filter_1", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_SEND_FILTER_1, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_send_filter1_level(int_param.value);
+		dsp_voice->set_osc1_send_filter1_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.send_filter_2", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_SEND_FILTER_2, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_send_filter2_level(int_param.value);
+		dsp_voice->set_osc1_send_filter2_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_detune", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_DETUNE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmonies_detune(int_param.value);
+		dsp_voice->osc1->set_harmonies_detune(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_distortion", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_DISTORTION, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmonies_distortion(int_param.value);
+		dsp_voice->osc1->set_harmonies_distortion(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_mode", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_MODE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_unison_mode(int_param.value);
-		// callback to GUI for updating unison mode and labales.
-		callback_set_osc1_unison_mode(int_param.value);
-
+		dsp_voice->osc1->set_unison_mode(int_value);
 	}
 	
-	res = settings_manager->get_bool_param(params, "adjsynth.osc1.unison_square_wave", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_OSC1_UNISON_SQUARE_WAVE, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		if (bool_param.value)
+		if (bool_value)
 		{
 			dsp_voice->osc1->enable_unison_square();
 		}
@@ -334,186 +402,186 @@ void SynthVoice::set_voice_params(_setting_params_t *params)
 
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_1", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_1, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(0, int_param.value);
+		dsp_voice->osc1->set_harmony_level(0, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_2", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_2, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(1, int_param.value);
+		dsp_voice->osc1->set_harmony_level(1, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_3", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_3, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(2, int_param.value);
+		dsp_voice->osc1->set_harmony_level(2, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_4", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_4, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(3, int_param.value);
+		dsp_voice->osc1->set_harmony_level(3, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_5", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_5, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(4, int_param.value);
+		dsp_voice->osc1->set_harmony_level(4, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_6", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_6, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(5, int_param.value);
+		dsp_voice->osc1->set_harmony_level(5, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_7", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_7, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(6, int_param.value);
+		dsp_voice->osc1->set_harmony_level(6, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_8", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_8, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(7, int_param.value);
+		dsp_voice->osc1->set_harmony_level(7, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.unison_level_9", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_UNISON_LEVEL_9, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc1->set_harmony_level(8, int_param.value);
+		dsp_voice->osc1->set_harmony_level(8, int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.freq_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_FREQ_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_freq_mod_lfo(int_param.value);
+		dsp_voice->set_osc1_freq_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.freq_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_FREQ_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_freq_mod_lfo_level(int_param.value);
+		dsp_voice->set_osc1_freq_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.freq_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_FREQ_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_freq_mod_env(int_param.value);
+		dsp_voice->set_osc1_freq_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.freq_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_FREQ_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_freq_mod_env_level(int_param.value);
+		dsp_voice->set_osc1_freq_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.pwm_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_PWM_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_pwm_mod_lfo(int_param.value);
+		dsp_voice->set_osc1_pwm_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.pwm_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_PWM_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_pwm_mod_lfo_level(int_param.value);
+		dsp_voice->set_osc1_pwm_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.pwm_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_PWM_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_pwm_mod_env(int_param.value);
+		dsp_voice->set_osc1_pwm_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.pwm_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_PWM_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_pwm_mod_env_level(int_param.value);
+		dsp_voice->set_osc1_pwm_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.amp_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_AMP_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_lfo(int_param.value);
+		dsp_voice->set_osc1_amp_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.amp_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_AMP_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_lfo_level(int_param.value);
+		dsp_voice->set_osc1_amp_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.amp_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_AMP_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_env(int_param.value);
+		dsp_voice->set_osc1_amp_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc1.amp_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC1_AMP_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_env_level(int_param.value);
+		dsp_voice->set_osc1_amp_mod_env_level(int_value);
 	}
 	
 
-	res = settings_manager->get_bool_param(params, "adjsynth.osc2.enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_OSC2_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc2_active = bool_param.value;
+		dsp_voice->osc2_active = bool_value;
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.waveform", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_WAVEFORM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc2->set_waveform(int_param.value);
+		dsp_voice->osc2->set_waveform(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.tune_offset_oct", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_TUNE_OFFSET_OCT, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc2->set_freq_detune_oct(int_param.value);
+		dsp_voice->osc2->set_freq_detune_oct(int_value);
 	}
 	 
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.tune_offset_semitones", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_TUNE_OFFSET_SEMITONES, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc2->set_freq_detune_semitones(int_param.value);
+		dsp_voice->osc2->set_freq_detune_semitones(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.tune_offset_cents", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_TUNE_OFFSET_CENTS, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc2->set_freq_detune_cents_set_value(int_param.value);
+		dsp_voice->osc2->set_freq_detune_cents_set_value(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->osc2->set_pwm_dcycle_set_val(int_param.value);
-		dsp_voice->osc2->set_pwm_dcycle(int_param.value);
+		dsp_voice->osc2->set_pwm_dcycle_set_val(int_value);
+		dsp_voice->osc2->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.send_filter_1", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_SEND_FILTER_1, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc2_send_filter1_level(int_param.value);
+		dsp_voice->set_osc2_send_filter1_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.send_filter_2", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_SEND_FILTER_2, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc2_send_filter2_level(int_param.value);
+		dsp_voice->set_osc2_send_filter2_level(int_value);
 	}
 	
-	res = settings_manager->get_bool_param(params, "adjsynth.osc2.sync_on_osc_1", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_OSC2_SYNC_ON_OSC_1, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		if (int_param.value)
+		if (int_value)
 		{
 			dsp_voice->set_osc2_sync_on_osc1();
 		}
@@ -525,593 +593,593 @@ void SynthVoice::set_voice_params(_setting_params_t *params)
 	
 	//	dsp_voice->osc2->setFixToneState(params->osc2FixToneIsOn);	
 	
-		res = settings_manager->get_int_param(params, "adjsynth.osc2.freq_modulation_lfo_num", &int_param);
+		res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_FREQ_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_freq_mod_lfo(int_param.value);
+		dsp_voice->set_osc1_freq_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.freq_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_FREQ_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_freq_mod_lfo_level(int_param.value);
+		dsp_voice->set_osc1_freq_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.freq_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_FREQ_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_pwm_mod_env(int_param.value);
+		dsp_voice->set_osc1_pwm_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.freq_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_FREQ_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc2_freq_mod_env_level(int_param.value);
+		dsp_voice->set_osc2_freq_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.pwm_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_PWM_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_pwm_mod_lfo(int_param.value);
+		dsp_voice->set_osc1_pwm_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.pwm_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_PWM_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_freq_mod_lfo_level(int_param.value);
+		dsp_voice->set_osc1_freq_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.pwm_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_PWM_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_pwm_mod_env(int_param.value);
+		dsp_voice->set_osc1_pwm_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.pwm_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_PWM_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc2_pwm_mod_env_level(int_param.value);
+		dsp_voice->set_osc2_pwm_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.amp_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_AMP_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_lfo(int_param.value);
+		dsp_voice->set_osc1_amp_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.amp_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_AMP_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_lfo_level(int_param.value);
+		dsp_voice->set_osc1_amp_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.amp_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_AMP_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_env(int_param.value);
+		dsp_voice->set_osc1_amp_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.osc2.amp_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_OSC2_AMP_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_osc1_amp_mod_env_level(int_param.value);
+		dsp_voice->set_osc1_amp_mod_env_level(int_value);
 	}
 	
 	
-	res = settings_manager->get_bool_param(params, "adjsynth.noise.enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_NOISE_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->noise1_active = int_param.value;
+		dsp_voice->noise1_active = int_value;
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.noise.color", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_NOISE_COLOR, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->noise1->set_noise_type(int_param.value);
+		dsp_voice->noise1->set_noise_type(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.noise.send_filter_1", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_NOISE_SEND_FILTER_1, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_noise1_send_filter1_level(int_param.value);
+		dsp_voice->set_noise1_send_filter1_level(int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.noise.send_filter_2", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_NOISE_SEND_FILTER_2, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_noise1_send_filter2_level(int_param.value);
+		dsp_voice->set_noise1_send_filter2_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.noise.amp_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_NOISE_AMP_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_noise_amp_mod_lfo(int_param.value);
+		dsp_voice->set_noise_amp_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.noise.amp_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_NOISE_AMP_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_noise_amp_mod_lfo_level(int_param.value);
+		dsp_voice->set_noise_amp_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.noise.amp_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_NOISE_AMP_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_noise_amp_mod_env(int_param.value);
+		dsp_voice->set_noise_amp_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.noise.amp_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_NOISE_AMP_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_noise_amp_mod_env_level(int_param.value);
+		dsp_voice->set_noise_amp_mod_env_level(int_value);
 	}
 
 	
-	res = settings_manager->get_bool_param(params, "adjsynth.karplus_synth.enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_KARPLUS_SYNTH_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karpuls1_active = int_param.value;
+		dsp_voice->karpuls1_active = int_value;
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.excitation_waveform_type", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_EXCITATION_WAVEFORM_TYPE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_excitation_waveform_type(int_param.value);
+		dsp_voice->karplus1->set_excitation_waveform_type(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.excitation_waveform_variations", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_EXCITATION_WAVEFORM_VARIATIONS, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_excitation_waveform_variations(int_param.value);
+		dsp_voice->karplus1->set_excitation_waveform_variations(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.string_damping", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_STRING_DAMPING, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_string_damping(int_param.value);
+		dsp_voice->karplus1->set_string_damping(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.string_damping_variations", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_STRING_DAMPING_VARIATIONS, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_string_damping_variation(int_param.value);
+		dsp_voice->karplus1->set_string_damping_variation(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.string_damping_calculation_mode", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_STRING_DAMPING_CALCULATION_MODE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_string_dumping_calculation_mode(int_param.value);
+		dsp_voice->karplus1->set_string_dumping_calculation_mode(int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.pluck_damping", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_PLUCK_DAMPING, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_pluck_damping(int_param.value);
+		dsp_voice->karplus1->set_pluck_damping(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.pluck_damping_variations", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_PLUCK_DAMPING_VARIATIONS, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_pluck_damping_variation(int_param.value);
+		dsp_voice->karplus1->set_pluck_damping_variation(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.on_decay", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_ON_DECAY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_on_decay(int_param.value);
+		dsp_voice->karplus1->set_on_decay(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.off_decay", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_OFF_DECAY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->karplus1->set_off_decay(int_param.value);
+		dsp_voice->karplus1->set_off_decay(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.send_filter_1", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_SEND_FILTER_1, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_karplus1_send_filter1_level(int_param.value);
+		dsp_voice->set_karplus1_send_filter1_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.karplus_synth.send_filter_2", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_KARPLUS_SYNTH_SEND_FILTER_2, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_karplus1_send_filter2_level(int_param.value);
+		dsp_voice->set_karplus1_send_filter2_level(int_value);
 	}
 
 	
-	res = settings_manager->get_bool_param(params, "adjsynth.mso_synth.enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_MSO_SYNTH_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1_active = int_param.value;
+		dsp_voice->mso1_active = int_value;
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->set_pwm_dcycle(int_param.value);
+		dsp_voice->mso1->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.send_filter_1", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEND_FILTER_1, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_send_filter1_level(int_param.value);
+		dsp_voice->set_mso1_send_filter1_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.send_filter_2", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEND_FILTER_2, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_send_filter2_level(int_param.value);
+		dsp_voice->set_mso1_send_filter2_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.tune_offset_oct", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_TUNE_OFFSET_OCT, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->set_freq_detune_oct(int_param.value);
+		dsp_voice->mso1->set_freq_detune_oct(int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.tune_offset_semitones", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_TUNE_OFFSET_SEMITONES, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->set_freq_detune_semitones(int_param.value);
+		dsp_voice->mso1->set_freq_detune_semitones(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.tune_offset_cents", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_TUNE_OFFSET_CENTS, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->set_freq_detune_cents(int_param.value);
+		dsp_voice->mso1->set_freq_detune_cents(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.freq_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_FREQ_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_freq_mod_lfo(int_param.value);
+		dsp_voice->set_mso1_freq_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.freq_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_FREQ_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_freq_mod_lfo_level(int_param.value);
+		dsp_voice->set_mso1_freq_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.freq_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_FREQ_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_freq_mod_env(int_param.value);
+		dsp_voice->set_mso1_freq_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.freq_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_FREQ_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_freq_mod_env_level(int_param.value);
+		dsp_voice->set_mso1_freq_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.pwm_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_PWM_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_pwm_mod_lfo(int_param.value);
+		dsp_voice->set_mso1_pwm_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.pwm_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_PWM_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_pwm_mod_lfo_level(int_param.value);
+		dsp_voice->set_mso1_pwm_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.pwm_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_PWM_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_freq_mod_env(int_param.value);
+		dsp_voice->set_mso1_freq_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.pwm_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_PWM_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_pwm_mod_env_level(int_param.value);
+		dsp_voice->set_mso1_pwm_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.amp_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_AMP_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_amp_mod_lfo(int_param.value);
+		dsp_voice->set_mso1_amp_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.amp_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_AMP_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_amp_mod_lfo_level(int_param.value);
+		dsp_voice->set_mso1_amp_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.amp_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_AMP_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_freq_mod_env(int_param.value);
+		dsp_voice->set_mso1_freq_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.amp_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_AMP_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_mso1_amp_mod_env_level(int_param.value);
+		dsp_voice->set_mso1_amp_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.segment_position_a", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_A, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->wtab->set_segment_position(pos_a, int_param.value, &dsp_voice->mso1->wtab->morphed_segment_positions);
+		dsp_voice->mso1->wtab->set_segment_position(pos_a, int_value, &dsp_voice->mso1->wtab->morphed_segment_positions);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.segment_position_b", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_B, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->wtab->set_segment_position(pos_b, int_param.value, &dsp_voice->mso1->wtab->morphed_segment_positions);
+		dsp_voice->mso1->wtab->set_segment_position(pos_b, int_value, &dsp_voice->mso1->wtab->morphed_segment_positions);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.segment_position_c", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_C, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->wtab->set_segment_position(pos_c, int_param.value, &dsp_voice->mso1->wtab->morphed_segment_positions);
+		dsp_voice->mso1->wtab->set_segment_position(pos_c, int_value, &dsp_voice->mso1->wtab->morphed_segment_positions);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.segment_position_d", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_D, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->wtab->set_segment_position(pos_d, int_param.value, &dsp_voice->mso1->wtab->morphed_segment_positions);
+		dsp_voice->mso1->wtab->set_segment_position(pos_d, int_value, &dsp_voice->mso1->wtab->morphed_segment_positions);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.segment_position_e", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_E, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->wtab->set_segment_position(pos_e, int_param.value, &dsp_voice->mso1->wtab->morphed_segment_positions);
+		dsp_voice->mso1->wtab->set_segment_position(pos_e, int_value, &dsp_voice->mso1->wtab->morphed_segment_positions);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.mso_synth.segment_position_f", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_MSO_SYNTH_SEGMENT_POSITION_F, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->mso1->wtab->set_segment_position(pos_f, int_param.value, &dsp_voice->mso1->wtab->morphed_segment_positions);
+		dsp_voice->mso1->wtab->set_segment_position(pos_f, int_value, &dsp_voice->mso1->wtab->morphed_segment_positions);
 	}
 	
 	
-	res = settings_manager->get_bool_param(params, "adjsynth.pad_synth.enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_PAD_SYNTH_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->wavetable1_active = int_param.value;
+		dsp_voice->wavetable1_active = int_value;
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.send_filter_1", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_SEND_FILTER_1, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_send_filter1_level(int_param.value);
+		dsp_voice->set_pad1_send_filter1_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.send_filter_2", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_SEND_FILTER_2, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_send_filter2_level(int_param.value);
+		dsp_voice->set_pad1_send_filter2_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.tune_offset_octave", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_TUNE_OFFSET_OCTAVE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->wavetable1->set_freq_detune_oct(int_param.value);
+		dsp_voice->wavetable1->set_freq_detune_oct(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.tune_offset_semitones", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_TUNE_OFFSET_SEMITONES, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->wavetable1->set_freq_detune_semitones(int_param.value);
+		dsp_voice->wavetable1->set_freq_detune_semitones(int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.tune_offset_cents", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_TUNE_OFFSET_CENTS, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->wavetable1->set_freq_detune_cents(int_param.value);
+		dsp_voice->wavetable1->set_freq_detune_cents(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.freq_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_FREQ_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_freq_mod_lfo(int_param.value);
+		dsp_voice->set_pad1_freq_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.freq_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_FREQ_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_freq_mod_lfo_level(int_param.value);
+		dsp_voice->set_pad1_freq_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.freq_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_FREQ_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_freq_mod_env(int_param.value);
+		dsp_voice->set_pad1_freq_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.freq_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_FREQ_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_freq_mod_env_level(int_param.value);
+		dsp_voice->set_pad1_freq_mod_env_level(int_value);
 	}
 
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.amp_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_AMP_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_amp_mod_lfo(int_param.value);
+		dsp_voice->set_pad1_amp_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.amp_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_AMP_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_amp_mod_lfo_level(int_param.value);
+		dsp_voice->set_pad1_amp_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.amp_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_AMP_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_amp_mod_env(int_param.value);
+		dsp_voice->set_pad1_amp_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.pad_synth.amp_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_PAD_SYNTH_AMP_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_pad1_amp_mod_env_level(int_param.value);
+		dsp_voice->set_pad1_amp_mod_env_level(int_value);
 	}
 
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.frequency", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_FREQUENCY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter1->set_frequency(int_param.value);
+		dsp_voice->filter1->set_frequency(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.octave", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_OCTAVE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter1->set_octave(int_param.value);
+		dsp_voice->filter1->set_octave(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.q", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_Q, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter1->set_resonance(int_param.value);
+		dsp_voice->filter1->set_resonance(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.keyboard_track", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_KEYBOARD_TRACK, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter1->set_kbd_track(int_param.value);
+		dsp_voice->filter1->set_kbd_track(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.band", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_BAND, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter1->set_band(int_param.value);
+		dsp_voice->filter1->set_band(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.freq_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_FREQ_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_amp2_pan_mod_lfo(int_param.value);
+		dsp_voice->set_amp2_pan_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.freq_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_FREQ_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_amp2_pan_mod_lfo_level(int_param.value);
+		dsp_voice->set_amp2_pan_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.freq_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_FREQ_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_filter1_freq_mod_env(int_param.value);
+		dsp_voice->set_filter1_freq_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter1.freq_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER1_FREQ_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_filter1_freq_mod_env_level(int_param.value);
+		dsp_voice->set_filter1_freq_mod_env_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.frequency", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_FREQUENCY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter2->set_frequency(int_param.value);
+		dsp_voice->filter2->set_frequency(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.octave", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_OCTAVE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter2->set_octave(int_param.value);
+		dsp_voice->filter2->set_octave(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.q", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_Q, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter2->set_resonance(int_param.value);
+		dsp_voice->filter2->set_resonance(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.keyboard_track", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_KEYBOARD_TRACK, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter2->set_kbd_track(int_param.value);
+		dsp_voice->filter2->set_kbd_track(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.band", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_BAND, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->filter2->set_band(int_param.value);
+		dsp_voice->filter2->set_band(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.freq_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_FREQ_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_filter1_freq_mod_lfo(int_param.value);
+		dsp_voice->set_filter1_freq_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.freq_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_FREQ_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_filter1_freq_mod_lfo_level(int_param.value);
+		dsp_voice->set_filter1_freq_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.freq_modulation_env_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_FREQ_MODULATION_ENV_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_filter1_freq_mod_env(int_param.value);
+		dsp_voice->set_filter1_freq_mod_env(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.filter2.freq_modulation_env_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_FILTER2_FREQ_MODULATION_ENV_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_filter1_freq_mod_env_level(int_param.value);
+		dsp_voice->set_filter1_freq_mod_env_level(int_value);
 	}
 	
 	
-	res = settings_manager->get_int_param(params, "adjsynth.distortion_1.blend", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_DISTORTION_1_BLEND, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->distortion1->set_blend((float)int_param.value / 100.f);
+		dsp_voice->distortion1->set_blend((float)int_value / 100.f);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.distortion_1.drive", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_DISTORTION_1_DRIVE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->distortion1->set_drive((float)int_param.value / 100.f);
+		dsp_voice->distortion1->set_drive((float)int_value / 100.f);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.distortion_1.range", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_DISTORTION_1_RANGE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->distortion1->set_range((float)int_param.value / 100.f);
+		dsp_voice->distortion1->set_range((float)int_value / 100.f);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.distortion_2.blend", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_DISTORTION_2_BLEND, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->distortion2->set_blend((float)int_param.value / 100.f);
+		dsp_voice->distortion2->set_blend((float)int_value / 100.f);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.distortion_2.drive", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_DISTORTION_2_DRIVE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->distortion2->set_drive((float)int_param.value / 100.f);
+		dsp_voice->distortion2->set_drive((float)int_value / 100.f);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.distortion_2.range", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_DISTORTION_2_RANGE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->distortion2->set_range((float)int_param.value / 100.f);
+		dsp_voice->distortion2->set_range((float)int_value / 100.f);
 	}
 
-	res = settings_manager->get_bool_param(params, "adjsynth.distortion.enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_DISTORTION_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->distortion1_active = bool_param.value;
-		dsp_voice->distortion2_active = bool_param.value;	
+		dsp_voice->distortion1_active = bool_value;
+		dsp_voice->distortion2_active = bool_value;	
 	}
 	
-	res = settings_manager->get_bool_param(params, "adjsynth.distortion.auto_gain_enabled", &bool_param);
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_DISTORTION_AUTO_GAIN_ENABLED, &bool_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		if (bool_param.value)
+		if (bool_value)
 		{
 			dsp_voice->distortion1->enable_auto_gain();
 			dsp_voice->distortion2->enable_auto_gain();
@@ -1123,267 +1191,280 @@ void SynthVoice::set_voice_params(_setting_params_t *params)
 		}
 	}
 	
+	res = settings_manager->get_bool_param_value(params, _PARAM_ID_AMP_FIXED_LEVELS_ENABLED, &bool_value);
+	if (res == _SETTINGS_KEY_FOUND)
+	{
+		if (bool_value == _AMP_FIXED_LEVELS_ENABLE)
+		{
+			dsp_voice->out_amp->enable_fixed_levels();
+		}
+		else
+		{
+			dsp_voice->out_amp->disable_fixed_levels();
+		}
+	}
+	
 	// Changed to AudioMixer for programs support?
 	if(dsp_voice->out_amp->levels_are_fixed() == false)
 	{
-		res = settings_manager->get_int_param(params, "adjsynth.amp_ch1.level", &int_param);
+		res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH1_LEVEL, &int_value);
 		if (res == _SETTINGS_KEY_FOUND)
 		{
-			dsp_voice->out_amp->set_ch1_gain(int_param.value);
+			dsp_voice->out_amp->set_ch1_gain(int_value);
 		}
 		
-		res = settings_manager->get_int_param(params, "adjsynth.amp_ch1.pan", &int_param);
+		res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH1_PAN, &int_value);
 		if (res == _SETTINGS_KEY_FOUND)
 		{
-			dsp_voice->out_amp->set_ch1_pan(int_param.value);
+			dsp_voice->out_amp->set_ch1_pan(int_value);
 		}
 		
-		res = settings_manager->get_int_param(params, "adjsynth.amp_ch2.level", &int_param);
+		res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH2_LEVEL, &int_value);
 		if (res == _SETTINGS_KEY_FOUND)
 		{
-			dsp_voice->out_amp->set_ch2_gain(int_param.value);
+			dsp_voice->out_amp->set_ch2_gain(int_value);
 		}
 		
-		res = settings_manager->get_int_param(params, "adjsynth.amp_ch2.pan", &int_param);
+		res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH2_PAN, &int_value);
 		if (res == _SETTINGS_KEY_FOUND)
 		{
-			dsp_voice->out_amp->set_ch2_pan(int_param.value);
+			dsp_voice->out_amp->set_ch2_pan(int_value);
 		}
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.amp_ch1.pan_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH1_PAN_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_amp1_pan_mod_lfo(int_param.value);
+		dsp_voice->set_amp1_pan_mod_lfo(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.amp_ch1.pan_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH1_PAN_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_amp1_pan_mod_lfo_level(int_param.value);
+		dsp_voice->set_amp1_pan_mod_lfo_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.amp_ch2.pan_modulation_lfo_num", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH2_PAN_MODULATION_LFO_NUM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_amp2_pan_mod_lfo(int_param.value);		
+		dsp_voice->set_amp2_pan_mod_lfo(int_value);		
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.amp_ch2.pan_modulation_lfo_level", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_AMP_CH2_PAN_MODULATION_LFO_LEVEL, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_amp2_pan_mod_lfo_level(int_param.value);
+		dsp_voice->set_amp2_pan_mod_lfo_level(int_value);
 	}
 	
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_1.waveform", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_1_WAVEFORM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo1->set_waveform(int_param.value);
+		dsp_voice->lfo1->set_waveform(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_1.rate", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_1_RATE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_lfo1_frequency(int_param.value);
+		dsp_voice->set_lfo1_frequency(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_1.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_1_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo1->set_pwm_dcycle(int_param.value);
+		dsp_voice->lfo1->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_2.waveform", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_2_WAVEFORM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo2->set_waveform(int_param.value);
+		dsp_voice->lfo2->set_waveform(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_2.rate", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_2_RATE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_lfo2_frequency(int_param.value);
+		dsp_voice->set_lfo2_frequency(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_2.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_2_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo2->set_pwm_dcycle(int_param.value);
+		dsp_voice->lfo2->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_3.waveform", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_3_WAVEFORM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo3->set_waveform(int_param.value);
+		dsp_voice->lfo3->set_waveform(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_3.rate", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_3_RATE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_lfo3_frequency(int_param.value);
+		dsp_voice->set_lfo3_frequency(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_3.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_3_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo3->set_pwm_dcycle(int_param.value);
+		dsp_voice->lfo3->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_4.waveform", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_4_WAVEFORM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo4->set_waveform(int_param.value);
+		dsp_voice->lfo4->set_waveform(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_4.rate", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_4_RATE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_lfo4_frequency(int_param.value);
+		dsp_voice->set_lfo4_frequency(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_4.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_4_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo4->set_pwm_dcycle(int_param.value);
+		dsp_voice->lfo4->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_5.waveform", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_5_WAVEFORM, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo5->set_waveform(int_param.value);
+		dsp_voice->lfo5->set_waveform(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_5.rate", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_5_RATE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->set_lfo5_frequency(int_param.value);
+		dsp_voice->set_lfo5_frequency(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.lfo_5.symmetry", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_LFO_5_SYMMETRY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->lfo5->set_pwm_dcycle(int_param.value);
+		dsp_voice->lfo5->set_pwm_dcycle(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_1.attack", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_1_ATTACK, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr1->set_attack_time_sec(int_param.value);
+		dsp_voice->adsr1->set_attack_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_1.decay", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_1_DECAY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr1->set_decay_time_sec(int_param.value);
+		dsp_voice->adsr1->set_decay_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_1.sustain", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_1_SUSTAIN, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr1->set_sustain_level(int_param.value);
+		dsp_voice->adsr1->set_sustain_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_1.release", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_1_RELEASE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr1->set_release_time_sec(int_param.value);
+		dsp_voice->adsr1->set_release_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_2.attack", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_2_ATTACK, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr2->set_attack_time_sec(int_param.value);
+		dsp_voice->adsr2->set_attack_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_2.decay", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_2_DECAY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr2->set_decay_time_sec(int_param.value);
+		dsp_voice->adsr2->set_decay_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_2.sustain", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_2_SUSTAIN, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr2->set_sustain_level(int_param.value);
+		dsp_voice->adsr2->set_sustain_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_2.release", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_2_RELEASE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr2->set_release_time_sec(int_param.value);
+		dsp_voice->adsr2->set_release_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_3.attack", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_3_ATTACK, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr3->set_attack_time_sec(int_param.value);
+		dsp_voice->adsr3->set_attack_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_3.decay", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_3_DECAY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr3->set_decay_time_sec(int_param.value);
+		dsp_voice->adsr3->set_decay_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_3.sustain", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_3_SUSTAIN, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr3->set_sustain_level(int_param.value);
+		dsp_voice->adsr3->set_sustain_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_3.release", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_3_RELEASE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr3->set_release_time_sec(int_param.value);
+		dsp_voice->adsr3->set_release_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_4.attack", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_4_ATTACK, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr4->set_attack_time_sec(int_param.value);
+		dsp_voice->adsr4->set_attack_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_4.decay", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_4_DECAY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr4->set_decay_time_sec(int_param.value);
+		dsp_voice->adsr4->set_decay_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_4.sustain", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_4_SUSTAIN, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr4->set_sustain_level(int_param.value);
+		dsp_voice->adsr4->set_sustain_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_4.release", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_4_RELEASE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr4->set_release_time_sec(int_param.value);
+		dsp_voice->adsr4->set_release_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_5.attack", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_5_ATTACK, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr5->set_attack_time_sec(int_param.value);
+		dsp_voice->adsr5->set_attack_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_5.decay", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_5_DECAY, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr5->set_decay_time_sec(int_param.value);
+		dsp_voice->adsr5->set_decay_time_sec(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_5.sustain", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_5_SUSTAIN, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr5->set_sustain_level(int_param.value);
+		dsp_voice->adsr5->set_sustain_level(int_value);
 	}
 	
-	res = settings_manager->get_int_param(params, "adjsynth.env_5.release", &int_param);
+	res = settings_manager->get_int_param_value(params, _PARAM_ID_ENV_5_RELEASE, &int_value);
 	if (res == _SETTINGS_KEY_FOUND)
 	{
-		dsp_voice->adsr5->set_release_time_sec(int_param.value);
+		dsp_voice->adsr5->set_release_time_sec(int_value);
 	}	
 }
 
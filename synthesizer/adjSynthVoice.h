@@ -48,6 +48,13 @@ public:
 
 	void set_allocated_program(int prg);
 	int get_allocated_program();
+
+	void bind_program(int prg, 
+		settings_snapshot_t *patch_snapshot,
+		DSP_MorphingSinusOscWTAB *mso_tab,
+		Wavetable **synth_pad_wavetable_source);
+	void set_patch_snapshot(int prg, settings_snapshot_t *patch_snapshot);
+	bool is_bound_to_program(int prg);
 	
 	void update_all();
 
@@ -57,7 +64,9 @@ public:
 
 	int voice_num;
 	int allocated_to_program_num;
-	int allocated_to_program_voice_num;
+	// The program which active voices count includes this voice (-1: none);
+	// exchanged atomically so the voice is released once (MIDI steal or audio free)
+	int active_count_program;
 
 	DSP_MorphingSinusOscWTAB *mso_wtab = NULL;
 	Wavetable *pad_wavetable = NULL;
@@ -65,7 +74,11 @@ public:
 private:	
 	
 	// Play Mode: Poly, Solo, MIDI
-	int play_mode;	
+	int play_mode;
+	// The program which patch parameters the dsp voice currently holds (-1: none)
+	int params_program;
+	// The program patch snapshot the dsp voice parameters were set from (NULL: none)
+	settings_snapshot_t *params_snapshot = NULL;
 	bool update_in_progress;
 	bool update_enable;
 
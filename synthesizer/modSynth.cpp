@@ -194,6 +194,12 @@ void callback_audio_update_cycle_start_tasks_wrapper(int param)
 	ModSynth::get_instance()->update_tasks(param);
 }
 
+// Callback that is initiated by the PAD generator when a preset wavetables batch was switched.
+void callback_preset_wavetables_batch_commit_wrapper()
+{
+	ModSynth::get_instance()->switch_preset_programs();
+}
+
 // Settings callbacks
 int set_audio_driver_type_cb(int drive, int dummy)
 {
@@ -217,6 +223,9 @@ ModSynth::ModSynth()
 	mod_synth = this;
 	int i, res;
 
+	preset_pending_programs = 0;
+	pthread_mutex_init(&preset_switch_mutex, NULL);
+
 	serial_port = SerialPort::get_serial_port_instance(16); // 16=ttyUSB0
 
 	for (i = _PROGRAM_0; i < _PROGRAM_15; i++)
@@ -255,6 +264,7 @@ ModSynth::ModSynth()
 	init();
 
 	adj_synth->audio_manager->register_callback_audio_update_cycle_start_tasks(&callback_audio_update_cycle_start_tasks_wrapper);
+	SynthPADgenerator::get_instance()->register_batch_commit_callback(&callback_preset_wavetables_batch_commit_wrapper);
 
 	res = open_mod_synth_general_settings_file(adj_synth_general_settings_file_path_name);
 	if (res != 0)
@@ -295,6 +305,8 @@ ModSynth::~ModSynth()
 	fluid_synth->deinitialize_fluid_synthesizer();
 
 	stop_cheack_cpu_utilization_thread();
+
+	pthread_mutex_destroy(&preset_switch_mutex);
 }
 
 /**
@@ -787,17 +799,8 @@ int ModSynth::open_adj_synth_patch_file(string path, ModSynthSettings *settings,
 	{
 //		adj_synth->synth_program[channel]->set_program_patch_params(params);
 		
-		adj_synth->synth_program[channel]->synth_pad_creator->generate_wavetable(
-			adj_synth->synth_program[channel]->program_wavetable);
-
-		adj_synth->synth_program[channel]->mso_wtab->calc_segments_lengths(
-			&adj_synth->synth_program[channel]->mso_wtab->morphed_segment_lengths, 
-			&adj_synth->synth_program[channel]->mso_wtab->morphed_segment_positions);
-		
-		adj_synth->synth_program[channel]->mso_wtab->calc_wtab(
-			adj_synth->synth_program[channel]->mso_wtab->morphed_waveform_tab, 
-			&adj_synth->synth_program[channel]->mso_wtab->morphed_segment_lengths, 
-			&adj_synth->synth_program[channel]->mso_wtab->morphed_segment_positions);
+		// PAD and MSO wavetables are built in the background
+		adj_synth->synth_program[channel]->request_pad_wavetable_generation(_PAD_GEN_JOB_PAD | _PAD_GEN_JOB_MSO);
 		
 		//	printf("Open settings  %s\n", path.c_str());
 		return 0;
@@ -995,8 +998,8 @@ int ModSynth::open_mod_synth_preset_file(
 		presets = get_synth_temp_preset_params();
 		if (presets != NULL)
 		{			
-			ModSynthPresets::generate_summary(presets, summary);			
-			ModSynthPresets::set_synth_settings(presets);
+			ModSynthPresets::generate_summary(presets, summary);
+			set_mod_synth_preset(presets);
 		}
 		
 		ModSynthPresets::copy_presets(presets, preset);
@@ -1005,6 +1008,62 @@ int ModSynth::open_mod_synth_preset_file(
 	return res;
 }
 
+/**
+*   @brief  Set a preset. All the preset programs wavetables are built in parallel, and the
+*			programs patches are switched together with them when all are ready, by
+*			switch_preset_programs() (returns immediately; does not wait for the wavetables).
+*   @param  preset	a pointer to a mod_synth_preset_t presets object
+*   @return 0 if OK; _SETTINGS_BAD_PARAMETERS (-4) if preset is NULL
+*/
+int ModSynth::set_mod_synth_preset(mod_synth_preset_t *preset)
+{
+	int res;
+	uint32_t programs;
+
+	return_val_if_true(preset == NULL, _SETTINGS_BAD_PARAMETERS);
+
+	pthread_mutex_lock(&preset_switch_mutex);
+
+	// Until the wavetables are ready, new notes are bound to the current patches 
+	// and the playing voices are not updated (voices updates are deferred by the batch)
+	adj_synth->hold_programs_patch_snapshots(true);
+	ModSynthSettings::begin_params_batch();
+
+	SynthPADgenerator::get_instance()->begin_batch();
+	res = ModSynthPresets::set_synth_settings(preset);
+
+	// The deferred voices updates are committed by the batch commit callback
+	programs = ModSynthSettings::detach_params_batch();
+	__atomic_fetch_or(&preset_pending_programs, programs, __ATOMIC_ACQ_REL);
+
+	pthread_mutex_unlock(&preset_switch_mutex);
+
+	// May switch the preset right away (if no wavetables are generated)
+	SynthPADgenerator::get_instance()->end_batch();
+
+	return res;
+}
+
+/**
+*   @brief  Switch the set presets programs: publish the new patches snapshots, then update 
+*			the playing voices from them. Called by the PAD generator when the presets 
+*			wavetables batch was switched.
+*   @param  none
+*   @return void
+*/
+void ModSynth::switch_preset_programs()
+{
+	uint32_t programs;
+
+	pthread_mutex_lock(&preset_switch_mutex);
+
+	programs = __atomic_exchange_n(&preset_pending_programs, 0, __ATOMIC_ACQ_REL);
+	adj_synth->hold_programs_patch_snapshots(false);
+	ModSynthSettings::commit_params_batch_programs(programs);
+
+	pthread_mutex_unlock(&preset_switch_mutex);
+}
+
 /**
 *   @brief  Save a preset parameters as XML file
 *   @param  path settings XML file full path
@@ -1295,9 +1354,10 @@ void ModSynth::controller_event(uint8_t channel, uint8_t num, uint8_t val)
 	fprintf(stderr, "modSynth conroller channel %i  number %i  value %i\n", channel, num, val);
 	// Handle control mapping	
 	
-	if (get_midi_channel_synth(channel) == _MIDI_CHAN_ASSIGNED_SYNTH_ADJ)
+	if ((mod_synth_get_active_midi_mapping_mode() == _MIDI_MAPPING_MODE_SKETCH) ||
+		(get_midi_channel_synth(channel) == _MIDI_CHAN_ASSIGNED_SYNTH_ADJ))
 	{
-
+		AdjSynth::get_instance()->midi_control_change(channel, num, val);
 	}
 	else if (get_midi_channel_synth(channel) == _MIDI_CHAN_ASSIGNED_SYNTH_FLUID)
 	{
@@ -1308,9 +1368,10 @@ void ModSynth::controller_event(uint8_t channel, uint8_t num, uint8_t val)
 void ModSynth::pitch_bend(uint8_t channel, int pitch)
 {
 	fprintf(stderr, "modSynth pitch bend channel %i  pitch %i\n", channel, pitch);
-	if (get_midi_channel_synth(channel) == _MIDI_CHAN_ASSIGNED_SYNTH_ADJ)
+	if ((mod_synth_get_active_midi_mapping_mode() == _MIDI_MAPPING_MODE_SKETCH) ||
+		(get_midi_channel_synth(channel) == _MIDI_CHAN_ASSIGNED_SYNTH_ADJ))
 	{
-
+		AdjSynth::get_instance()->midi_pitch_bend(channel, pitch);
 	}
 	else if (get_midi_channel_synth(channel) == _MIDI_CHAN_ASSIGNED_SYNTH_FLUID)
 	{
@@ -1331,6 +1392,9 @@ void *cheack_cpu_utilization_thread(void *arg)
 		const float IDLE_TIME = curSnap.GetIdleTimeTotal() - previousSnap.GetIdleTimeTotal();
 		const float TOTAL_TIME = ACTIVE_TIME + IDLE_TIME;
 		ModSynth::cpu_utilization = (int)(100.f * ACTIVE_TIME / TOTAL_TIME);
+		
+		// Audio update cycles utilization - reported from here and not by the realtime cycles
+		callback_update_utilization_bar(AudioManager::get_instance()->get_update_cycle_utilization());
 	}
 
 	return NULL;
@@ -48,6 +48,7 @@ enum mod_synth_type
 };
 
 void callback_audio_update_cycle_start_tasks_wrapper(int param);
+void callback_preset_wavetables_batch_commit_wrapper();
 
 
 class ModSynth
@@ -129,6 +130,8 @@ public:
 		_setting_params_t *settings = NULL,
 		mod_synth_preset_t *preset = NULL,  
 		string *summary = NULL);
+	int set_mod_synth_preset(mod_synth_preset_t *preset);
+	void switch_preset_programs();
 	int collect_mod_synth_preset_parms(_setting_params_t *params);
 	int set_default_preset_parameters(_setting_params_t *params);
 
@@ -214,6 +217,11 @@ public:
 	uint16_t midi_channel_synth[_SKETCH_PROGRAM_3 + 1];
 	
 	pthread_t cheack_cpu_utilization_thread_id;	
+	
+	/* Programs bit mask of a set preset waiting for its wavetables (switched together) */
+	uint32_t preset_pending_programs;
+	/* Serializes a preset settings with its switching */
+	pthread_mutex_t preset_switch_mutex;
 };
 
 
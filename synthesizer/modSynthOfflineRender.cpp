@@ -0,0 +1,861 @@
+/**
+*	@file		modSynthOfflineRender.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Headless offline render engine and benchmark harness.
+*				Runs the same audio update cycle as the audio update thread
+*				(start tasks, voices update, poly-mixer, reverb, equalizer and
+*				output) back to back on the calling thread, so the synthesizer
+*				can be rendered and benchmarked without a sound card.
+*				The audio service is stopped while rendering; it is not
+*				restarted when done.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+
+#include "modSynthOfflineRender.h"
+#include "modSynth.h"
+#include "adjSynthPADgenerator.h"
+#include "../audio/audioManager.h"
+#include "../audio/audioLatencyStats.h"
+#include "../dsp/dspPrng.h"
+
+/**
+*   @brief  Create a ModSynthOfflineRenderer object instance.
+*			The synthesizer must be initialized (mod_synth_init()).
+*   @param  none
+*   @return none
+*/
+ModSynthOfflineRenderer::ModSynthOfflineRenderer()
+{
+	sample_rate = _DEFAULT_SAMPLE_RATE;
+	block_size = _DEFAULT_BLOCK_SIZE;
+	rendered_frames = 0;
+	interleaved = (float *)malloc(sizeof(float) * 2 * _AUDIO_MAX_BUF_SIZE);
+	memset(notes_held, 0, sizeof(notes_held));
+}
+
+ModSynthOfflineRenderer::~ModSynthOfflineRenderer()
+{
+	free(interleaved);
+}
+
+/**
+*   @brief  Remove all events.
+*   @param  none
+*   @return void
+*/
+void ModSynthOfflineRenderer::clear_events()
+{
+	events.clear();
+}
+
+/**
+*   @brief  Add an event.
+*   @param  time_sec	event time from the render start (seconds)
+*   @param  type		_OFFLINE_RENDER_EVENT_NOTE_ON, _OFFLINE_RENDER_EVENT_NOTE_OFF
+*						or _OFFLINE_RENDER_EVENT_PROGRAM_CHANGE
+*   @param  channel		MIDI channel 0-15
+*   @param  data1		note number or program number 0-127
+*   @param  data2		velocity 0-127 (note on)
+*   @return void
+*/
+void ModSynthOfflineRenderer::add_event(float time_sec, int type, int channel, int data1, int data2)
+{
+	offline_render_event_t event;
+
+	event.time_sec = time_sec < 0.0f ? 0.0 : (double)time_sec;
+	event.type = (uint8_t)type;
+	event.channel = (uint8_t)(channel & 0x0f);
+	event.data1 = (uint8_t)(data1 & 0x7f);
+	event.data2 = (uint8_t)(data2 & 0x7f);
+
+	events.push_back(event);
+}
+
+/**
+*   @brief  Add a note (note on and note off events).
+*   @param  start_sec		note on time (seconds)
+*   @param  duration_sec	note length (seconds)
+*   @param  channel			MIDI channel 0-15
+*   @param  note			note number 0-127
+*   @param  velocity		velocity 1-127
+*   @return void
+*/
+void ModSynthOfflineRenderer::add_note(float start_sec, float duration_sec, int channel, int note, int velocity)
+{
+	add_event(start_sec, _OFFLINE_RENDER_EVENT_NOTE_ON, channel, note, velocity);
+	add_event(start_sec + duration_sec, _OFFLINE_RENDER_EVENT_NOTE_OFF, channel, note, 0);
+}
+
+/**
+*   @brief  Load events from a file: a standard MIDI file (.mid, .midi) or a notes list.
+*   @param  path	file path
+*   @return 0 if done; -1 otherwise
+*/
+int ModSynthOfflineRenderer::load_events_file(const std::string &path)
+{
+	size_t dot = path.find_last_of('.');
+	std::string ext = dot == std::string::npos ? "" : path.substr(dot + 1);
+
+	std::transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+	if ((ext == "mid") || (ext == "midi"))
+	{
+		return load_midi_file(path);
+	}
+	else
+	{
+		return load_notes_list_file(path);
+	}
+}
+
+/**
+*   @brief  Load a notes list text file. Each line holds one note:\n
+*			start_sec duration_sec channel note velocity\n
+*			Empty lines and lines starting with '#' are ignored.
+*   @param  path	file path
+*   @return 0 if done; -1 otherwise
+*/
+int ModSynthOfflineRenderer::load_notes_list_file(const std::string &path)
+{
+	FILE *file;
+	char line[256];
+	float start, duration;
+	int channel, note, velocity, line_num = 0;
+
+	file = fopen(path.c_str(), "r");
+	if (file == NULL)
+	{
+		fprintf(stderr, "Offline render: unable to open notes list %s\n", path.c_str());
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), file))
+	{
+		line_num++;
+
+		if ((line[0] == '#') || (line[0] == '\n') || (line[0] == '\r') || (line[0] == 0))
+		{
+			continue;
+		}
+
+		if (sscanf(line, "%f %f %i %i %i", &start, &duration, &channel, &note, &velocity) != 5)
+		{
+			fprintf(stderr, "Offline render: %s line %i ignored\n", path.c_str(), line_num);
+			continue;
+		}
+
+		add_note(start, duration, channel, note, velocity);
+	}
+
+	fclose(file);
+
+	return 0;
+}
+
+/**
+*   @brief  Read a MIDI variable length quantity.
+*   @param  data	a pointer to the data pointer (advanced)
+*   @param  end		data end
+*   @return value
+*/
+static uint32_t midi_file_read_vlq(const uint8_t **data, const uint8_t *end)
+{
+	uint32_t value = 0;
+
+	while (*data < end)
+	{
+		uint8_t byte = *(*data)++;
+
+		value = (value << 7) | (byte & 0x7f);
+		if ((byte & 0x80) == 0)
+		{
+			break;
+		}
+	}
+
+	return value;
+}
+
+/**
+*   @brief  Read a MIDI file big endian number.
+*   @param  data			data pointer
+*   @param  num_of_bytes	number size in bytes (up to 4)
+*   @return value
+*/
+static uint32_t midi_file_read_be(const uint8_t *data, int num_of_bytes)
+{
+	uint32_t value = 0;
+
+	for (int i = 0; i < num_of_bytes; i++)
+	{
+		value = (value << 8) | data[i];
+	}
+
+	return value;
+}
+
+typedef struct midi_file_event
+{
+	uint32_t tick;
+	// Events order within a tick: file order
+	uint32_t order;
+	// Tempo change (us per quarter note) when type is 0xff
+	uint32_t tempo;
+	uint8_t type;
+	uint8_t channel;
+	uint8_t data1;
+	uint8_t data2;
+} midi_file_event_t;
+
+/**
+*   @brief  Load a standard MIDI file (format 0 or 1). Note on/off and program
+*			change events are used; tempo changes are applied.
+*   @param  path	file path
+*   @return 0 if done; -1 otherwise
+*/
+int ModSynthOfflineRenderer::load_midi_file(const std::string &path)
+{
+	FILE *file;
+	long size;
+	uint8_t *buf;
+	const uint8_t *p, *end, *track_end;
+	uint32_t division, num_of_tracks, len, tick, order = 0, us_per_quarter = 500000;
+	uint8_t status, running_status, meta;
+	std::vector<midi_file_event_t> midi_events;
+	midi_file_event_t ev;
+	double time_sec = 0.0, sec_per_tick;
+	uint32_t last_tick = 0;
+
+	file = fopen(path.c_str(), "rb");
+	if (file == NULL)
+	{
+		fprintf(stderr, "Offline render: unable to open MIDI file %s\n", path.c_str());
+		return -1;
+	}
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	buf = (uint8_t *)malloc(size > 0 ? size : 1);
+	if ((size < 14) || (fread(buf, 1, size, file) != (size_t)size) || (memcmp(buf, "MThd", 4) != 0))
+	{
+		fprintf(stderr, "Offline render: %s is not a MIDI file\n", path.c_str());
+		fclose(file);
+		free(buf);
+		return -1;
+	}
+
+	fclose(file);
+
+	end = buf + size;
+	num_of_tracks = midi_file_read_be(buf + 10, 2);
+	division = midi_file_read_be(buf + 12, 2);
+	p = buf + 8 + midi_file_read_be(buf + 4, 4);
+
+	for (uint32_t trk = 0; (trk < num_of_tracks) && (p + 8 <= end);)
+	{
+		len = midi_file_read_be(p + 4, 4);
+		if (memcmp(p, "MTrk", 4) != 0)
+		{
+			// Unknown chunk - skip
+			p += 8 + len;
+			continue;
+		}
+
+		trk++;
+
+		p += 8;
+		track_end = (p + len <= end) ? p + len : end;
+		tick = 0;
+		running_status = 0;
+
+		while (p < track_end)
+		{
+			tick += midi_file_read_vlq(&p, track_end);
+			if (p >= track_end)
+			{
+				break;
+			}
+
+			status = *p;
+			if (status & 0x80)
+			{
+				p++;
+			}
+			else
+			{
+				status = running_status;
+			}
+
+			memset(&ev, 0, sizeof(ev));
+			ev.tick = tick;
+			ev.order = order++;
+
+			if (status == 0xff)
+			{
+				if (p >= track_end)
+				{
+					break;
+				}
+
+				meta = *p++;
+				len = midi_file_read_vlq(&p, track_end);
+				if ((meta == 0x51) && (len == 3) && (p + 3 <= track_end))
+				{
+					ev.type = 0xff;
+					ev.tempo = midi_file_read_be(p, 3);
+					midi_events.push_back(ev);
+				}
+				else if (meta == 0x2f)
+				{
+					// End of track
+					p = track_end;
+					break;
+				}
+
+				p += len;
+			}
+			else if ((status == 0xf0) || (status == 0xf7))
+			{
+				// Sysex - skip
+				running_status = 0;
+				len = midi_file_read_vlq(&p, track_end);
+				p += len;
+			}
+			else if (status & 0x80)
+			{
+				running_status = status;
+				ev.channel = status & 0x0f;
+
+				switch (status & 0xf0)
+				{
+				case 0x80:
+				case 0x90:
+					if (p + 2 > track_end)
+					{
+						p = track_end;
+						break;
+					}
+
+					ev.data1 = p[0];
+					ev.data2 = p[1];
+					ev.type = (((status & 0xf0) == 0x90) && (ev.data2 > 0)) ?
+						_OFFLINE_RENDER_EVENT_NOTE_ON : _OFFLINE_RENDER_EVENT_NOTE_OFF;
+					midi_events.push_back(ev);
+					p += 2;
+					break;
+
+				case 0xc0:
+					ev.type = _OFFLINE_RENDER_EVENT_PROGRAM_CHANGE;
+					ev.data1 = *p;
+					midi_events.push_back(ev);
+					p += 1;
+					break;
+
+				case 0xd0:
+					p += 1;
+					break;
+
+				default:
+					// Polyphonic pressure, control change, pitch bend - not used
+					p += 2;
+					break;
+				}
+			}
+			else
+			{
+				// Data byte without running status - corrupted track
+				break;
+			}
+		}
+
+		p = track_end;
+	}
+
+	free(buf);
+
+	std::sort(midi_events.begin(), midi_events.end(),
+		[](const midi_file_event_t &a, const midi_file_event_t &b)
+		{ return (a.tick < b.tick) || ((a.tick == b.tick) && (a.order < b.order)); });
+
+	if (division & 0x8000)
+	{
+		// SMPTE: frames per second * ticks per frame
+		sec_per_tick = 1.0 / ((double)(-(int8_t)(division >> 8)) * (double)(division & 0xff));
+	}
+	else
+	{
+		sec_per_tick = (double)us_per_quarter / 1000000.0 / (double)(division ? division : 96);
+	}
+
+	for (size_t e = 0; e < midi_events.size(); e++)
+	{
+		time_sec += (double)(midi_events[e].tick - last_tick) * sec_per_tick;
+		last_tick = midi_events[e].tick;
+
+		if (midi_events[e].type == 0xff)
+		{
+			if (!(division & 0x8000) && (midi_events[e].tempo > 0))
+			{
+				sec_per_tick = (double)midi_events[e].tempo / 1000000.0 / (double)(division ? division : 96);
+			}
+
+			continue;
+		}
+
+		add_event((float)time_sec, midi_events[e].type, midi_events[e].channel, midi_events[e].data1, midi_events[e].data2);
+	}
+
+	return 0;
+}
+
+/**
+*   @brief  Stop the audio service and set the synthesizer audio for rendering.
+*   @param  size	audio block size: _AUDIO_BLOCK_SIZE_256, _AUDIO_BLOCK_SIZE_512, _AUDIO_BLOCK_SIZE_1024
+*   @return 0 if done; -1 param out of range or no audio memory
+*/
+int ModSynthOfflineRenderer::prepare_audio(int size)
+{
+	ModSynth *mod_synth = ModSynth::get_instance();
+	AdjSynth *adj_synth = mod_synth->get_adj_synth();
+
+	if (!is_valid_audio_block_size(size))
+	{
+		fprintf(stderr, "Offline render: invalid block size %i\n", size);
+		return -1;
+	}
+
+	if (!adj_synth->audio_manager->is_audio_memory_arena_allocated())
+	{
+		fprintf(stderr, "Offline render: audio memory not allocated\n");
+		return -1;
+	}
+
+	mod_synth->stop_audio();
+
+	sample_rate = adj_synth->set_sample_rate(mod_synth->get_sample_rate());
+	block_size = adj_synth->set_audio_block_size(size);
+	rendered_frames = 0;
+
+	return 0;
+}
+
+/**
+*   @brief  Apply an event to the synthesizer.
+*   @param  event	a pointer to the event
+*   @return void
+*/
+void ModSynthOfflineRenderer::dispatch_event(offline_render_event_t *event)
+{
+	switch (event->type)
+	{
+	case _OFFLINE_RENDER_EVENT_NOTE_ON:
+		ModSynth::get_instance()->note_on(event->channel, event->data1, event->data2);
+		notes_held[event->channel][event->data1] = true;
+		break;
+
+	case _OFFLINE_RENDER_EVENT_NOTE_OFF:
+		ModSynth::get_instance()->note_off(event->channel, event->data1);
+		notes_held[event->channel][event->data1] = false;
+		break;
+
+	case _OFFLINE_RENDER_EVENT_PROGRAM_CHANGE:
+		ModSynth::get_instance()->change_program(event->channel, event->data1);
+		// Render the new program with its PAD wavetable (generated in the background)
+		SynthPADgenerator::get_instance()->wait_for_idle(_OFFLINE_RENDER_PAD_WAIT_TIMEOUT_MS);
+		break;
+	}
+}
+
+/**
+*   @brief  Send note off to all the held notes.
+*   @param  none
+*   @return void
+*/
+void ModSynthOfflineRenderer::release_all_notes()
+{
+	for (int ch = 0; ch < 16; ch++)
+	{
+		for (int note = 0; note < 128; note++)
+		{
+			if (notes_held[ch][note])
+			{
+				ModSynth::get_instance()->note_off(ch, note);
+				notes_held[ch][note] = false;
+			}
+		}
+	}
+}
+
+/**
+*   @brief  Run audio update cycles back to back.
+*   @param  num_of_cycles	number of cycles
+*   @param  next_event		a pointer to the index of the next (sorted) event to dispatch;
+*							NULL: no events
+*   @param  wav				WAV file to append the rendered frames to; NULL: not written
+*   @return 0 if done; -1 output write error
+*/
+int ModSynthOfflineRenderer::run_cycles(int num_of_cycles, size_t *next_event, FILE *wav)
+{
+	AudioManager *audio_manager = ModSynth::get_instance()->get_adj_synth()->audio_manager;
+	shared_memory_audio_block_float_stereo_struct_t *out = audio_manager->audio_block_stereo_float_shared_memory_outputs;
+	uint64_t cycle_end;
+
+	for (int cycle = 0; cycle < num_of_cycles; cycle++)
+	{
+		cycle_end = rendered_frames + block_size;
+
+		// Events are applied at the period start (same resolution as MIDI input)
+		while (next_event && (*next_event < events.size()) &&
+			((uint64_t)(events[*next_event].time_sec * sample_rate) < cycle_end))
+		{
+			dispatch_event(&events[*next_event]);
+			(*next_event)++;
+		}
+
+		audio_manager->run_audio_update_cycle();
+
+		if (wav)
+		{
+			for (int i = 0; i < block_size; i++)
+			{
+				interleaved[2 * i] = out->data[_LEFT][i];
+				interleaved[2 * i + 1] = out->data[_RIGHT][i];
+			}
+
+			if (fwrite(interleaved, sizeof(float) * 2, block_size, wav) != (size_t)block_size)
+			{
+				fprintf(stderr, "Offline render: WAV write error\n");
+				return -1;
+			}
+		}
+
+		rendered_frames = cycle_end;
+	}
+
+	return 0;
+}
+
+/**
+*   @brief  Write a little endian number into a WAV header.
+*   @param  p				header position
+*   @param  value			number
+*   @param  num_of_bytes	number size in bytes (up to 4)
+*   @return void
+*/
+static void wav_put_le(uint8_t *p, uint32_t value, int num_of_bytes)
+{
+	for (int i = 0; i < num_of_bytes; i++)
+	{
+		p[i] = (uint8_t)(value >> (8 * i));
+	}
+}
+
+/**
+*   @brief  Write (or re-write) a 32 bits float stereo WAV file header at the file start.
+*   @param  wav				WAV file
+*   @param  sample_rate		sample rate
+*   @param  num_of_frames	number of stereo frames in the file
+*   @return 0 if done; -1 write error
+*/
+int ModSynthOfflineRenderer::write_wav_header(FILE *wav, int sample_rate, uint32_t num_of_frames)
+{
+	uint8_t header[44];
+	uint32_t data_size = num_of_frames * 2 * sizeof(float);
+
+	memcpy(header, "RIFF", 4);
+	wav_put_le(header + 4, 36 + data_size, 4);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	wav_put_le(header + 16, 16, 4);							// fmt chunk size
+	wav_put_le(header + 20, 3, 2);							// WAVE_FORMAT_IEEE_FLOAT
+	wav_put_le(header + 22, 2, 2);							// channels
+	wav_put_le(header + 24, sample_rate, 4);
+	wav_put_le(header + 28, sample_rate * 2 * sizeof(float), 4);	// byte rate
+	wav_put_le(header + 32, 2 * sizeof(float), 2);			// block align
+	wav_put_le(header + 34, 32, 2);							// bits per sample
+	memcpy(header + 36, "data", 4);
+	wav_put_le(header + 40, data_size, 4);
+
+	fseek(wav, 0, SEEK_SET);
+
+	return fwrite(header, sizeof(header), 1, wav) == 1 ? 0 : -1;
+}
+
+/**
+*   @brief  Fill the timing statistics of the last measured cycles.
+*   @param  stats			a pointer to the statistics
+*   @param  num_of_cycles	number of measured cycles
+*   @param  wall_time_ns	measured cycles wall time
+*   @return void
+*/
+void ModSynthOfflineRenderer::collect_stats(offline_render_stats_t *stats, int num_of_cycles, uint64_t wall_time_ns)
+{
+	AudioLatencyStats *latency = ModSynth::get_instance()->get_adj_synth()->audio_manager->get_latency_stats();
+
+	stats->num_of_cycles = num_of_cycles;
+	stats->block_size = block_size;
+	stats->sample_rate = sample_rate;
+	stats->rendered_time_sec = (double)num_of_cycles * block_size / sample_rate;
+	stats->wall_time_sec = (double)wall_time_ns / 1000000000.0;
+	stats->real_time_factor = stats->wall_time_sec > 0.0 ? stats->rendered_time_sec / stats->wall_time_sec : 0.0;
+	stats->cycle_p50_ns = latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_CYCLE, 50.0f);
+	stats->cycle_p99_ns = latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_CYCLE, 99.0f);
+	stats->cycle_max_ns = latency->get_max_ns(_AUDIO_LATENCY_STAGE_CYCLE);
+	stats->voice_p50_ns = latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_VOICE, 50.0f);
+	stats->voice_p99_ns = latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_VOICE, 99.0f);
+	stats->deadline_misses = (int)latency->get_deadline_misses_count();
+}
+
+/**
+*   @brief  Print timing statistics.
+*   @param  out		output file (e.g. stderr)
+*   @param  stats	a pointer to the statistics
+*   @return void
+*/
+void ModSynthOfflineRenderer::print_stats(FILE *out, offline_render_stats_t *stats)
+{
+	fprintf(out, "Offline render: %i cycles, block %i, %i Hz\n", stats->num_of_cycles, stats->block_size, stats->sample_rate);
+	fprintf(out, "  rendered %.3f sec in %.3f sec (x%.2f real-time)\n",
+		stats->rendered_time_sec, stats->wall_time_sec, stats->real_time_factor);
+	fprintf(out, "  cycle p50 %i ns, p99 %i ns, max %i ns, deadline misses %i\n",
+		stats->cycle_p50_ns, stats->cycle_p99_ns, stats->cycle_max_ns, stats->deadline_misses);
+	fprintf(out, "  voice p50 %i ns, p99 %i ns\n", stats->voice_p50_ns, stats->voice_p99_ns);
+}
+
+/**
+*   @brief  Render the loaded events into a WAV file (32 bits float stereo) as
+*			fast as possible.
+*   @param  wav_path	WAV file path; empty: rendered audio is not written
+*   @param  size		audio block size: _AUDIO_BLOCK_SIZE_256, _AUDIO_BLOCK_SIZE_512, _AUDIO_BLOCK_SIZE_1024
+*   @param  tail_sec	time rendered after the last event (seconds)
+*   @param  stats		a pointer to timing statistics to fill (may be NULL)
+*   @return 0 if done; -1 otherwise
+*/
+int ModSynthOfflineRenderer::render(const std::string &wav_path, int size, float tail_sec, offline_render_stats_t *stats)
+{
+	FILE *wav = NULL;
+	size_t next_event = 0;
+	double end_sec;
+	int num_of_cycles, res;
+	uint64_t start_ns;
+	offline_render_stats_t local_stats;
+
+	if (prepare_audio(size) != 0)
+	{
+		return -1;
+	}
+
+	std::stable_sort(events.begin(), events.end(),
+		[](const offline_render_event_t &a, const offline_render_event_t &b) { return a.time_sec < b.time_sec; });
+
+	end_sec = (events.empty() ? 0.0 : events.back().time_sec) + (tail_sec > 0.0f ? tail_sec : 0.0f);
+	num_of_cycles = (int)ceil(end_sec * sample_rate / block_size);
+	if (num_of_cycles < 1)
+	{
+		num_of_cycles = 1;
+	}
+
+	if (!wav_path.empty())
+	{
+		wav = fopen(wav_path.c_str(), "wb");
+		if ((wav == NULL) || (write_wav_header(wav, sample_rate, 0) != 0))
+		{
+			fprintf(stderr, "Offline render: unable to create %s\n", wav_path.c_str());
+			if (wav)
+			{
+				fclose(wav);
+			}
+
+			return -1;
+		}
+	}
+
+	ModSynth::get_instance()->get_adj_synth()->audio_manager->get_latency_stats()->reset();
+	SynthPADgenerator::get_instance()->wait_for_idle(_OFFLINE_RENDER_PAD_WAIT_TIMEOUT_MS);
+	// Same events and seed - same output
+	DSP_Prng::restart_all();
+
+	start_ns = audio_latency_now_ns();
+	res = run_cycles(num_of_cycles, &next_event, wav);
+	collect_stats(stats ? stats : &local_stats, num_of_cycles, audio_latency_now_ns() - start_ns);
+
+	release_all_notes();
+
+	if (wav)
+	{
+		res |= write_wav_header(wav, sample_rate, (uint32_t)rendered_frames);
+		fclose(wav);
+	}
+
+	return res;
+}
+
+/**
+*   @brief  Select a single sound source for the benchmark (all others disabled).
+*   @param  type	_OFFLINE_BENCH_SYNTH_VCO ... _OFFLINE_BENCH_SYNTH_PAD
+*   @return 0 if done; -1 param out of range
+*/
+int ModSynthOfflineRenderer::select_bench_synth_type(int type)
+{
+	if ((type < 0) || (type >= _OFFLINE_BENCH_NUM_OF_SYNTH_TYPES))
+	{
+		return -1;
+	}
+
+	mod_synth_disable_osc1();
+	mod_synth_disable_osc2();
+	mod_synth_disable_noise();
+	mod_synth_disable_karplus();
+	mod_synth_disable_morphsin();
+	mod_synth_disable_pad_synth();
+
+	switch (type)
+	{
+	case _OFFLINE_BENCH_SYNTH_VCO:
+		mod_synth_enable_osc1();
+		break;
+
+	case _OFFLINE_BENCH_SYNTH_NOISE:
+		mod_synth_enable_noise();
+		break;
+
+	case _OFFLINE_BENCH_SYNTH_KPS:
+		mod_synth_enable_karplus();
+		break;
+
+	case _OFFLINE_BENCH_SYNTH_MSO:
+		mod_synth_enable_morphsin();
+		break;
+
+	case _OFFLINE_BENCH_SYNTH_PAD:
+		mod_synth_enable_pad_synth();
+		break;
+	}
+
+	return 0;
+}
+
+/**
+*   @brief  Return a benchmark synth type name.
+*   @param  type	_OFFLINE_BENCH_SYNTH_VCO ... _OFFLINE_BENCH_SYNTH_PAD
+*   @return type name string
+*/
+const char *ModSynthOfflineRenderer::get_bench_synth_type_name(int type)
+{
+	switch (type)
+	{
+	case _OFFLINE_BENCH_SYNTH_VCO:
+		return "VCO";
+
+	case _OFFLINE_BENCH_SYNTH_NOISE:
+		return "NOISE";
+
+	case _OFFLINE_BENCH_SYNTH_KPS:
+		return "KPS";
+
+	case _OFFLINE_BENCH_SYNTH_MSO:
+		return "MSO";
+
+	case _OFFLINE_BENCH_SYNTH_PAD:
+		return "PAD";
+
+	default:
+		return "?";
+	}
+}
+
+/**
+*   @brief  Run the benchmark suite: num_of_voices held notes of each synth type
+*			(VCO, noise, KPS, MSO, PAD) at each block size. A CSV line is written
+*			per configuration with the cycle and voice times and the number of
+*			voices a single core can render in real-time:
+*			(period time - common blocks time) / voice time.
+*			The active patch sound sources are changed.
+*   @param  report			report output file (e.g. stdout)
+*   @param  num_of_voices	number of simultaneous notes (up to the polyphony)
+*   @param  num_of_cycles	number of measured cycles per configuration
+*   @return 0 if done; -1 otherwise
+*/
+int ModSynthOfflineRenderer::run_benchmark(FILE *report, int num_of_voices, int num_of_cycles)
+{
+	static const int block_sizes[] = { _AUDIO_BLOCK_SIZE_256, _AUDIO_BLOCK_SIZE_512, _AUDIO_BLOCK_SIZE_1024 };
+	AudioLatencyStats *latency = ModSynth::get_instance()->get_adj_synth()->audio_manager->get_latency_stats();
+	offline_render_stats_t stats;
+	offline_render_event_t event;
+	uint64_t start_ns;
+	double period_ns, common_ns, voices_per_core;
+	int res = 0;
+
+	if (num_of_voices > mod_synth_get_synthesizer_num_of_polyphonic_voices())
+	{
+		num_of_voices = mod_synth_get_synthesizer_num_of_polyphonic_voices();
+	}
+
+	if ((report == NULL) || (num_of_voices < 1) || (num_of_cycles < 1))
+	{
+		return -1;
+	}
+
+	fprintf(report, "synth,block_size,voices,cycle_p50_ns,cycle_p99_ns,cycle_max_ns,voice_p50_ns,voice_p99_ns,"
+		"common_p50_ns,deadline_misses,real_time_factor,voices_per_core\n");
+
+	for (int type = 0; type < _OFFLINE_BENCH_NUM_OF_SYNTH_TYPES; type++)
+	{
+		select_bench_synth_type(type);
+
+		for (int b = 0; b < (int)(sizeof(block_sizes) / sizeof(block_sizes[0])); b++)
+		{
+			if (prepare_audio(block_sizes[b]) != 0)
+			{
+				res = -1;
+				continue;
+			}
+
+			for (int v = 0; v < num_of_voices; v++)
+			{
+				event.time_sec = 0.0;
+				event.type = _OFFLINE_RENDER_EVENT_NOTE_ON;
+				event.channel = 0;
+				event.data1 = (uint8_t)(36 + v);
+				event.data2 = 100;
+				dispatch_event(&event);
+			}
+
+			run_cycles(_OFFLINE_BENCH_WARMUP_CYCLES, NULL, NULL);
+
+			latency->reset();
+			start_ns = audio_latency_now_ns();
+			run_cycles(num_of_cycles, NULL, NULL);
+			collect_stats(&stats, num_of_cycles, audio_latency_now_ns() - start_ns);
+
+			period_ns = (double)block_size * 1000000000.0 / sample_rate;
+			common_ns = (double)latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_START_TASKS, 50.0f) +
+				latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_MIXER, 50.0f) +
+				latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_REVERB, 50.0f) +
+				latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_EQUALIZER, 50.0f) +
+				latency->get_percentile_ns(_AUDIO_LATENCY_STAGE_OUTPUT, 50.0f);
+			voices_per_core = stats.voice_p50_ns > 0 ? (period_ns - common_ns) / stats.voice_p50_ns : 0.0;
+
+			fprintf(report, "%s,%i,%i,%i,%i,%i,%i,%i,%i,%i,%.2f,%.1f\n",
+				get_bench_synth_type_name(type), block_size, num_of_voices,
+				stats.cycle_p50_ns, stats.cycle_p99_ns, stats.cycle_max_ns,
+				stats.voice_p50_ns, stats.voice_p99_ns, (int)common_ns,
+				stats.deadline_misses, stats.real_time_factor, voices_per_core);
+			fflush(report);
+
+			// Release the voices before the next configuration
+			release_all_notes();
+			run_cycles((int)(_OFFLINE_RENDER_DEFAULT_TAIL_SEC * sample_rate / block_size), NULL, NULL);
+		}
+	}
+
+	return res;
+}
@@ -0,0 +1,113 @@
+/**
+*	@file		modSynthOfflineRender.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Headless offline render engine and benchmark harness.
+*				Runs the audio update cycle (voices, mixer, reverb, equalizer,
+*				output) as fast as possible, without JACK or ALSA, driven by a
+*				MIDI file or a scripted notes list, and writes a WAV file and
+*				timing statistics.
+*/
+
+#ifndef _MOD_SYNTH_OFFLINE_RENDER
+#define _MOD_SYNTH_OFFLINE_RENDER
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+
+#define _OFFLINE_RENDER_EVENT_NOTE_OFF			0
+#define _OFFLINE_RENDER_EVENT_NOTE_ON			1
+#define _OFFLINE_RENDER_EVENT_PROGRAM_CHANGE	2
+
+// Silence rendered after the last event (release tails)
+#define _OFFLINE_RENDER_DEFAULT_TAIL_SEC		2.0f
+
+// Benchmark synth types
+#define _OFFLINE_BENCH_SYNTH_VCO				0
+#define _OFFLINE_BENCH_SYNTH_NOISE				1
+#define _OFFLINE_BENCH_SYNTH_KPS				2
+#define _OFFLINE_BENCH_SYNTH_MSO				3
+#define _OFFLINE_BENCH_SYNTH_PAD				4
+#define _OFFLINE_BENCH_NUM_OF_SYNTH_TYPES		5
+
+// Maximum waiting time for background PAD wavetables generation
+#define _OFFLINE_RENDER_PAD_WAIT_TIMEOUT_MS		10000
+
+// Cycles rendered before measuring (envelopes attack, caches)
+#define _OFFLINE_BENCH_WARMUP_CYCLES			20
+
+typedef struct offline_render_event
+{
+	// Event time from the render start
+	double time_sec;
+	uint8_t type;
+	uint8_t channel;
+	uint8_t data1;
+	uint8_t data2;
+} offline_render_event_t;
+
+typedef struct offline_render_stats
+{
+	int num_of_cycles;
+	int block_size;
+	int sample_rate;
+	double rendered_time_sec;
+	double wall_time_sec;
+	// rendered time / wall time (> 1.0 is faster than real-time)
+	double real_time_factor;
+	int cycle_p50_ns;
+	int cycle_p99_ns;
+	int cycle_max_ns;
+	int voice_p50_ns;
+	int voice_p99_ns;
+	int deadline_misses;
+} offline_render_stats_t;
+
+class ModSynthOfflineRenderer
+{
+public:
+	ModSynthOfflineRenderer();
+	~ModSynthOfflineRenderer();
+
+	void clear_events();
+	void add_event(float time_sec, int type, int channel, int data1, int data2);
+	void add_note(float start_sec, float duration_sec, int channel, int note, int velocity);
+
+	int load_events_file(const std::string &path);
+	int load_midi_file(const std::string &path);
+	int load_notes_list_file(const std::string &path);
+
+	int render(const std::string &wav_path, int block_size, float tail_sec, offline_render_stats_t *stats);
+
+	int run_benchmark(FILE *report, int num_of_voices, int num_of_cycles);
+
+	static void print_stats(FILE *out, offline_render_stats_t *stats);
+
+private:
+	int prepare_audio(int block_size);
+	int run_cycles(int num_of_cycles, size_t *next_event, FILE *wav);
+	void release_all_notes();
+	void dispatch_event(offline_render_event_t *event);
+	void collect_stats(offline_render_stats_t *stats, int num_of_cycles, uint64_t wall_time_ns);
+
+	static int select_bench_synth_type(int type);
+	static const char *get_bench_synth_type_name(int type);
+
+	static int write_wav_header(FILE *wav, int sample_rate, uint32_t num_of_frames);
+
+	std::vector<offline_render_event_t> events;
+
+	int sample_rate;
+	int block_size;
+	uint64_t rendered_frames;
+	// Notes currently played (released at the end of a benchmark run)
+	bool notes_held[16][128];
+	// Interleaved stereo conversion buffer of one block
+	float *interleaved;
+};
+
+#endif
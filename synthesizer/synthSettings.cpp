@@ -1,8 +1,15 @@
 /**
 * @file		synthSettings.cpp
 *	@author		Nahum Budin
-*	@date		5-Feb-2021
-*	@version	1.1 
+*	@date		17-Oct-2026
+*	@version	1.3
+*					1. Reference counted (immutable) settings snapshots.
+*					2. Working settings deep copy.
+*
+*	@version	1.2		17-Oct-2026
+*					1. Parameters access by identifiers (dense parameters index).
+*
+*	@version	1.1		5-Feb-2021
 *					1. Code refactoring and notaion.
 *					
 *	@version	1.0		5-Oct-2019
@@ -20,16 +27,36 @@
 
 #include "adjSynth.h"
 #include "synthSettings.h"
+#include "../audio/audioParamsQueue.h"
 
 #include "../libAdjHeartModSynth_2.h"
 
 // Instances of static elements
 //ModSynthSettings *ModSynthSettings::mod_synth_settings_instance = NULL;
 std::mutex ModSynthSettings::settings_manage_mutex;
+thread_local int ModSynthSettings::params_batch_depth = 0;
+thread_local uint32_t ModSynthSettings::params_batch_dirty_programs = 0;
+settings_batch_commit_callback_t ModSynthSettings::params_batch_commit_callback_ptr = NULL;
+settings_batch_commit_callback_t ModSynthSettings::params_changed_callback_ptr = NULL;
+settings_snapshot_t *ModSynthSettings::retired_snapshots = NULL;
 //int ModSynthSettings::activeSketch;
 
 uint32_t ModSynthSettings::settings_version = 210122;	// 2021-01-22
 
+const char *settings_param_names[_NUM_OF_SETTINGS_PARAM_IDS] =
+{
+#define _PARAM_NAME(id, name, value_type) name,
+	_SETTINGS_PARAMS_LIST(_PARAM_NAME)
+#undef _PARAM_NAME
+};
+
+const int settings_param_value_types[_NUM_OF_SETTINGS_PARAM_IDS] =
+{
+#define _PARAM_VALUE_TYPE(id, name, value_type) value_type,
+	_SETTINGS_PARAMS_LIST(_PARAM_VALUE_TYPE)
+#undef _PARAM_VALUE_TYPE
+};
+
 /**
  * @brief Creates a settings class object instance
  *
@@ -55,7 +82,7 @@ ModSynthSettings::~ModSynthSettings()
 	active_settings_params->int_parameters_map.clear();
 	active_settings_params->float_parameters_map.clear();
 	active_settings_params->bool_parameters_map.clear();
-		
+	__atomic_store_n(&active_settings_params->params_index.valid, false, __ATOMIC_RELEASE);
 }
 
 /**
@@ -78,8 +105,156 @@ _setting_params_t *ModSynthSettings::get_active_settings_parameters()
 */
 void ModSynthSettings::settings_params_deep_copy(_setting_params_t *destinationParams, _setting_params_t *sourceParams)
 {
-	destinationParams = (_setting_params_t*)malloc(sizeof(*sourceParams)) ;
-	memcpy(destinationParams, sourceParams, sizeof(*sourceParams));
+	if ((destinationParams == NULL) || (sourceParams == NULL) || (destinationParams == sourceParams))
+	{
+		return;
+	}
+
+	uint32_t changes_count;
+
+	settings_manage_mutex.lock();
+	// Maps are copied by value; the copied parameters index is invalidated (rebuilt on use)
+	changes_count = destinationParams->changes_count;
+	*destinationParams = *sourceParams;
+	// The destination was changed (not a copy of the source changes)
+	destinationParams->changes_count = changes_count + 1;
+	settings_manage_mutex.unlock();
+}
+
+/**
+*	@brief	Create a settings snapshot: an immutable copy of a settings parameters structure,
+*			held by the caller (reference count 1). Called by the editing threads only
+*			(it also deletes the retired snapshots).
+*	@param	params	source settings parameters
+*	@return a pointer to the new snapshot; NULL if params is NULL
+*/
+settings_snapshot_t *ModSynthSettings::create_snapshot(_setting_params_t *params)
+{
+	settings_snapshot_t *snapshot;
+
+	return_val_if_true(params == NULL, NULL);
+
+	collect_retired_snapshots();
+
+	snapshot = new settings_snapshot_t();
+	snapshot->next_retired = NULL;
+
+	settings_manage_mutex.lock();
+	snapshot->params = *params;
+	snapshot->source_changes_count = params->changes_count;
+	settings_manage_mutex.unlock();
+
+	snapshot->ref_count = 1;
+	// Index is built once, so concurrent readers never modify the snapshot
+	build_params_index(&snapshot->params);
+
+	return snapshot;
+}
+
+/**
+*	@brief	Take a reference to a settings snapshot (duplicate it without copying).
+*	@param	snapshot	a pointer to a snapshot
+*	@return the snapshot pointer
+*/
+settings_snapshot_t *ModSynthSettings::retain_snapshot(settings_snapshot_t *snapshot)
+{
+	if (snapshot != NULL)
+	{
+		__atomic_add_fetch(&snapshot->ref_count, 1, __ATOMIC_RELAXED);
+	}
+
+	return snapshot;
+}
+
+/**
+*	@brief	Release a reference to a settings snapshot; when its last reference is
+*			released, the snapshot is retired (no memory is freed here, so real-time
+*			threads may release snapshots).
+*	@param	snapshot	a pointer to a snapshot
+*	@return void
+*/
+void ModSynthSettings::release_snapshot(settings_snapshot_t *snapshot)
+{
+	settings_snapshot_t *head;
+
+	if ((snapshot != NULL) && (__atomic_sub_fetch(&snapshot->ref_count, 1, __ATOMIC_ACQ_REL) == 0))
+	{
+		head = __atomic_load_n(&retired_snapshots, __ATOMIC_RELAXED);
+		do
+		{
+			snapshot->next_retired = head;
+		} while (!__atomic_compare_exchange_n(&retired_snapshots, &head, snapshot,
+					false, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+	}
+}
+
+/**
+*	@brief	Delete the retired snapshots. Called by the editing threads.
+*	@param	none
+*	@return void
+*/
+void ModSynthSettings::collect_retired_snapshots()
+{
+	settings_snapshot_t *snapshot, *next;
+
+	snapshot = __atomic_exchange_n(&retired_snapshots, (settings_snapshot_t*)NULL, __ATOMIC_ACQUIRE);
+	while (snapshot != NULL)
+	{
+		next = snapshot->next_retired;
+		delete snapshot;
+		snapshot = next;
+	}
+}
+
+/**
+*	@brief	Execute the setup (not block) callbacks of all the parameters, with their
+*			current values; e.g. after the parameters were copied as a whole.
+*	@param	params	settings parameters
+*	@param	prog	program number
+*	@return void
+*/
+void ModSynthSettings::exec_setup_callbacks(_setting_params_t *params, int prog)
+{
+	if (params == NULL)
+	{
+		return;
+	}
+
+	settings_manage_mutex.lock();
+
+	for (auto &param : params->string_parameters_map)
+	{
+		if (param.second.setup_callback != NULL)
+		{
+			param.second.setup_callback(param.second.value, prog);
+		}
+	}
+
+	for (auto &param : params->int_parameters_map)
+	{
+		if (param.second.setup_callback != NULL)
+		{
+			param.second.setup_callback(param.second.value, prog);
+		}
+	}
+
+	for (auto &param : params->float_parameters_map)
+	{
+		if (param.second.setup_callback != NULL)
+		{
+			param.second.setup_callback(param.second.value, prog);
+		}
+	}
+
+	for (auto &param : params->bool_parameters_map)
+	{
+		if (param.second.setup_callback != NULL)
+		{
+			param.second.setup_callback(param.second.value, prog);
+		}
+	}
+
+	settings_manage_mutex.unlock();
 }
 
 /**
@@ -311,6 +486,435 @@ settings_res_t ModSynthSettings::get_bool_param(_setting_params_t *settings, str
 	return res;
 }
 
+/**
+ * @brief Return the settings structure to operate on.
+ *
+ * @param settings a settings parameters structure (NULL: the active settings)
+ * @return the settings parameters structure
+ */
+_setting_params_t *ModSynthSettings::select_settings(_setting_params_t *settings)
+{
+	if (settings == NULL)
+	{
+		return active_settings_params;
+	}
+	else
+	{
+		return settings;
+	}
+}
+
+/**
+ * @brief Build the parameters index of a settings structure. The index is built into a 
+ *		  local array and then published, so concurrent readers of a published index 
+ *		  never see a NULL pointer of a defined parameter.
+ *
+ * @param settings a settings parameters structure (mandatory parameter)
+ * @return void
+ */
+void ModSynthSettings::build_params_index(_setting_params_t *settings)
+{
+	std::map<std::string, mod_synth_settings_str_param_t>::iterator str_iter;
+	std::map<std::string, mod_synth_settings_int_param_t>::iterator int_iter;
+	std::map<std::string, mod_synth_settings_float_param_t>::iterator float_iter;
+	std::map<std::string, mod_synth_settings_bool_param_t>::iterator bool_iter;
+	void *params[_NUM_OF_SETTINGS_PARAM_IDS];
+	int id;
+
+	for (id = 0; id < _NUM_OF_SETTINGS_PARAM_IDS; id++)
+	{
+		params[id] = NULL;
+
+		switch (settings_param_value_types[id])
+		{
+			case _PARAM_VALUE_TYPE_STRING:
+				str_iter = settings->string_parameters_map.find(settings_param_names[id]);
+				if (str_iter != settings->string_parameters_map.end())
+				{
+					params[id] = &str_iter->second;
+				}
+				break;
+
+			case _PARAM_VALUE_TYPE_INT:
+				int_iter = settings->int_parameters_map.find(settings_param_names[id]);
+				if (int_iter != settings->int_parameters_map.end())
+				{
+					params[id] = &int_iter->second;
+				}
+				break;
+
+			case _PARAM_VALUE_TYPE_FLOAT:
+				float_iter = settings->float_parameters_map.find(settings_param_names[id]);
+				if (float_iter != settings->float_parameters_map.end())
+				{
+					params[id] = &float_iter->second;
+				}
+				break;
+
+			case _PARAM_VALUE_TYPE_BOOL:
+				bool_iter = settings->bool_parameters_map.find(settings_param_names[id]);
+				if (bool_iter != settings->bool_parameters_map.end())
+				{
+					params[id] = &bool_iter->second;
+				}
+				break;
+		}
+	}
+
+	// Publish - an entry is only replaced by the same or a new parameter pointer
+	for (id = 0; id < _NUM_OF_SETTINGS_PARAM_IDS; id++)
+	{
+		__atomic_store_n(&settings->params_index.params[id], params[id], __ATOMIC_RELAXED);
+	}
+
+	__atomic_store_n(&settings->params_index.valid, true, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Return a pointer to an indexed parameter structure.
+ *
+ * @param settings a settings parameters structure (mandatory parameter)
+ * @param id the parameter identifier
+ * @param value_type the expected parameter value type (#_PARAM_VALUE_TYPE_INT ...)
+ * @return a pointer to the mod_synth_settings_xxx_param_t structure; NULL if not defined
+ */
+void *ModSynthSettings::get_indexed_param(_setting_params_t *settings, settings_param_id_t id, int value_type)
+{
+	return_val_if_true((id < 0) || (id >= _NUM_OF_SETTINGS_PARAM_IDS), NULL);
+	return_val_if_true(settings_param_value_types[id] != value_type, NULL);
+
+	if (!__atomic_load_n(&settings->params_index.valid, __ATOMIC_ACQUIRE))
+	{
+		build_params_index(settings);
+	}
+
+	return __atomic_load_n(&settings->params_index.params[id], __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief	Begin a parameters batch of the calling thread. Until the batch is committed,
+ *			AdjSynth patch parameters block callbacks are not executed; the programs which
+ *			voices parameters were modified are marked, and their voices are updated once
+ *			when the batch is committed (e.g., a patch load sets hundreds of parameters;
+ *			each block callback would recompute its voices derived state again).
+ *			Batches may be nested; only the outer commit updates the voices. Parameters
+ *			set meanwhile by other threads are not part of the batch.
+ *
+ * @return void
+ */
+void ModSynthSettings::begin_params_batch()
+{
+	params_batch_depth++;
+}
+
+/**
+ * @brief	Commit a parameters batch of the calling thread: call the batch commit callback
+ *			once for each program which voices parameters were modified during the batch.
+ *
+ * @return void
+ */
+void ModSynthSettings::commit_params_batch()
+{
+	commit_params_batch_programs(detach_params_batch());
+}
+
+/**
+ * @brief	Close a parameters batch of the calling thread without committing it: the
+ *			programs which voices parameters were modified are returned, to be committed
+ *			later, possibly by another thread (see commit_params_batch_programs()).
+ *
+ * @return the modified programs (bit mask); 0 if the batch is nested in an outer batch
+ */
+uint32_t ModSynthSettings::detach_params_batch()
+{
+	uint32_t dirty_programs = 0;
+
+	if (params_batch_depth > 0)
+	{
+		params_batch_depth--;
+		if (params_batch_depth == 0)
+		{
+			dirty_programs = params_batch_dirty_programs;
+			params_batch_dirty_programs = 0;
+		}
+	}
+
+	return dirty_programs;
+}
+
+/**
+ * @brief	Call the batch commit callback once for each of the given programs.
+ *
+ * @param dirty_programs	programs (bit mask) returned by detach_params_batch()
+ * @return void
+ */
+void ModSynthSettings::commit_params_batch_programs(uint32_t dirty_programs)
+{
+	for (int prog = 0; (prog < 32) && (dirty_programs != 0); prog++)
+	{
+		if (dirty_programs & (1U << prog))
+		{
+			dirty_programs &= ~(1U << prog);
+			if (params_batch_commit_callback_ptr != NULL)
+			{
+				params_batch_commit_callback_ptr(prog);
+			}
+		}
+	}
+}
+
+/**
+ * @brief	Register a callback that updates a program voices when a parameters batch
+ *			that modified them is committed.
+ *
+ * @param ptr	a pointer to the callback function (void)(int prog)
+ * @return void
+ */
+void ModSynthSettings::register_params_batch_commit_callback(settings_batch_commit_callback_t ptr)
+{
+	params_batch_commit_callback_ptr = ptr;
+}
+
+/**
+ * @brief	Register a callback that is called (on the editing thread) after a parameter
+ *			block update of a program was posted outside of a parameters batch.
+ *
+ * @param ptr	a pointer to the callback function (void)(int prog)
+ * @return void
+ */
+void ModSynthSettings::register_params_changed_callback(settings_batch_commit_callback_t ptr)
+{
+	params_changed_callback_ptr = ptr;
+}
+
+/**
+ * @brief	If the calling thread has a parameters batch open, mark the program as modified
+ *			instead of executing an AdjSynth patch parameter block callback (the program
+ *			voices are rebuilt from the patch when the batch is committed). Other parameters
+ *			types block callbacks (e.g. the preset mixer callbacks) are never deferred.
+ *
+ * @param type	parameter type
+ * @param prog	program number
+ * @return true if the block callback is deferred to the batch commit
+ */
+bool ModSynthSettings::defer_block_callback(int type, int prog)
+{
+	if ((params_batch_depth == 0) || (type != _PARAM_TYPE_ADJ_SYNTH_PATCH) || 
+		(prog < 0) || (prog >= 32))
+	{
+		return false;
+	}
+
+	params_batch_dirty_programs |= (1U << prog);
+
+	return true;
+}
+
+/* Audio parameters updates: execute a block callback over its voices range */
+static void apply_int_block_param_update(const audio_param_update_t *update)
+{
+	int_block_param_update_callback_t callback = (int_block_param_update_callback_t)update->target;
+
+	for (int i = update->index_start; i <= update->index_stop; i++)
+	{
+		callback(update->value.int_value, i, update->prog);
+	}
+}
+
+static void apply_float_block_param_update(const audio_param_update_t *update)
+{
+	float_block_param_update_callback_t callback = (float_block_param_update_callback_t)update->target;
+
+	for (int i = update->index_start; i <= update->index_stop; i++)
+	{
+		callback(update->value.float_value, i, update->prog);
+	}
+}
+
+static void apply_bool_block_param_update(const audio_param_update_t *update)
+{
+	bool_block_param_update_callback_t callback = (bool_block_param_update_callback_t)update->target;
+
+	for (int i = update->index_start; i <= update->index_stop; i++)
+	{
+		callback(update->value.bool_value, i, update->prog);
+	}
+}
+
+/**
+ * @brief	Post a prepared block update: while the audio update cycles are running,
+ *			the update is posted to the audio parameters updates queue and executed by
+ *			the audio update thread before the next voices update (the voices DSP objects
+ *			are not modified while a block is processed); while the queue is full the
+ *			caller waits. Otherwise (no update cycles are running) it is executed now.
+ *			Must be called after settings_manage_mutex is released, so a waiting caller
+ *			does not stall other settings readers and writers.
+ *			Then the parameters changed callback is called (the edited program patch
+ *			snapshot is published).
+ *
+ * @param update	an update prepared by prepare_int/float/bool_block_update()
+ * @return void
+ */
+void ModSynthSettings::post_block_update(audio_param_update_t *update)
+{
+	if (!AudioParamsQueue::get_instance()->post_wait(update))
+	{
+		update->apply(update);
+	}
+
+	if (params_changed_callback_ptr != NULL)
+	{
+		params_changed_callback_ptr(update->prog);
+	}
+}
+
+/**
+ * @brief	Prepare an integer block update that executes the block callback for
+ *			each index in start..stop (see post_block_update()).
+ *			Called while settings_manage_mutex is held.
+ *
+ * @param callback	the block callback
+ * @param value		the param value
+ * @param start		block start index
+ * @param stop		block stop index
+ * @param type		parameter type
+ * @param prog		program number
+ * @param update	the returned prepared update
+ * @return true if an update should be posted, false if there is nothing to post
+ *			(empty block or deferred to the params batch commit)
+ */
+bool ModSynthSettings::prepare_int_block_update(int_block_param_update_callback_t callback, int value, int start, int stop, int type, int prog,
+	audio_param_update_t *update)
+{
+	if ((start < 0) || (stop < start) || defer_block_callback(type, prog))
+	{
+		return false;
+	}
+
+	update->apply = apply_int_block_param_update;
+	update->target = (audio_param_update_target_t)callback;
+	update->index_start = start;
+	update->index_stop = stop;
+	update->prog = prog;
+	update->value.int_value = value;
+
+	return true;
+}
+
+/**
+ * @brief	Prepare a float block update (see prepare_int_block_update()).
+ *
+ * @param callback	the block callback
+ * @param value		the param value
+ * @param start		block start index
+ * @param stop		block stop index
+ * @param type		parameter type
+ * @param prog		program number
+ * @param update	the returned prepared update
+ * @return true if an update should be posted
+ */
+bool ModSynthSettings::prepare_float_block_update(float_block_param_update_callback_t callback, double value, int start, int stop, int type, int prog,
+	audio_param_update_t *update)
+{
+	if ((start < 0) || (stop < start) || defer_block_callback(type, prog))
+	{
+		return false;
+	}
+
+	update->apply = apply_float_block_param_update;
+	update->target = (audio_param_update_target_t)callback;
+	update->index_start = start;
+	update->index_stop = stop;
+	update->prog = prog;
+	update->value.float_value = value;
+
+	return true;
+}
+
+/**
+ * @brief	Prepare a boolean block update (see prepare_int_block_update()).
+ *
+ * @param callback	the block callback
+ * @param value		the param value
+ * @param start		block start index
+ * @param stop		block stop index
+ * @param type		parameter type
+ * @param prog		program number
+ * @param update	the returned prepared update
+ * @return true if an update should be posted
+ */
+bool ModSynthSettings::prepare_bool_block_update(bool_block_param_update_callback_t callback, bool value, int start, int stop, int type, int prog,
+	audio_param_update_t *update)
+{
+	if ((start < 0) || (stop < start) || defer_block_callback(type, prog))
+	{
+		return false;
+	}
+
+	update->apply = apply_bool_block_param_update;
+	update->target = (audio_param_update_target_t)callback;
+	update->index_start = start;
+	update->index_stop = stop;
+	update->prog = prog;
+	update->value.bool_value = value;
+
+	return true;
+}
+
+/**
+ * @brief Get the specified integer setting param value by its identifier.
+ *
+ * @param settings all settings structure (NULL: active settings)
+ * @param id the setting's identifier
+ * @param value pointer to the returned value (mandatory parameter)
+ * @return #_SETTINGS_KEY_FOUND if the parameter has been found
+ */
+settings_res_t ModSynthSettings::get_int_param_value(_setting_params_t *settings, settings_param_id_t id,
+													   int *value)
+{
+	mod_synth_settings_int_param_t *param;
+
+	return_val_if_true(settings == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
+	return_val_if_true(value == NULL, _SETTINGS_BAD_PARAMETERS);
+
+	param = (mod_synth_settings_int_param_t*)get_indexed_param(select_settings(settings), id, _PARAM_VALUE_TYPE_INT);
+	if (param == NULL)
+	{
+		return _SETTINGS_KEY_NOT_FOUND;
+	}
+
+	*value = param->value;
+
+	return _SETTINGS_KEY_FOUND;
+}
+
+/**
+ * @brief Get the specified boolean setting param value by its identifier.
+ *
+ * @param settings all settings structure (NULL: active settings)
+ * @param id the setting's identifier
+ * @param value pointer to the returned value (mandatory parameter)
+ * @return #_SETTINGS_KEY_FOUND if the parameter has been found
+ */
+settings_res_t ModSynthSettings::get_bool_param_value(_setting_params_t *settings, settings_param_id_t id,
+														bool *value)
+{
+	mod_synth_settings_bool_param_t *param;
+
+	return_val_if_true(settings == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
+	return_val_if_true(value == NULL, _SETTINGS_BAD_PARAMETERS);
+
+	param = (mod_synth_settings_bool_param_t*)get_indexed_param(select_settings(settings), id, _PARAM_VALUE_TYPE_BOOL);
+	if (param == NULL)
+	{
+		return _SETTINGS_KEY_NOT_FOUND;
+	}
+
+	*value = param->value;
+
+	return _SETTINGS_KEY_FOUND;
+}
+
 /**
  * @brief	Set the specified string setting param.
  *			If no param with specified name is found a new param is created.
@@ -430,6 +1034,8 @@ settings_res_t ModSynthSettings::set_string_param(_setting_params_t *settings,
 		}
 
 		_settings->string_parameters_map[name] = param;
+		// A new map entry - index is rebuilt on next use
+		__atomic_store_n(&_settings->params_index.valid, false, __ATOMIC_RELEASE);
 	}
 	else if (res == _SETTINGS_KEY_FOUND)
 	{
@@ -507,7 +1113,8 @@ settings_res_t ModSynthSettings::set_string_param(_setting_params_t *settings,
 	}
 	
 	if ((_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK)) && 
-		(_settings->string_parameters_map[name].block_setup_callback != NULL))
+		(_settings->string_parameters_map[name].block_setup_callback != NULL) &&
+		!defer_block_callback(_settings->string_parameters_map[name].type, prog))
 	{
 		// Call block update callback
 		if(_settings->string_parameters_map[name].block_start_index >= 0 &&
@@ -522,6 +1129,8 @@ settings_res_t ModSynthSettings::set_string_param(_setting_params_t *settings,
 		}
 	}
 
+	_settings->changes_count++;
+
 	settings_manage_mutex.unlock();
 
 	return _SETTINGS_OK;
@@ -561,6 +1170,8 @@ settings_res_t ModSynthSettings::set_int_param(_setting_params_t *settings,
 												uint16_t set_mask,
 												int prog)
 {
+	audio_param_update_t block_update;
+	bool block_update_ready = false;
 	settings_res_t res = _SETTINGS_FAILED;
 	mod_synth_settings_int_param_t param;
 	mod_synth_settings_int_param_t new_param;
@@ -672,6 +1283,8 @@ settings_res_t ModSynthSettings::set_int_param(_setting_params_t *settings,
 		}
 
 		_settings->int_parameters_map[name] = param;
+		// A new map entry - index is rebuilt on next use
+		__atomic_store_n(&_settings->params_index.valid, false, __ATOMIC_RELEASE);
 	}
 	else if (res == _SETTINGS_KEY_FOUND)
 	{
@@ -788,21 +1401,25 @@ settings_res_t ModSynthSettings::set_int_param(_setting_params_t *settings,
 	if ((_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK)) && 
 		(_settings->int_parameters_map[name].block_setup_callback != NULL))
 	{
-		// Call block update callback
-		if((_settings->int_parameters_map[name].block_start_index >= 0) &&
-		    (_settings->int_parameters_map[name].block_stop_index >= 
-			 _settings->int_parameters_map[name].block_start_index))
-		{
-			for (int i = _settings->int_parameters_map[name].block_start_index;
-				 i <= _settings->int_parameters_map[name].block_stop_index; i++)
-			{
-				_settings->int_parameters_map[name].block_setup_callback(value, i, prog);
-			}
-		}
+		// Prepare the block update (posted to the audio update thread after unlocking)
+		block_update_ready = prepare_int_block_update(_settings->int_parameters_map[name].block_setup_callback,
+			value,
+			_settings->int_parameters_map[name].block_start_index,
+			_settings->int_parameters_map[name].block_stop_index,
+			_settings->int_parameters_map[name].type,
+			prog, &block_update);
 	}
 
+	_settings->changes_count++;
+
 	settings_manage_mutex.unlock();
 
+	if (block_update_ready)
+	{
+		// Post after unlocking: post_wait() may block while the queue is full
+		post_block_update(&block_update);
+	}
+
 	return _SETTINGS_OK;
 }
 
@@ -840,6 +1457,8 @@ settings_res_t ModSynthSettings::set_float_param(_setting_params_t *settings,
 													uint16_t set_mask,
 													int prog)
 {
+	audio_param_update_t block_update;
+	bool block_update_ready = false;
 	settings_res_t res = _SETTINGS_FAILED;
 	mod_synth_settings_float_param_t param;
 	mod_synth_settings_float_param_t new_param;
@@ -951,6 +1570,8 @@ settings_res_t ModSynthSettings::set_float_param(_setting_params_t *settings,
 		}
 
 		_settings->float_parameters_map[name] = param;
+		// A new map entry - index is rebuilt on next use
+		__atomic_store_n(&_settings->params_index.valid, false, __ATOMIC_RELEASE);
 	}
 	else if (res == _SETTINGS_KEY_FOUND)
 	{
@@ -1067,21 +1688,25 @@ settings_res_t ModSynthSettings::set_float_param(_setting_params_t *settings,
 	if ((_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK)) && 
 		(_settings->float_parameters_map[name].block_setup_callback != NULL))
 	{
-		// Call block update callback
-		if ((_settings->float_parameters_map[name].block_start_index >= 0) &&
-			(_settings->float_parameters_map[name].block_stop_index >= 
-			 _settings->float_parameters_map[name].block_start_index))
-		{
-			for (int i = _settings->float_parameters_map[name].block_start_index;
-				 i <= _settings->float_parameters_map[name].block_stop_index; i++)
-			{
-				_settings->float_parameters_map[name].block_setup_callback(value, i, prog);
-			}
-		}
+		// Prepare the block update (posted to the audio update thread after unlocking)
+		block_update_ready = prepare_float_block_update(_settings->float_parameters_map[name].block_setup_callback,
+			value,
+			_settings->float_parameters_map[name].block_start_index,
+			_settings->float_parameters_map[name].block_stop_index,
+			_settings->float_parameters_map[name].type,
+			prog, &block_update);
 	}
 
+	_settings->changes_count++;
+
 	settings_manage_mutex.unlock();
 
+	if (block_update_ready)
+	{
+		// Post after unlocking: post_wait() may block while the queue is full
+		post_block_update(&block_update);
+	}
+
 	return _SETTINGS_OK;
 }
 
@@ -1116,6 +1741,8 @@ settings_res_t ModSynthSettings::set_bool_param(_setting_params_t *settings,
 												uint16_t set_mask,
 												int prog)
 {
+	audio_param_update_t block_update;
+	bool block_update_ready = false;
 	settings_res_t res = _SETTINGS_FAILED;
 	mod_synth_settings_bool_param_t param;
 	mod_synth_settings_bool_param_t new_param;
@@ -1203,6 +1830,8 @@ settings_res_t ModSynthSettings::set_bool_param(_setting_params_t *settings,
 		}
 
 		_settings->bool_parameters_map[name] = param;
+		// A new map entry - index is rebuilt on next use
+		__atomic_store_n(&_settings->params_index.valid, false, __ATOMIC_RELEASE);
 	}
 	else if (res == _SETTINGS_KEY_FOUND)
 	{
@@ -1281,21 +1910,25 @@ settings_res_t ModSynthSettings::set_bool_param(_setting_params_t *settings,
 	if ((_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK)) && 
 		(_settings->bool_parameters_map[name].block_setup_callback != NULL))
 	{
-		// Call block update callback
-		if((_settings->bool_parameters_map[name].block_start_index >= 0) &&
-			(_settings->bool_parameters_map[name].block_stop_index >= 
-			_settings->bool_parameters_map[name].block_start_index))
-		{
-			for (int i = _settings->bool_parameters_map[name].block_start_index;
-				 i <= _settings->bool_parameters_map[name].block_stop_index; i++)
-			{
-				_settings->bool_parameters_map[name].block_setup_callback(value, i, prog);
-			}
-		}
+		// Prepare the block update (posted to the audio update thread after unlocking)
+		block_update_ready = prepare_bool_block_update(_settings->bool_parameters_map[name].block_setup_callback,
+			value,
+			_settings->bool_parameters_map[name].block_start_index,
+			_settings->bool_parameters_map[name].block_stop_index,
+			_settings->bool_parameters_map[name].type,
+			prog, &block_update);
 	}
 
+	_settings->changes_count++;
+
 	settings_manage_mutex.unlock();
 
+	if (block_update_ready)
+	{
+		// Post after unlocking: post_wait() may block while the queue is full
+		post_block_update(&block_update);
+	}
+
 	return _SETTINGS_OK;
 }
 
@@ -1392,6 +2025,268 @@ settings_res_t ModSynthSettings::set_bool_param_value(_setting_params_t *setting
 }
 
 
+/**
+ * @brief	Set the specified integer setting param value by its identifier.
+ *			if one of the set flags #_EXEC_CALLBACK or #_EXEC_BLOCK_CALLBACK is used,
+ *			the set value call back is also executed.
+ *			If the parameter is not defined operation fails.
+ *
+ * @param settings a settings parameters structure (NULL: active settings)
+ * @param id the setting's identifier
+ * @param value the param new value
+ * @param _set_mask a bit map that indicates what parameter's fields should be set or update
+ *					#_SET_NONE | #_EXEC_CALLBACK | #_EXEC_BLOCK_CALLBACK
+ * @param prog	program number
+ * @return #_SETTINGS_OK if done, #_SETTINGS_KEY_NOT_FOUND or #_SETTINGS_PARAM_OUT_OF_RANGE otherwise
+ */
+settings_res_t ModSynthSettings::set_int_param_value(_setting_params_t *settings,
+													 settings_param_id_t id,
+													 int value,
+													 uint16_t set_mask,
+													 int prog)
+{
+	audio_param_update_t block_update;
+	bool block_update_ready = false;
+	mod_synth_settings_int_param_t *param;
+	_setting_params_t *_settings;
+
+	return_val_if_true(settings == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
+
+	settings_manage_mutex.lock();
+
+	_settings = select_settings(settings);
+	param = (mod_synth_settings_int_param_t*)get_indexed_param(_settings, id, _PARAM_VALUE_TYPE_INT);
+	if (param == NULL)
+	{
+		settings_manage_mutex.unlock();
+		return _SETTINGS_KEY_NOT_FOUND;
+	}
+
+	if (param->limits_set && ((value < param->min_val) || (value > param->max_val)))
+	{
+		// out of rang - abbort
+		settings_manage_mutex.unlock();
+		return _SETTINGS_PARAM_OUT_OF_RANGE;
+	}
+
+	param->value = value;
+
+	if (_CHECK_MASK(set_mask, _EXEC_CALLBACK) && (param->setup_callback != NULL))
+	{
+		param->setup_callback(value, prog);
+	}
+
+	if (_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK) && (param->block_setup_callback != NULL))
+	{
+		block_update_ready = prepare_int_block_update(param->block_setup_callback, value,
+			param->block_start_index, param->block_stop_index, param->type, prog, &block_update);
+	}
+
+	_settings->changes_count++;
+
+	settings_manage_mutex.unlock();
+
+	if (block_update_ready)
+	{
+		// Post after unlocking: post_wait() may block while the queue is full
+		post_block_update(&block_update);
+	}
+
+	return _SETTINGS_OK;
+}
+
+/**
+ * @brief	Set the specified string setting param value by its identifier.
+ *			if one of the set flags #_EXEC_CALLBACK or #_EXEC_BLOCK_CALLBACK is used,
+ *			the set value call back is also executed.
+ *			If the parameter is not defined operation fails.
+ *
+ * @param settings a settings parameters structure (NULL: active settings)
+ * @param id the setting's identifier
+ * @param value the param new value
+ * @param _set_mask a bit map that indicates what parameter's fields should be set or update
+ *					#_SET_NONE | #_EXEC_CALLBACK | #_EXEC_BLOCK_CALLBACK
+ * @param prog	program number
+ * @return #_SETTINGS_OK if done, #_SETTINGS_KEY_NOT_FOUND otherwise
+ */
+settings_res_t ModSynthSettings::set_string_param_value(_setting_params_t *settings,
+														settings_param_id_t id,
+														string value,
+														uint16_t set_mask,
+														int prog)
+{
+	mod_synth_settings_str_param_t *param;
+	_setting_params_t *_settings;
+	int i;
+
+	return_val_if_true(settings == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
+
+	settings_manage_mutex.lock();
+
+	_settings = select_settings(settings);
+	param = (mod_synth_settings_str_param_t*)get_indexed_param(_settings, id, _PARAM_VALUE_TYPE_STRING);
+	if (param == NULL)
+	{
+		settings_manage_mutex.unlock();
+		return _SETTINGS_KEY_NOT_FOUND;
+	}
+
+	param->value = value;
+
+	if (_CHECK_MASK(set_mask, _EXEC_CALLBACK) && (param->setup_callback != NULL))
+	{
+		param->setup_callback(value, prog);
+	}
+
+	if (_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK) && (param->block_setup_callback != NULL) &&
+		(param->block_start_index >= 0) && !defer_block_callback(param->type, prog))
+	{
+		for (i = param->block_start_index; i <= param->block_stop_index; i++)
+		{
+			param->block_setup_callback(value, i, prog);
+		}
+	}
+
+	_settings->changes_count++;
+
+	settings_manage_mutex.unlock();
+
+	return _SETTINGS_OK;
+}
+
+/**
+ * @brief	Set the specified float (double) setting param value by its identifier.
+ *			if one of the set flags #_EXEC_CALLBACK or #_EXEC_BLOCK_CALLBACK is used,
+ *			the set value call back is also executed.
+ *			If the parameter is not defined operation fails.
+ *
+ * @param settings a settings parameters structure (NULL: active settings)
+ * @param id the setting's identifier
+ * @param value the param new value
+ * @param _set_mask a bit map that indicates what parameter's fields should be set or update
+ *					#_SET_NONE | #_EXEC_CALLBACK | #_EXEC_BLOCK_CALLBACK
+ * @param prog	program number
+ * @return #_SETTINGS_OK if done, #_SETTINGS_KEY_NOT_FOUND or #_SETTINGS_PARAM_OUT_OF_RANGE otherwise
+ */
+settings_res_t ModSynthSettings::set_float_param_value(_setting_params_t *settings,
+													   settings_param_id_t id,
+													   double value,
+													   uint16_t set_mask,
+													   int prog)
+{
+	audio_param_update_t block_update;
+	bool block_update_ready = false;
+	mod_synth_settings_float_param_t *param;
+	_setting_params_t *_settings;
+
+	return_val_if_true(settings == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
+
+	settings_manage_mutex.lock();
+
+	_settings = select_settings(settings);
+	param = (mod_synth_settings_float_param_t*)get_indexed_param(_settings, id, _PARAM_VALUE_TYPE_FLOAT);
+	if (param == NULL)
+	{
+		settings_manage_mutex.unlock();
+		return _SETTINGS_KEY_NOT_FOUND;
+	}
+
+	if (param->limits_set && ((value < param->min_val) || (value > param->max_val)))
+	{
+		// out of rang - abbort
+		settings_manage_mutex.unlock();
+		return _SETTINGS_PARAM_OUT_OF_RANGE;
+	}
+
+	param->value = value;
+
+	if (_CHECK_MASK(set_mask, _EXEC_CALLBACK) && (param->setup_callback != NULL))
+	{
+		param->setup_callback(value, prog);
+	}
+
+	if (_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK) && (param->block_setup_callback != NULL))
+	{
+		block_update_ready = prepare_float_block_update(param->block_setup_callback, value,
+			param->block_start_index, param->block_stop_index, param->type, prog, &block_update);
+	}
+
+	_settings->changes_count++;
+
+	settings_manage_mutex.unlock();
+
+	if (block_update_ready)
+	{
+		// Post after unlocking: post_wait() may block while the queue is full
+		post_block_update(&block_update);
+	}
+
+	return _SETTINGS_OK;
+}
+
+/**
+ * @brief	Set the specified boolean setting param value by its identifier.
+ *			if one of the set flags #_EXEC_CALLBACK or #_EXEC_BLOCK_CALLBACK is used,
+ *			the set value call back is also executed.
+ *			If the parameter is not defined operation fails.
+ *
+ * @param settings a settings parameters structure (NULL: active settings)
+ * @param id the setting's identifier
+ * @param value the param new value
+ * @param _set_mask a bit map that indicates what parameter's fields should be set or update
+ *					#_SET_NONE | #_EXEC_CALLBACK | #_EXEC_BLOCK_CALLBACK
+ * @param prog	program number
+ * @return #_SETTINGS_OK if done, #_SETTINGS_KEY_NOT_FOUND otherwise
+ */
+settings_res_t ModSynthSettings::set_bool_param_value(_setting_params_t *settings,
+													  settings_param_id_t id,
+													  bool value,
+													  uint16_t set_mask,
+													  int prog)
+{
+	audio_param_update_t block_update;
+	bool block_update_ready = false;
+	mod_synth_settings_bool_param_t *param;
+	_setting_params_t *_settings;
+
+	return_val_if_true(settings == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
+
+	settings_manage_mutex.lock();
+
+	_settings = select_settings(settings);
+	param = (mod_synth_settings_bool_param_t*)get_indexed_param(_settings, id, _PARAM_VALUE_TYPE_BOOL);
+	if (param == NULL)
+	{
+		settings_manage_mutex.unlock();
+		return _SETTINGS_KEY_NOT_FOUND;
+	}
+
+	param->value = value;
+
+	if (_CHECK_MASK(set_mask, _EXEC_CALLBACK) && (param->setup_callback != NULL))
+	{
+		param->setup_callback(value, prog);
+	}
+
+	if (_CHECK_MASK(set_mask, _EXEC_BLOCK_CALLBACK) && (param->block_setup_callback != NULL))
+	{
+		block_update_ready = prepare_bool_block_update(param->block_setup_callback, value,
+			param->block_start_index, param->block_stop_index, param->type, prog, &block_update);
+	}
+
+	_settings->changes_count++;
+
+	settings_manage_mutex.unlock();
+
+	if (block_update_ready)
+	{
+		// Post after unlocking: post_wait() may block while the queue is full
+		post_block_update(&block_update);
+	}
+
+	return _SETTINGS_OK;
+}
+
 /**
  * Save active settings, sets active sketch number and 
  * copy active sketch settings to active settings.
@@ -1,8 +1,28 @@
 /**
 *	@file		synthSettings.h
 *	@author		Nahum Budin
-*	@date		29_Jan-2021
-*	@version	1.1 
+*	@date		17-Oct-2026
+*	@version	1.6
+*					1. Parameters batches (per calling thread): AdjSynth patch block callbacks
+*					   are replaced by a single voices update per program when the batch
+*					   is committed.
+*
+*	@version	1.5		17-Oct-2026
+*					1. Binary settings files (compiled from the XML files, memory mapped).
+*					2. String and float parameters set by identifiers.
+*
+*	@version	1.4		17-Oct-2026
+*					1. Voice block callbacks are executed by the audio update thread
+*					   (posted to the audio parameters updates queue).
+*
+*	@version	1.3		17-Oct-2026
+*					1. Reference counted (immutable) settings snapshots.
+*					2. Working settings deep copy.
+*
+*	@version	1.2		17-Oct-2026
+*					1. Parameters access by identifiers (dense parameters index).
+*
+*	@version	1.1		29_Jan-2021
 *					1. Code refactoring and notaion.
 *					
 *	@version	1.0		5-Oct-2019
@@ -21,6 +41,8 @@
 *		and a start index and a stop index parameter for the set value above, to enable auto block setting.
 *	The parameters are handeled as map that holds the parameter unique key name (string) and the parameter structure.
 *	Referencing a parameter is done by its name (key).
+*	Parameters listed in synthSettingsParamIds.h may also be referenced by their identifier
+*		through a dense index of pointers to the map entries (no string lookup, no copy).
 */
 
 #ifndef _MOD_SYNTH_SETTINGS
@@ -33,8 +55,13 @@
 #include <mutex>
 #include <bits/stdc++.h> 
 
+#include "synthSettingsParamIds.h"
+
 using namespace std;
 
+/* Audio parameters queue update record (audio/audioParamsQueue.h) */
+typedef struct _audio_param_update audio_param_update_t;
+
 /* Settings operations results */
 #define _SETTINGS_OK					0
 #define _SETTINGS_FAILED				-1
@@ -45,6 +72,9 @@ using namespace std;
 #define _SETTINGS_BAD_PATH				-6
 #define _SETTINGS_READ_FILE_ERROR		-7
 
+/* A binary settings file is a compiled copy of the XML settings file of the same name */
+#define _SETTINGS_BIN_FILE_EXTENSION	".msbin"
+
 // Bit fields
 #define _SET_NONE						0
 #define _SET_VALUE						(1 << 1)
@@ -104,6 +134,9 @@ typedef settings_res_t(*float_param_update_callback_t)(double value, int prog);
 /* Callback function - set boolean parameter action */
 typedef settings_res_t(*bool_param_update_callback_t)(bool value, int prog);
 
+/* Callback function - a parameters batch that modified a program voices parameters was committed */
+typedef void(*settings_batch_commit_callback_t)(int prog);
+
 /* Block update callbacks - includes an index to a specific bloc-parametr */
 
 /* Callback function - set string parameters-block action */
@@ -177,6 +210,23 @@ struct _mod_synth_settings_bool_param_t
 	bool block_callback_set;
 };
 
+/* 
+ * A dense index of pointers to a settings structure parameters (map entries), by parameter identifier.
+ * Map entries are not moved by insertions; the index is invalidated when a parameter is added
+ * and when the settings structure is copied (the copied pointers point to the source maps),
+ * and it is rebuilt on next use.
+ */
+struct _settings_params_index_t
+{
+	_settings_params_index_t() : valid(false) {}
+	_settings_params_index_t(const _settings_params_index_t &) : valid(false) {}
+	_settings_params_index_t &operator=(const _settings_params_index_t &) { valid = false; return *this; }
+
+	bool valid;
+	/* Points to a mod_synth_settings_xxx_param_t by the parameter value type; NULL if not defined */
+	void *params[_NUM_OF_SETTINGS_PARAM_IDS];
+};
+
 /* Holds a set of all settings parameters */
 typedef struct _params
 {
@@ -194,8 +244,40 @@ typedef struct _params
 	std::map<std::string, mod_synth_settings_float_param_t> float_parameters_map;
 	/* Boolean parameters map */
 	std::map<std::string, mod_synth_settings_bool_param_t> bool_parameters_map;
+	/* Parameters index by identifier */
+	_settings_params_index_t params_index;
+	/* Incremented on each parameter set */
+	uint32_t changes_count = 0;
 } _setting_params_t;
 
+/* 
+ * An immutable, reference counted copy of a settings parameters structure.
+ * A snapshot is duplicated by taking a reference (no maps copy); it is never modified.
+ * Snapshots are created by the editing (control) threads; a released snapshot is retired
+ * and deleted later by an editing thread, so real-time threads may release references.
+ */
+typedef struct _settings_snapshot
+{
+	_setting_params_t params;
+	/* Number of snapshot holders */
+	int ref_count;
+	/* Source settings changes count when the snapshot was taken */
+	uint32_t source_changes_count;
+	/* Next retired snapshot (to be deleted) */
+	struct _settings_snapshot *next_retired;
+} settings_snapshot_t;
+
+/* A parameter read from a settings file (used to compile a binary settings file) */
+typedef struct _settings_file_record
+{
+	std::string name;
+	int value_type;
+	std::string string_value;
+	int int_value;
+	double float_value;
+	bool bool_value;
+} settings_file_record_t;
+
 
 
 typedef int(*func_ptr_int_settings_parms_ptr_int_t)(_setting_params_t*, int);
@@ -212,6 +294,12 @@ public:
 	
 	static void settings_params_deep_copy(_setting_params_t *destination_params, _setting_params_t *source_params);
 
+	static settings_snapshot_t *create_snapshot(_setting_params_t *params);
+	static settings_snapshot_t *retain_snapshot(settings_snapshot_t *snapshot);
+	static void release_snapshot(settings_snapshot_t *snapshot);
+	static void collect_retired_snapshots();
+	static void exec_setup_callbacks(_setting_params_t *params, int prog);
+
 	uint32_t get_settings_version();
 
 	settings_res_t get_string_param(_setting_params_t *settings = NULL,
@@ -230,6 +318,14 @@ public:
 		string name = "",
 		mod_synth_settings_bool_param_t *param = NULL);
 
+	settings_res_t get_int_param_value(_setting_params_t *settings,
+		settings_param_id_t id,
+		int *value);
+
+	settings_res_t get_bool_param_value(_setting_params_t *settings,
+		settings_param_id_t id,
+		bool *value);
+
 
 	settings_res_t set_string_param(_setting_params_t *settings = NULL,
 		string name = "",
@@ -304,6 +400,30 @@ public:
 		uint16_t set_mask = 0,
 		int program = 0);
 
+	settings_res_t set_int_param_value(_setting_params_t *settings,
+		settings_param_id_t id,
+		int value,
+		uint16_t set_mask = 0,
+		int program = 0);
+
+	settings_res_t set_bool_param_value(_setting_params_t *settings,
+		settings_param_id_t id,
+		bool value,
+		uint16_t set_mask = 0,
+		int program = 0);
+
+	settings_res_t set_string_param_value(_setting_params_t *settings,
+		settings_param_id_t id,
+		string value,
+		uint16_t set_mask = 0,
+		int program = 0);
+
+	settings_res_t set_float_param_value(_setting_params_t *settings,
+		settings_param_id_t id,
+		double value,
+		uint16_t set_mask = 0,
+		int program = 0);
+
 	void set_active_sketch(int ask);
 	int get_active_sketch();
 
@@ -318,6 +438,18 @@ public:
 		uint16_t read_mask = 0,
 		int channel = 0);
 
+	static void begin_params_batch();
+	static void commit_params_batch();
+	static uint32_t detach_params_batch();
+	static void commit_params_batch_programs(uint32_t dirty_programs);
+	static void register_params_batch_commit_callback(settings_batch_commit_callback_t ptr);
+	static void register_params_changed_callback(settings_batch_commit_callback_t ptr);
+
+	settings_res_t read_settings_bin_file(_setting_params_t *params,
+		string path,
+		uint16_t read_mask,
+		int channel = 0);
+
 	int look_for_key(std::string key, std::map<std::string, int> params_map);	
 
 	/* Full path for settings XML files */
@@ -339,6 +471,34 @@ private:
 	
 	/* Mutex to handle settings opperations */
 	static std::mutex settings_manage_mutex;
+	
+	/* Parameters batch nesting depth of the calling thread; patch block callbacks are deferred while > 0 */
+	static thread_local int params_batch_depth;
+	/* Programs (bits) that had block callbacks deferred by the calling thread batch */
+	static thread_local uint32_t params_batch_dirty_programs;
+	static settings_batch_commit_callback_t params_batch_commit_callback_ptr;
+	/* Called after a block update is posted outside of a batch (the program patch was edited) */
+	static settings_batch_commit_callback_t params_changed_callback_ptr;
+	/* Released snapshots to be deleted by collect_retired_snapshots() (lock-free stack) */
+	static settings_snapshot_t *retired_snapshots;
+
+	_setting_params_t *select_settings(_setting_params_t *settings);
+	static void build_params_index(_setting_params_t *settings);
+	static void *get_indexed_param(_setting_params_t *settings, settings_param_id_t id, int value_type);
+	
+	settings_res_t write_settings_bin_file(std::vector<settings_file_record_t> *records,
+		uint16_t file_types,
+		string path);
+	static uint64_t get_params_ids_signature();
+	
+	static bool defer_block_callback(int type, int prog);
+	static bool prepare_int_block_update(int_block_param_update_callback_t callback, int value, int start, int stop, int type, int prog,
+		audio_param_update_t *update);
+	static bool prepare_float_block_update(float_block_param_update_callback_t callback, double value, int start, int stop, int type, int prog,
+		audio_param_update_t *update);
+	static bool prepare_bool_block_update(bool_block_param_update_callback_t callback, bool value, int start, int stop, int type, int prog,
+		audio_param_update_t *update);
+	static void post_block_update(audio_param_update_t *update);
 
 	ModSynthSettings *mod_synth_settings_instance;
 	/* Indicates which sketch is active */
@@ -0,0 +1,452 @@
+/**
+*	@file		synthSettingsBinFiles.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Binary settings files handling.
+*
+*				A binary settings file is a compiled copy of an XML settings file
+*				(patch, preset...): a fixed layout header followed by fixed size
+*				parameter records, keyed by parameter identifier (synthSettingsParamIds.h),
+*				and a pool of strings (string values and names of parameters that
+*				have no identifier). The file is memory mapped, verified and applied
+*				in one pass, with no text parsing.
+*
+*				The XML file remains the import/export format: the binary file is
+*				written when the XML file is read, and is used as long as the XML
+*				file is not modified.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "synthSettings.h"
+#include "../utils/utils.h"
+
+#include "../utils/XMLfiles.h"
+
+#define _SETTINGS_BIN_FILE_MAGIC		0x4E42534D		// "MSBN"
+// Bump when the file layout changes
+#define _SETTINGS_BIN_FILE_VERSION		1
+// Records start offset
+#define _SETTINGS_BIN_FILE_HEADER_SIZE	64
+
+// Checksum and identifiers signature hash (FNV-1a 64)
+#define _SETTINGS_BIN_FNV_OFFSET_BASIS	0xcbf29ce484222325ULL
+#define _SETTINGS_BIN_FNV_PRIME			0x100000001b3ULL
+
+// Record identifier of a parameter with no identifier (referenced by name)
+#define _SETTINGS_BIN_NAMED_PARAM		-1
+
+typedef struct settings_bin_file_header
+{
+	uint32_t magic;
+	uint32_t version;
+	/* Signature of the parameters identifiers list the file was written with */
+	uint64_t ids_signature;
+	/* Root types found in the source file (#_READ_ADJ_SYNTH_PATCH ...) */
+	uint32_t file_types;
+	uint32_t num_of_records;
+	uint32_t strings_size;
+	uint32_t reserved_1;
+	/* Source XML file size and modification time when compiled */
+	uint64_t source_size;
+	int64_t source_mtime_ns;
+	/* Records and strings checksum */
+	uint64_t checksum;
+	uint8_t reserved_2[_SETTINGS_BIN_FILE_HEADER_SIZE - 56];
+} settings_bin_file_header_t;
+
+typedef struct settings_bin_file_record
+{
+	/* Parameter identifier; #_SETTINGS_BIN_NAMED_PARAM: name at name_offset */
+	int32_t id;
+	uint16_t value_type;
+	uint16_t reserved;
+	uint32_t name_offset;
+	uint32_t string_offset;
+	union
+	{
+		int32_t int_value;
+		uint32_t bool_value;
+		double float_value;
+	} value;
+} settings_bin_file_record_t;
+
+static uint64_t settings_bin_hash(uint64_t hash, const void *data, size_t length)
+{
+	const uint8_t *bytes = (const uint8_t *)data;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		hash = (hash ^ bytes[i]) * _SETTINGS_BIN_FNV_PRIME;
+	}
+
+	return hash;
+}
+
+/* Return the parameter identifier of a name; -1 if none */
+static int settings_bin_get_param_id(const std::string &name)
+{
+	static std::map<std::string, int> ids_map = []()
+	{
+		std::map<std::string, int> ids;
+
+		for (int id = 0; id < _NUM_OF_SETTINGS_PARAM_IDS; id++)
+		{
+			ids[settings_param_names[id]] = id;
+		}
+
+		return ids;
+	}();
+	std::map<std::string, int>::iterator iter = ids_map.find(name);
+
+	return (iter == ids_map.end()) ? -1 : iter->second;
+}
+
+/* Return the size and modification time of a file; -1 if not found */
+static int settings_bin_get_file_stat(const std::string &path, uint64_t *size, int64_t *mtime_ns)
+{
+	struct stat st;
+
+	if (stat(path.c_str(), &st) != 0)
+	{
+		return -1;
+	}
+
+	*size = (uint64_t)st.st_size;
+	*mtime_ns = (int64_t)st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec;
+
+	return 0;
+}
+
+/**
+ * Return the signature of the parameters identifiers list (names and value types).
+ * A binary file written with a different list is not used.
+ *
+ * @return the identifiers list signature
+ */
+uint64_t ModSynthSettings::get_params_ids_signature()
+{
+	static uint64_t signature = 0;
+	uint64_t hash;
+	uint8_t type;
+
+	if (signature == 0)
+	{
+		hash = _SETTINGS_BIN_FNV_OFFSET_BASIS;
+		for (int id = 0; id < _NUM_OF_SETTINGS_PARAM_IDS; id++)
+		{
+			hash = settings_bin_hash(hash, settings_param_names[id], strlen(settings_param_names[id]) + 1);
+			type = (uint8_t)settings_param_value_types[id];
+			hash = settings_bin_hash(hash, &type, 1);
+		}
+
+		signature = hash;
+	}
+
+	return signature;
+}
+
+/**
+ * Reads settings parameter from the binary file compiled from an XML settings file.
+ * The file is used only if it is valid and the XML file was not modified since it
+ * was compiled.
+ *
+ * @param params settings parameters structure
+ * @param path full path of the XML file
+ * @param read_mask bit map to select read params type #_READ_FLUID_SETTINGS, #_READ_ADJ_SYNTH_PATCH,
+ *													   #_READ_ADJ_SYNTH_SETTINGS, #_READ_MOD_SYNTH_SETTINGS
+ *													   #_READ_MOD_SYNTH_PRESET
+ * @param channel	set param of midi channel
+ * @return #_SETTINGS_OK if read sucessfully, #_SETTINGS_READ_FILE_ERROR otherwise
+ */
+settings_res_t ModSynthSettings::read_settings_bin_file(_setting_params_t *params,
+														string path,
+														uint16_t read_mask,
+														int channel)
+{
+	XML_files xml_files;
+	std::string base_path, bin_path, name;
+	settings_bin_file_header_t *header;
+	settings_bin_file_record_t *records, *record;
+	const char *strings;
+	uint64_t source_size, checksum;
+	int64_t source_mtime_ns;
+	size_t length;
+	struct stat st;
+	void *mapped;
+	bool valid;
+	int fd, id;
+	uint32_t i;
+	settings_res_t res;
+	mod_synth_settings_str_param_t str_param;
+	uint16_t set_mask = _EXEC_CALLBACK | _EXEC_BLOCK_CALLBACK;
+
+	// Verify mandatory params
+	return_val_if_true(params == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
+	return_val_if_true(path == "", _SETTINGS_BAD_PARAMETERS);
+	return_val_if_true(read_mask == 0, _SETTINGS_BAD_PARAMETERS);
+
+	base_path = xml_files.remove_file_extention(path);
+	bin_path = base_path + _SETTINGS_BIN_FILE_EXTENSION;
+
+	fd = open(bin_path.c_str(), O_RDONLY);
+	if (fd < 0)
+	{
+		return _SETTINGS_READ_FILE_ERROR;
+	}
+
+	if ((fstat(fd, &st) != 0) || ((size_t)st.st_size < _SETTINGS_BIN_FILE_HEADER_SIZE))
+	{
+		close(fd);
+		return _SETTINGS_READ_FILE_ERROR;
+	}
+
+	length = (size_t)st.st_size;
+	mapped = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (mapped == MAP_FAILED)
+	{
+		return _SETTINGS_READ_FILE_ERROR;
+	}
+
+	header = (settings_bin_file_header_t *)mapped;
+	records = (settings_bin_file_record_t *)((uint8_t *)mapped + _SETTINGS_BIN_FILE_HEADER_SIZE);
+
+	// Verify the file before anything is applied
+	valid = (header->magic == _SETTINGS_BIN_FILE_MAGIC) &&
+			(header->version == _SETTINGS_BIN_FILE_VERSION) &&
+			(header->ids_signature == get_params_ids_signature()) &&
+			((header->file_types & read_mask) != 0) &&
+			(length == _SETTINGS_BIN_FILE_HEADER_SIZE +
+				(size_t)header->num_of_records * sizeof(settings_bin_file_record_t) + header->strings_size);
+
+	// A stale copy of a modified XML file is not used (a binary file with no XML file is)
+	if (valid && (settings_bin_get_file_stat(base_path + ".xml", &source_size, &source_mtime_ns) == 0))
+	{
+		valid = (source_size == header->source_size) && (source_mtime_ns == header->source_mtime_ns);
+	}
+
+	if (valid)
+	{
+		checksum = settings_bin_hash(_SETTINGS_BIN_FNV_OFFSET_BASIS, records,
+			length - _SETTINGS_BIN_FILE_HEADER_SIZE);
+		valid = (checksum == header->checksum);
+	}
+
+	strings = (const char *)(records + header->num_of_records);
+	if (valid && (header->strings_size > 0))
+	{
+		valid = (strings[header->strings_size - 1] == '\0');
+	}
+
+	for (i = 0; valid && (i < header->num_of_records); i++)
+	{
+		valid = (records[i].id < _NUM_OF_SETTINGS_PARAM_IDS) &&
+				((records[i].id >= 0) || (records[i].name_offset < header->strings_size)) &&
+				((records[i].value_type != _PARAM_VALUE_TYPE_STRING) || (records[i].string_offset < header->strings_size));
+	}
+
+	if (!valid)
+	{
+		fprintf(stderr, "Settings: ignoring invalid or outdated binary file %s\n", bin_path.c_str());
+		munmap(mapped, length);
+		return _SETTINGS_READ_FILE_ERROR;
+	}
+
+	// Apply, in the source file order
+	for (i = 0; i < header->num_of_records; i++)
+	{
+		record = &records[i];
+		id = record->id;
+		res = _SETTINGS_KEY_NOT_FOUND;
+
+		switch (record->value_type)
+		{
+			case _PARAM_VALUE_TYPE_STRING:
+				if (id >= 0)
+				{
+					res = set_string_param_value(params, (settings_param_id_t)id,
+						std::string(strings + record->string_offset), set_mask, channel);
+				}
+
+				if (res == _SETTINGS_KEY_NOT_FOUND)
+				{
+					name = (id >= 0) ? settings_param_names[id] : strings + record->name_offset;
+					set_string_param_value(params, name, std::string(strings + record->string_offset),
+						set_mask, channel);
+				}
+				break;
+
+			case _PARAM_VALUE_TYPE_INT:
+				if (id >= 0)
+				{
+					res = set_int_param_value(params, (settings_param_id_t)id,
+						(int)record->value.int_value, set_mask, channel);
+				}
+
+				if (res == _SETTINGS_KEY_NOT_FOUND)
+				{
+					name = (id >= 0) ? settings_param_names[id] : strings + record->name_offset;
+					set_int_param_value(params, name, (int)record->value.int_value, set_mask, channel);
+				}
+				break;
+
+			case _PARAM_VALUE_TYPE_FLOAT:
+				if (id >= 0)
+				{
+					res = set_float_param_value(params, (settings_param_id_t)id,
+						record->value.float_value, set_mask, channel);
+				}
+
+				if (res == _SETTINGS_KEY_NOT_FOUND)
+				{
+					name = (id >= 0) ? settings_param_names[id] : strings + record->name_offset;
+					set_float_param_value(params, name, record->value.float_value, set_mask, channel);
+				}
+				break;
+
+			case _PARAM_VALUE_TYPE_BOOL:
+				if (id >= 0)
+				{
+					res = set_bool_param_value(params, (settings_param_id_t)id,
+						record->value.bool_value != 0, set_mask, channel);
+				}
+
+				if (res == _SETTINGS_KEY_NOT_FOUND)
+				{
+					name = (id >= 0) ? settings_param_names[id] : strings + record->name_offset;
+					set_bool_param_value(params, name, record->value.bool_value != 0, set_mask, channel);
+				}
+				break;
+		}
+	}
+
+	munmap(mapped, length);
+
+	if ((params != NULL) && (get_string_param(params, "name", &str_param) == _SETTINGS_KEY_FOUND))
+	{
+		params->name = str_param.value;
+	}
+
+	return _SETTINGS_OK;
+}
+
+/**
+ * Writes the binary copy of an XML settings file.
+ *
+ * @param records a pointer to the parameters read from the XML file (in file order)
+ * @param file_types root types found in the XML file (#_READ_ADJ_SYNTH_PATCH ...)
+ * @param path full path of the XML file
+ * @return #_SETTINGS_OK if written sucessfully, #_SETTINGS_FAILED otherwise
+ */
+settings_res_t ModSynthSettings::write_settings_bin_file(std::vector<settings_file_record_t> *records,
+														 uint16_t file_types,
+														 string path)
+{
+	XML_files xml_files;
+	std::string base_path, bin_path, tmp_path;
+	std::vector<settings_bin_file_record_t> bin_records;
+	std::string strings;
+	settings_bin_file_header_t header;
+	settings_bin_file_record_t bin_record;
+	uint64_t checksum;
+	FILE *file;
+	bool ok;
+	int id;
+
+	return_val_if_true(records == NULL, _SETTINGS_BAD_PARAMETERS);
+	return_val_if_true(path == "", _SETTINGS_BAD_PARAMETERS);
+
+	base_path = xml_files.remove_file_extention(path);
+	bin_path = base_path + _SETTINGS_BIN_FILE_EXTENSION;
+	tmp_path = bin_path + ".tmp";
+
+	memset(&header, 0, sizeof(header));
+	if (settings_bin_get_file_stat(base_path + ".xml", &header.source_size, &header.source_mtime_ns) != 0)
+	{
+		return _SETTINGS_FAILED;
+	}
+
+	bin_records.reserve(records->size());
+	for (auto &record : *records)
+	{
+		memset(&bin_record, 0, sizeof(bin_record));
+
+		id = settings_bin_get_param_id(record.name);
+		if ((id >= 0) && (settings_param_value_types[id] == record.value_type))
+		{
+			bin_record.id = id;
+		}
+		else
+		{
+			bin_record.id = _SETTINGS_BIN_NAMED_PARAM;
+			bin_record.name_offset = (uint32_t)strings.size();
+			strings.append(record.name);
+			strings.push_back('\0');
+		}
+
+		bin_record.value_type = (uint16_t)record.value_type;
+		switch (record.value_type)
+		{
+			case _PARAM_VALUE_TYPE_STRING:
+				bin_record.string_offset = (uint32_t)strings.size();
+				strings.append(record.string_value);
+				strings.push_back('\0');
+				break;
+
+			case _PARAM_VALUE_TYPE_INT:
+				bin_record.value.int_value = record.int_value;
+				break;
+
+			case _PARAM_VALUE_TYPE_FLOAT:
+				bin_record.value.float_value = record.float_value;
+				break;
+
+			case _PARAM_VALUE_TYPE_BOOL:
+				bin_record.value.bool_value = record.bool_value ? 1 : 0;
+				break;
+		}
+
+		bin_records.push_back(bin_record);
+	}
+
+	checksum = _SETTINGS_BIN_FNV_OFFSET_BASIS;
+	checksum = settings_bin_hash(checksum, bin_records.data(), bin_records.size() * sizeof(settings_bin_file_record_t));
+	checksum = settings_bin_hash(checksum, strings.data(), strings.size());
+
+	header.magic = _SETTINGS_BIN_FILE_MAGIC;
+	header.version = _SETTINGS_BIN_FILE_VERSION;
+	header.ids_signature = get_params_ids_signature();
+	header.file_types = file_types;
+	header.num_of_records = (uint32_t)bin_records.size();
+	header.strings_size = (uint32_t)strings.size();
+	header.checksum = checksum;
+
+	file = fopen(tmp_path.c_str(), "wb");
+	if (file == NULL)
+	{
+		return _SETTINGS_FAILED;
+	}
+
+	ok = (fwrite(&header, sizeof(header), 1, file) == 1) &&
+		 (fwrite(bin_records.data(), sizeof(settings_bin_file_record_t), bin_records.size(), file) == bin_records.size()) &&
+		 (fwrite(strings.data(), 1, strings.size(), file) == strings.size());
+	ok = (fclose(file) == 0) && ok;
+
+	if (!ok || (rename(tmp_path.c_str(), bin_path.c_str()) != 0))
+	{
+		fprintf(stderr, "Settings: unable to write binary file %s\n", bin_path.c_str());
+		unlink(tmp_path.c_str());
+		return _SETTINGS_FAILED;
+	}
+
+	return _SETTINGS_OK;
+}
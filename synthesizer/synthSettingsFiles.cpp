@@ -2,7 +2,14 @@
 * @file		synthSettingsFiles.cpp
 *	@author		Nahum Budin
 *	@date		7_feb-2021
-*	@version	1.1
+*	@version	1.3
+*					1. A settings file parameters are applied as one parameters batch.
+*
+*	@version	1.2		17-Oct-2026
+*					1. XML files are compiled to binary settings files when read;
+*					   the binary file is read instead while the XML file is not modified.
+*
+*	@version	1.1		7_feb-2021
 *					1. Code refactoring and notaion.
 *	
 *	@brief		Synthesizer settings files handling.
@@ -12,6 +19,7 @@
 */
 
 #include <stdint.h>
+#include <unistd.h>
 
 #include "synthSettings.h"
 #include "../utils/utils.h"
@@ -300,6 +308,9 @@ settings_res_t ModSynthSettings::write_settings_file(_setting_params_t *params,
 	xml_file_string.push_back(xml_files->end_tag(type_str, 0));
 
 	res = xml_files->write_xml_file(xml_files->remove_file_extention(path).c_str(), &xml_file_string);
+	
+	// The binary copy is compiled again when the new XML file is read
+	unlink((xml_files->remove_file_extention(path) + _SETTINGS_BIN_FILE_EXTENSION).c_str());
 
 	return res;
 }
@@ -330,15 +341,29 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 	bool bool_param_value;
 	int id, ivalue, count;
 	mod_synth_settings_str_param_t str_param;
+	std::vector<settings_file_record_t> records;
+	settings_file_record_t record;
+	uint16_t file_types = 0;
 	
 	// Verify mandatory params
 	return_val_if_true(params == NULL && active_settings_params == NULL, _SETTINGS_BAD_PARAMETERS);
 	return_val_if_true(path == "", _SETTINGS_BAD_PARAMETERS);
 	return_val_if_true(read_mask == 0, _SETTINGS_BAD_PARAMETERS);
 	
+	// Voices are updated once, when all the file parameters are set
+	begin_params_batch();
+	
+	// Use the binary copy, if valid and up to date (no XML parsing)
+	if (read_settings_bin_file(params, path, read_mask, channel) == _SETTINGS_OK)
+	{
+		commit_params_batch();
+		return _SETTINGS_OK;
+	}
+	
 	res = xml_files->read_xml_file(xml_files->remove_file_extention(path).c_str(), &read_file_data);
 	if (res != _SETTINGS_OK)
 	{
+		commit_params_batch();
 		return _SETTINGS_READ_FILE_ERROR;
 	}
 	
@@ -348,6 +373,12 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 		(xml_files->element_exist(read_file_data, "mod_synth_settings") && _CHECK_MASK(read_mask, _READ_MOD_SYNTH_SETTINGS)) ||
 		(xml_files->element_exist(read_file_data, "mod_synth_preset") && _CHECK_MASK(read_mask, _READ_MOD_SYNTH_PRESET)))
 	{	
+		file_types |= xml_files->element_exist(read_file_data, "fluid_synth_settings") ? _READ_FLUID_SETTINGS : 0;
+		file_types |= xml_files->element_exist(read_file_data, "adj_synth_patch") ? _READ_ADJ_SYNTH_PATCH : 0;
+		file_types |= xml_files->element_exist(read_file_data, "adj_synth_settings") ? _READ_ADJ_SYNTH_SETTINGS : 0;
+		file_types |= xml_files->element_exist(read_file_data, "mod_synth_settings") ? _READ_MOD_SYNTH_SETTINGS : 0;
+		file_types |= xml_files->element_exist(read_file_data, "mod_synth_preset") ? _READ_MOD_SYNTH_PRESET : 0;
+		
 		int_params = xml_files->get_int_params(read_file_data);
 		bool_params = xml_files->get_bool_params(read_file_data);
 		float_params = xml_files->get_float_params(read_file_data);
@@ -355,6 +386,7 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 	}
 	else
 	{
+		commit_params_batch();
 		return _SETTINGS_READ_FILE_ERROR;
 	}
 	
@@ -366,6 +398,11 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 		string_param_value = xml_files->get_string_element_value(element);
 		if (!param_name.empty())
 		{
+			record.name = param_name;
+			record.value_type = _PARAM_VALUE_TYPE_STRING;
+			record.string_value = string_param_value;
+			records.push_back(record);
+			
 			set_string_param_value(params,
 				param_name,
 				string_param_value,
@@ -389,6 +426,11 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 		int_param_value = xml_files->get_int_element_value(element);
 		if (!param_name.empty())
 		{
+			record.name = param_name;
+			record.value_type = _PARAM_VALUE_TYPE_INT;
+			record.int_value = int_param_value;
+			records.push_back(record);
+			
 			set_int_param_value(params,
 				param_name,
 				int_param_value,
@@ -405,6 +447,11 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 		float_param_value = xml_files->get_float_element_value(element);
 		if (!param_name.empty())
 		{
+			record.name = param_name;
+			record.value_type = _PARAM_VALUE_TYPE_FLOAT;
+			record.float_value = float_param_value;
+			records.push_back(record);
+			
 			set_float_param_value(params,
 				param_name,
 				float_param_value,
@@ -421,6 +468,11 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 		bool_param_value = xml_files->get_bool_element_value(element);
 		if (!param_name.empty())
 		{
+			record.name = param_name;
+			record.value_type = _PARAM_VALUE_TYPE_BOOL;
+			record.bool_value = bool_param_value;
+			records.push_back(record);
+			
 			set_bool_param_value(params,
 				param_name,
 				bool_param_value,
@@ -429,5 +481,10 @@ settings_res_t ModSynthSettings::read_settings_file(_setting_params_t *params,
 		}
 	}
 	
+	commit_params_batch();
+	
+	// Compile the binary copy used by the next reads of this file
+	write_settings_bin_file(&records, file_types, path);
+	
 	return res;
 }
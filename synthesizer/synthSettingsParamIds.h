@@ -0,0 +1,358 @@
+/**
+*	@file		synthSettingsParamIds.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Settings parameters identifiers.
+*
+*	Each settings parameter that is accessed at run time (GUI refresh, events handling)
+*	has a compile time identifier, generated from the list below.
+*	An identifier indexes a dense per-settings-structure table of the parameters, so getting
+*	or setting a parameter value by its identifier does not involve a string key lookup.
+*	The string key (name) of each parameter is kept for settings files I/O and debugging.
+*
+*	To add a parameter: add it to the list below and register it (set_xxx_param()) as usual.
+*	Some listed keys are not registered by default; they are created when first set
+*	by events handling (e.g. "adjsynth.amp_ch1.level").
+*/
+
+#ifndef _MOD_SYNTH_SETTINGS_PARAM_IDS
+#define _MOD_SYNTH_SETTINGS_PARAM_IDS
+
+/* Parameters value types */
+#define _PARAM_VALUE_TYPE_STRING			0
+#define _PARAM_VALUE_TYPE_INT				1
+#define _PARAM_VALUE_TYPE_FLOAT				2
+#define _PARAM_VALUE_TYPE_BOOL				3
+
+/* _PARAM(identifier, key name, value type) */
+#define _SETTINGS_PARAMS_LIST(_PARAM) \
+	/* Patch - oscillators */ \
+	_PARAM(OSC1_ENABLED, "adjsynth.osc1.enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(OSC1_WAVEFORM, "adjsynth.osc1.waveform", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_SYMMETRY, "adjsynth.osc1.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_SEND_FILTER_1, "adjsynth.osc1.send_filter_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_SEND_FILTER_2, "adjsynth.osc1.send_filter_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_TUNE_OFFSET_OCT, "adjsynth.osc1.tune_offset_oct", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_TUNE_OFFSET_SEMITONES, "adjsynth.osc1.tune_offset_semitones", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_TUNE_OFFSET_CENTS, "adjsynth.osc1.tune_offset_cents", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_FREQ_MODULATION_LFO_NUM, "adjsynth.osc1.freq_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_FREQ_MODULATION_LFO_LEVEL, "adjsynth.osc1.freq_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_FREQ_MODULATION_ENV_NUM, "adjsynth.osc1.freq_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_FREQ_MODULATION_ENV_LEVEL, "adjsynth.osc1.freq_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_PWM_MODULATION_LFO_NUM, "adjsynth.osc1.pwm_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_PWM_MODULATION_LFO_LEVEL, "adjsynth.osc1.pwm_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_PWM_MODULATION_ENV_NUM, "adjsynth.osc1.pwm_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_PWM_MODULATION_ENV_LEVEL, "adjsynth.osc1.pwm_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_AMP_MODULATION_LFO_NUM, "adjsynth.osc1.amp_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_AMP_MODULATION_LFO_LEVEL, "adjsynth.osc1.amp_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_AMP_MODULATION_ENV_NUM, "adjsynth.osc1.amp_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_AMP_MODULATION_ENV_LEVEL, "adjsynth.osc1.amp_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_MODE, "adjsynth.osc1.unison_mode", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_HAMMOND_PERCUSSION_MODE, "adjsynth.osc1.hammond_percussion_mode", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_1, "adjsynth.osc1.unison_level_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_2, "adjsynth.osc1.unison_level_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_3, "adjsynth.osc1.unison_level_3", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_4, "adjsynth.osc1.unison_level_4", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_5, "adjsynth.osc1.unison_level_5", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_6, "adjsynth.osc1.unison_level_6", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_7, "adjsynth.osc1.unison_level_7", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_8, "adjsynth.osc1.unison_level_8", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_LEVEL_9, "adjsynth.osc1.unison_level_9", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_DISTORTION, "adjsynth.osc1.unison_distortion", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_DETUNE, "adjsynth.osc1.unison_detune", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC1_UNISON_SQUARE_WAVE, "adjsynth.osc1.unison_square_wave", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(OSC2_ENABLED, "adjsynth.osc2.enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(OSC2_WAVEFORM, "adjsynth.osc2.waveform", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_SYMMETRY, "adjsynth.osc2.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_SEND_FILTER_1, "adjsynth.osc2.send_filter_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_SEND_FILTER_2, "adjsynth.osc2.send_filter_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_TUNE_OFFSET_OCT, "adjsynth.osc2.tune_offset_oct", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_TUNE_OFFSET_SEMITONES, "adjsynth.osc2.tune_offset_semitones", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_TUNE_OFFSET_CENTS, "adjsynth.osc2.tune_offset_cents", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_FREQ_MODULATION_LFO_NUM, "adjsynth.osc2.freq_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_FREQ_MODULATION_LFO_LEVEL, "adjsynth.osc2.freq_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_FREQ_MODULATION_ENV_NUM, "adjsynth.osc2.freq_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_FREQ_MODULATION_ENV_LEVEL, "adjsynth.osc2.freq_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_PWM_MODULATION_LFO_NUM, "adjsynth.osc2.pwm_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_PWM_MODULATION_LFO_LEVEL, "adjsynth.osc2.pwm_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_PWM_MODULATION_ENV_NUM, "adjsynth.osc2.pwm_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_PWM_MODULATION_ENV_LEVEL, "adjsynth.osc2.pwm_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_AMP_MODULATION_LFO_NUM, "adjsynth.osc2.amp_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_AMP_MODULATION_LFO_LEVEL, "adjsynth.osc2.amp_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_AMP_MODULATION_ENV_NUM, "adjsynth.osc2.amp_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_AMP_MODULATION_ENV_LEVEL, "adjsynth.osc2.amp_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(OSC2_SYNC_ON_OSC_1, "adjsynth.osc2.sync_on_osc_1", _PARAM_VALUE_TYPE_BOOL) \
+	/* Patch - noise */ \
+	_PARAM(NOISE_ENABLED, "adjsynth.noise.enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(NOISE_COLOR, "adjsynth.noise.color", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(NOISE_SEND_FILTER_1, "adjsynth.noise.send_filter_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(NOISE_SEND_FILTER_2, "adjsynth.noise.send_filter_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(NOISE_AMP_MODULATION_LFO_NUM, "adjsynth.noise.amp_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(NOISE_AMP_MODULATION_LFO_LEVEL, "adjsynth.noise.amp_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(NOISE_AMP_MODULATION_ENV_NUM, "adjsynth.noise.amp_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(NOISE_AMP_MODULATION_ENV_LEVEL, "adjsynth.noise.amp_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	/* Patch - MSO */ \
+	_PARAM(MSO_SYNTH_ENABLED, "adjsynth.mso_synth.enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(MSO_SYNTH_SYMMETRY, "adjsynth.mso_synth.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEND_FILTER_1, "adjsynth.mso_synth.send_filter_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEND_FILTER_2, "adjsynth.mso_synth.send_filter_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_TUNE_OFFSET_OCT, "adjsynth.mso_synth.tune_offset_oct", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_TUNE_OFFSET_SEMITONES, "adjsynth.mso_synth.tune_offset_semitones", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_TUNE_OFFSET_CENTS, "adjsynth.mso_synth.tune_offset_cents", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_FREQ_MODULATION_LFO_NUM, "adjsynth.mso_synth.freq_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_FREQ_MODULATION_LFO_LEVEL, "adjsynth.mso_synth.freq_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_FREQ_MODULATION_ENV_NUM, "adjsynth.mso_synth.freq_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_FREQ_MODULATION_ENV_LEVEL, "adjsynth.mso_synth.freq_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_FREQ_MODULATION_ENV_LEV, "adjsynth.mso_synth.freq_modulation_env_lev", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_PWM_MODULATION_LFO_NUM, "adjsynth.mso_synth.pwm_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_PWM_MODULATION_LFO_LEVEL, "adjsynth.mso_synth.pwm_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_PWM_MODULATION_ENV_NUM, "adjsynth.mso_synth.pwm_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_PWM_MODULATION_ENV_LEVEL, "adjsynth.mso_synth.pwm_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_AMP_MODULATION_LFO_NUM, "adjsynth.mso_synth.amp_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_AMP_MODULATION_LFO_LEVEL, "adjsynth.mso_synth.amp_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_AMP_MODULATION_ENV_NUM, "adjsynth.mso_synth.amp_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_AMP_MODULATION_ENV_LEVEL, "adjsynth.mso_synth.amp_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEGMENT_POSITION_A, "adjsynth.mso_synth.segment_position_a", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEGMENT_POSITION_B, "adjsynth.mso_synth.segment_position_b", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEGMENT_POSITION_C, "adjsynth.mso_synth.segment_position_c", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEGMENT_POSITION_D, "adjsynth.mso_synth.segment_position_d", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEGMENT_POSITION_E, "adjsynth.mso_synth.segment_position_e", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEGMENT_POSITION_F_CB, "adjsynth.mso_synth.segment_position_f_cb", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_SEGMENT_POSITION_F, "adjsynth.mso_synth.segment_position_f", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MSO_SYNTH_PRESET, "adjsynth.mso_synth.preset", _PARAM_VALUE_TYPE_INT) \
+	/* Patch - PAD */ \
+	_PARAM(PAD_SYNTH_ENABLED, "adjsynth.pad_synth.enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(PAD_SYNTH_TUNE_OFFSET_OCTAVE, "adjsynth.pad_synth.tune_offset_octave", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_TUNE_OFFSET_SEMITONES, "adjsynth.pad_synth.tune_offset_semitones", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_TUNE_OFFSET_CENTS, "adjsynth.pad_synth.tune_offset_cents", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_SEND_FILTER_1, "adjsynth.pad_synth.send_filter_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_SEND_FILTER_2, "adjsynth.pad_synth.send_filter_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_FREQ_MODULATION_LFO_NUM, "adjsynth.pad_synth.freq_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_FREQ_MODULATION_LFO_LEVEL, "adjsynth.pad_synth.freq_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_FREQ_MODULATION_ENV_NUM, "adjsynth.pad_synth.freq_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_FREQ_MODULATION_ENV_LEVEL, "adjsynth.pad_synth.freq_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_AMP_MODULATION_LFO_NUM, "adjsynth.pad_synth.amp_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_AMP_MODULATION_LFO_LEVEL, "adjsynth.pad_synth.amp_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_AMP_MODULATION_ENV_NUM, "adjsynth.pad_synth.amp_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_AMP_MODULATION_ENV_LEVEL, "adjsynth.pad_synth.amp_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_QUALITY, "adjsynth.pad_synth.quality", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_BASE_NOTE, "adjsynth.pad_synth.base_note", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_BASE_WIDTH, "adjsynth.pad_synth.base_width", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_SHAPE, "adjsynth.pad_synth.shape", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_SHAPE_CUTOFF, "adjsynth.pad_synth.shape_cutoff", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_0, "adjsynth.pad_synth.harmonies_level_0", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_1, "adjsynth.pad_synth.harmonies_level_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_2, "adjsynth.pad_synth.harmonies_level_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_3, "adjsynth.pad_synth.harmonies_level_3", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_4, "adjsynth.pad_synth.harmonies_level_4", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_5, "adjsynth.pad_synth.harmonies_level_5", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_6, "adjsynth.pad_synth.harmonies_level_6", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_7, "adjsynth.pad_synth.harmonies_level_7", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_8, "adjsynth.pad_synth.harmonies_level_8", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_LEVEL_9, "adjsynth.pad_synth.harmonies_level_9", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(PAD_SYNTH_HARMONIES_DETUNE, "adjsynth.pad_synth.harmonies_detune", _PARAM_VALUE_TYPE_INT) \
+	/* Patch - Karplus-Strong */ \
+	_PARAM(KARPLUS_SYNTH_ENABLED, "adjsynth.karplus_synth.enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(KARPLUS_SYNTH_EXCITATION_WAVEFORM_TYPE, "adjsynth.karplus_synth.excitation_waveform_type", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_EXCITATION_WAVEFORM_VARIATIONS, "adjsynth.karplus_synth.excitation_waveform_variations", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_DECAY, "adjsynth.karplus_synth.decay", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_PLUCK_DAMPING, "adjsynth.karplus_synth.pluck_damping", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_PLUCK_DAMPING_VARIATIONS, "adjsynth.karplus_synth.pluck_damping_variations", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_STRING_DAMPING, "adjsynth.karplus_synth.string_damping", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_STRING_DAMPING_VARIATIONS, "adjsynth.karplus_synth.string_damping_variations", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_STRING_DAMPING_CALCULATION_MODE, "adjsynth.karplus_synth.string_damping_calculation_mode", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_SEND_FILTER_1, "adjsynth.karplus_synth.send_filter_1", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_SEND_FILTER_2, "adjsynth.karplus_synth.send_filter_2", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_ON_DECAY, "adjsynth.karplus_synth.on_decay", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KARPLUS_SYNTH_OFF_DECAY, "adjsynth.karplus_synth.off_decay", _PARAM_VALUE_TYPE_INT) \
+	/* Patch - filters */ \
+	_PARAM(FILTER1_FREQUENCY, "adjsynth.filter1.frequency", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_OCTAVE, "adjsynth.filter1.octave", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_Q, "adjsynth.filter1.q", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_KEYBOARD_TRACK, "adjsynth.filter1.keyboard_track", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_BAND, "adjsynth.filter1.band", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_FREQ_MODULATION_LFO_NUM, "adjsynth.filter1.freq_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_FREQ_MODULATION_LFO_LEVEL, "adjsynth.filter1.freq_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_FREQ_MODULATION_ENV_NUM, "adjsynth.filter1.freq_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER1_FREQ_MODULATION_ENV_LEVEL, "adjsynth.filter1.freq_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_FREQUENCY, "adjsynth.filter2.frequency", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_OCTAVE, "adjsynth.filter2.octave", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_Q, "adjsynth.filter2.q", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_KEYBOARD_TRACK, "adjsynth.filter2.keyboard_track", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_BAND, "adjsynth.filter2.band", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_FREQ_MODULATION_LFO_NUM, "adjsynth.filter2.freq_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_FREQ_MODULATION_LFO_LEVEL, "adjsynth.filter2.freq_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_FREQ_MODULATION_ENV_NUM, "adjsynth.filter2.freq_modulation_env_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(FILTER2_FREQ_MODULATION_ENV_LEVEL, "adjsynth.filter2.freq_modulation_env_level", _PARAM_VALUE_TYPE_INT) \
+	/* Patch - amplifiers */ \
+	_PARAM(AMP_CH1_LEVEL_CB, "adjsynth.amp_ch1.level_cb", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH1_LEVEL, "adjsynth.amp_ch1.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH1_PAN, "adjsynth.amp_ch1.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH1_SEND, "adjsynth.amp_ch1.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH1_PAN_MODULATION_LFO_NUM, "adjsynth.amp_ch1.pan_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH1_PAN_MODULATION_LFO_LEVEL, "adjsynth.amp_ch1.pan_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH2_LEVEL, "adjsynth.amp_ch2.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH2_PAN, "adjsynth.amp_ch2.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH2_SEND, "adjsynth.amp_ch2.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH2_PAN_MODULATION_LFO_NUM, "adjsynth.amp_ch2.pan_modulation_lfo_num", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_CH2_PAN_MODULATION_LFO_LEVEL, "adjsynth.amp_ch2.pan_modulation_lfo_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AMP_FIXED_LEVELS_ENABLED, "adjsynth.amp.fixed_levels_enabled", _PARAM_VALUE_TYPE_BOOL) \
+	/* Patch - modulators */ \
+	_PARAM(LFO_1_WAVEFORM, "adjsynth.lfo_1.waveform", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_1_RATE, "adjsynth.lfo_1.rate", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_1_SYMMETRY, "adjsynth.lfo_1.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_2_WAVEFORM, "adjsynth.lfo_2.waveform", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_2_RATE, "adjsynth.lfo_2.rate", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_2_SYMMETRY, "adjsynth.lfo_2.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_3_WAVEFORM, "adjsynth.lfo_3.waveform", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_3_RATE, "adjsynth.lfo_3.rate", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_3_SYMMETRY, "adjsynth.lfo_3.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_4_WAVEFORM, "adjsynth.lfo_4.waveform", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_4_RATE, "adjsynth.lfo_4.rate", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_4_SYMMETRY, "adjsynth.lfo_4.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_5_WAVEFORM, "adjsynth.lfo_5.waveform", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_5_RATE, "adjsynth.lfo_5.rate", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(LFO_5_SYMMETRY, "adjsynth.lfo_5.symmetry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_1_ATTACK, "adjsynth.env_1.attack", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_1_DECAY, "adjsynth.env_1.decay", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_1_SUSTAIN, "adjsynth.env_1.sustain", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_1_RELEASE, "adjsynth.env_1.release", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_2_ATTACK, "adjsynth.env_2.attack", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_2_DECAY, "adjsynth.env_2.decay", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_2_SUSTAIN, "adjsynth.env_2.sustain", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_2_RELEASE, "adjsynth.env_2.release", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_3_ATTACK, "adjsynth.env_3.attack", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_3_DECAY, "adjsynth.env_3.decay", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_3_SUSTAIN, "adjsynth.env_3.sustain", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_3_RELEASE, "adjsynth.env_3.release", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_4_ATTACK, "adjsynth.env_4.attack", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_4_DECAY, "adjsynth.env_4.decay", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_4_SUSTAIN, "adjsynth.env_4.sustain", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_4_RELEASE, "adjsynth.env_4.release", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_5_ATTACK, "adjsynth.env_5.attack", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_5_DECAY, "adjsynth.env_5.decay", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_5_SUSTAIN, "adjsynth.env_5.sustain", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(ENV_5_RELEASE, "adjsynth.env_5.release", _PARAM_VALUE_TYPE_INT) \
+	/* Patch - distortion */ \
+	_PARAM(DISTORTION_ENABLED, "adjsynth.distortion.enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(DISTORTION_AUTO_GAIN_ENABLED, "adjsynth.distortion.auto_gain_enabled", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(DISTORTION_1_DRIVE, "adjsynth.distortion_1.drive", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(DISTORTION_1_RANGE, "adjsynth.distortion_1.range", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(DISTORTION_1_BLEND, "adjsynth.distortion_1.blend", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(DISTORTION_2_DRIVE, "adjsynth.distortion_2.drive", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(DISTORTION_2_RANGE, "adjsynth.distortion_2.range", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(DISTORTION_2_BLEND, "adjsynth.distortion_2.blend", _PARAM_VALUE_TYPE_INT) \
+	/* Settings - keyboard */ \
+	_PARAM(KEYBOARD_PORTAMENTO, "adjsynth.keyboard.portamento", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KEYBOARD_SENSETIVITY, "adjsynth.keyboard.sensetivity", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KEYBOARD_SENSETIVITY_LOW, "adjsynth.keyboard.sensetivity_low", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KEYBOARD_SPLIT_POINT, "adjsynth.keyboard.split_point", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KEYBOARD_POLYPHONIC_MODE, "adjsynth.keyboard.polyphonic_mode", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(KEYBOARD_PORTAMENTO_STATE, "adjsynth.keyboard.portamento_state", _PARAM_VALUE_TYPE_BOOL) \
+	/* Settings - reverb */ \
+	_PARAM(REVERB3M_ENABLE_STATE, "adjsynth.reverb3m.enable_state", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(REVERB_ENABLE_STATE, "adjsynth.reverb.enable_state", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(REVERB3M_PRESET, "adjsynth.reverb3m.preset", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(REVERB_ROOM_SIZE, "adjsynth.reverb.room_size", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(REVERB_DAMP, "adjsynth.reverb.damp", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(REVERB_WET, "adjsynth.reverb.wet", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(REVERB_DRY, "adjsynth.reverb.dry", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(REVERB_MODE, "adjsynth.reverb.mode", _PARAM_VALUE_TYPE_INT) \
+	/* Settings - equalizer */ \
+	_PARAM(EQUALIZER_BAND_31_LEVEL, "adjsynth.equalizer.band_31_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_62_LEVEL, "adjsynth.equalizer.band_62_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_125_LEVEL, "adjsynth.equalizer.band_125_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_250_LEVEL, "adjsynth.equalizer.band_250_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_500_LEVEL, "adjsynth.equalizer.band_500_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_1K_LEVEL, "adjsynth.equalizer.band_1k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_2K_LEVEL, "adjsynth.equalizer.band_2k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_4K_LEVEL, "adjsynth.equalizer.band_4k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_8K_LEVEL, "adjsynth.equalizer.band_8k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_BAND_16K_LEVEL, "adjsynth.equalizer.band_16k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUALIZER_PRESET, "adjsynth.equalizer.preset", _PARAM_VALUE_TYPE_INT) \
+	/* Settings - audio */ \
+	_PARAM(AUDIO_DRIVER_TYPE, "adjsynth.audio.driver_type", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AUDIO_BLOCK_SIZE, "adjsynth.audio.block_size", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AUDIO_SAMPLE_RATE, "adjsynth.audio.sample_rate", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AUDIO_JACK_AUTO_START_STATE, "adjsynth.audio_jack.auto_start_state", _PARAM_VALUE_TYPE_BOOL) \
+	_PARAM(AUDIO_JACK_MODE, "adjsynth.audio_jack.mode", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(AUDIO_JACK_AUTO_CONNECT_STATE, "adjsynth.audio_jack.auto_connect_state", _PARAM_VALUE_TYPE_BOOL) \
+	/* Preset */ \
+	_PARAM(REVERB_WIDTH, "adjsynth.reverb.width", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_31_LEVEL, "adjsynth.equilizer.band_31_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_62_LEVEL, "adjsynth.equilizer.band_62_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_125_LEVEL, "adjsynth.equilizer.band_125_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_250_LEVEL, "adjsynth.equilizer.band_250_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_500_LEVEL, "adjsynth.equilizer.band_500_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_1K_LEVEL, "adjsynth.equilizer.band_1k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_2K_LEVEL, "adjsynth.equilizer.band_2k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_4K_LEVEL, "adjsynth.equilizer.band_4k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_8K_LEVEL, "adjsynth.equilizer.band_8k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_BAND_16K_LEVEL, "adjsynth.equilizer.band_16k_level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(EQUILIZER_PRESET, "adjsynth.equilizer.preset", _PARAM_VALUE_TYPE_INT) \
+	/* Settings - mixer (per channel, channel 1 first) */ \
+	_PARAM(MIXER_CHANNEL_1_LEVEL, "adjsynth.mixer_channel_1.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_2_LEVEL, "adjsynth.mixer_channel_2.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_3_LEVEL, "adjsynth.mixer_channel_3.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_4_LEVEL, "adjsynth.mixer_channel_4.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_5_LEVEL, "adjsynth.mixer_channel_5.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_6_LEVEL, "adjsynth.mixer_channel_6.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_7_LEVEL, "adjsynth.mixer_channel_7.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_8_LEVEL, "adjsynth.mixer_channel_8.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_9_LEVEL, "adjsynth.mixer_channel_9.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_10_LEVEL, "adjsynth.mixer_channel_10.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_11_LEVEL, "adjsynth.mixer_channel_11.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_12_LEVEL, "adjsynth.mixer_channel_12.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_13_LEVEL, "adjsynth.mixer_channel_13.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_14_LEVEL, "adjsynth.mixer_channel_14.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_15_LEVEL, "adjsynth.mixer_channel_15.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_16_LEVEL, "adjsynth.mixer_channel_16.level", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_1_PAN, "adjsynth.mixer_channel_1.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_2_PAN, "adjsynth.mixer_channel_2.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_3_PAN, "adjsynth.mixer_channel_3.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_4_PAN, "adjsynth.mixer_channel_4.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_5_PAN, "adjsynth.mixer_channel_5.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_6_PAN, "adjsynth.mixer_channel_6.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_7_PAN, "adjsynth.mixer_channel_7.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_8_PAN, "adjsynth.mixer_channel_8.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_9_PAN, "adjsynth.mixer_channel_9.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_10_PAN, "adjsynth.mixer_channel_10.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_11_PAN, "adjsynth.mixer_channel_11.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_12_PAN, "adjsynth.mixer_channel_12.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_13_PAN, "adjsynth.mixer_channel_13.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_14_PAN, "adjsynth.mixer_channel_14.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_15_PAN, "adjsynth.mixer_channel_15.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_16_PAN, "adjsynth.mixer_channel_16.pan", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_1_SEND, "adjsynth.mixer_channel_1.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_2_SEND, "adjsynth.mixer_channel_2.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_3_SEND, "adjsynth.mixer_channel_3.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_4_SEND, "adjsynth.mixer_channel_4.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_5_SEND, "adjsynth.mixer_channel_5.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_6_SEND, "adjsynth.mixer_channel_6.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_7_SEND, "adjsynth.mixer_channel_7.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_8_SEND, "adjsynth.mixer_channel_8.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_9_SEND, "adjsynth.mixer_channel_9.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_10_SEND, "adjsynth.mixer_channel_10.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_11_SEND, "adjsynth.mixer_channel_11.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_12_SEND, "adjsynth.mixer_channel_12.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_13_SEND, "adjsynth.mixer_channel_13.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_14_SEND, "adjsynth.mixer_channel_14.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_15_SEND, "adjsynth.mixer_channel_15.send", _PARAM_VALUE_TYPE_INT) \
+	_PARAM(MIXER_CHANNEL_16_SEND, "adjsynth.mixer_channel_16.send", _PARAM_VALUE_TYPE_INT)
+
+typedef enum
+{
+#define _PARAM_ID_ENUM(id, name, value_type) _PARAM_ID_##id,
+	_SETTINGS_PARAMS_LIST(_PARAM_ID_ENUM)
+#undef _PARAM_ID_ENUM
+	_NUM_OF_SETTINGS_PARAM_IDS
+} settings_param_id_t;
+
+/* Parameters key names, by identifier */
+extern const char *settings_param_names[_NUM_OF_SETTINGS_PARAM_IDS];
+/* Parameters value types, by identifier */
+extern const int settings_param_value_types[_NUM_OF_SETTINGS_PARAM_IDS];
+
+#endif
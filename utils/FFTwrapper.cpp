@@ -15,48 +15,166 @@
 #include <cassert>
 #include <cstring>
 #include <pthread.h>
+#include <map>
+#include <string>
 #include <fftw3.h>
 #include "FFTwrapper.h"
 
 //namespace padfft {
 
-	static pthread_mutex_t *mutex = NULL;
+	// Serializes the FFTW planner calls (FFTW planner is not thread safe)
+	static pthread_mutex_t planner_mutex = PTHREAD_MUTEX_INITIALIZER;
+	// Protects the plans cache (never held while planning)
+	static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+	typedef struct fft_cached_plans
+	{
+		fftw_plan plan;
+		fftw_plan plan_inv;
+	} fft_cached_plans_t;
+
+	// Plans by fft size
+	static std::map<int, fft_cached_plans_t> plans_cache;
+	static std::string wisdom_file_path;
+	static bool wisdom_imported = false;
 
 FFTwrapper::FFTwrapper(int fftsize_)
 {
-	//first one will spawn the mutex (yeah this may be a race itself)
-	if(!mutex)
+	fftsize = fftsize_;
+	// FFTW aligned buffers - same alignment as the cached plans buffers
+	time = fftw_alloc_real(fftsize);
+	fft = fftw_alloc_complex(fftsize + 1);
+	get_cached_plans(fftsize, &planfftw, &planfftw_inv);
+}
+
+FFTwrapper::~FFTwrapper()
+{
+	// Plans are cached (destroyed by FFT_cleanup())
+	fftw_free(time);
+	fftw_free(fft);
+}
+
+/**
+*	@brief	Look up the cached plans of a given size.
+*	@param	size		fft size
+*	@param	plans		a pointer to the returned plans
+*	@return true if found; false otherwise
+*/
+static bool find_cached_plans(int size, fft_cached_plans_t *plans)
+{
+	std::map<int, fft_cached_plans_t>::iterator it;
+	bool found = false;
+
+	pthread_mutex_lock(&mutex);
+
+	it = plans_cache.find(size);
+	if (it != plans_cache.end())
 	{
-		mutex = new pthread_mutex_t;
-		pthread_mutex_init(mutex, NULL);
+		*plans = it->second;
+		found = true;
 	}
 
-	fftsize = fftsize_;
-	time = new fftw_real[fftsize];
-	fft = new fftw_complex[fftsize + 1];
-	pthread_mutex_lock(mutex);
-	planfftw = fftw_plan_dft_r2c_1d(fftsize,
-		time,
-		fft,
-		FFTW_ESTIMATE);
-	planfftw_inv = fftw_plan_dft_c2r_1d(fftsize,
-		fft,
-		time,
-		FFTW_ESTIMATE);
-	pthread_mutex_unlock(mutex);
+	pthread_mutex_unlock(&mutex);
+
+	return found;
 }
 
-FFTwrapper::~FFTwrapper()
+/**
+*	@brief	Create a plan pair of a given size: measured if the imported wisdom
+*			holds it, estimated otherwise. Must be called with the planner mutex locked.
+*	@param	size		fft size
+*	@param	plans		a pointer to the returned plans
+*	@return void
+*/
+static void create_plans(int size, fft_cached_plans_t *plans)
 {
-	pthread_mutex_lock(mutex);
-	fftw_destroy_plan(planfftw);
-	fftw_destroy_plan(planfftw_inv);
-	pthread_mutex_unlock(mutex);
+	fftw_real *plan_time;
+	fftw_complex *plan_fft;
 
-	delete[] time;
-	delete[] fft;
+	// Planning may overwrite the buffers - use private ones
+	plan_time = fftw_alloc_real(size);
+	plan_fft = fftw_alloc_complex(size + 1);
+
+	plans->plan = NULL;
+	plans->plan_inv = NULL;
+	if (wisdom_imported)
+	{
+		plans->plan = fftw_plan_dft_r2c_1d(size, plan_time, plan_fft, _FFT_WISDOM_PLANNER_FLAGS);
+		plans->plan_inv = fftw_plan_dft_c2r_1d(size, plan_fft, plan_time, _FFT_WISDOM_PLANNER_FLAGS);
+	}
+
+	if (plans->plan == NULL)
+	{
+		plans->plan = fftw_plan_dft_r2c_1d(size, plan_time, plan_fft, _FFT_PLANNER_FLAGS);
+	}
+
+	if (plans->plan_inv == NULL)
+	{
+		plans->plan_inv = fftw_plan_dft_c2r_1d(size, plan_fft, plan_time, _FFT_PLANNER_FLAGS);
+	}
+
+	fftw_free(plan_time);
+	fftw_free(plan_fft);
 }
 
+/**
+*	@brief	Return the cached plans of a given size, creating them on first use.
+*			Cached plans are returned without waiting for a running planning.
+*	@param	size		fft size
+*	@param	plans		a pointer to the returned plans
+*	@return void
+*/
+static void get_plans(int size, fft_cached_plans_t *plans)
+{
+	if (find_cached_plans(size, plans))
+	{
+		return;
+	}
+
+	pthread_mutex_lock(&planner_mutex);
+
+	// May have been planned while waiting
+	if (!find_cached_plans(size, plans))
+	{
+		create_plans(size, plans);
+
+		pthread_mutex_lock(&mutex);
+		plans_cache[size] = *plans;
+		pthread_mutex_unlock(&mutex);
+	}
+
+	pthread_mutex_unlock(&planner_mutex);
+}
+
+/**
+*	@brief	Return the cached plans of a given size, creating them on first use.
+*	@param	size		fft size
+*	@param	plan		a pointer to the returned forward (r2c) plan
+*	@param	plan_inv	a pointer to the returned inverse (c2r) plan
+*	@return void
+*/
+void FFTwrapper::get_cached_plans(int size, fftw_plan *plan, fftw_plan *plan_inv)
+{
+	fft_cached_plans_t plans;
+
+	get_plans(size, &plans);
+
+	*plan = plans.plan;
+	*plan_inv = plans.plan_inv;
+}
+
+/**
+*	@brief	Create and cache the plans of a given size ahead of their first use
+*			(e.g. by a background thread).
+*	@param	size	fft size
+*	@return void
+*/
+void FFT_prepare_plans(int size)
+{
+	fft_cached_plans_t plans;
+
+	get_plans(size, &plans);
+}
 
 void FFTwrapper::smps2freqs(const float *smps, fft_t *freqs)
 {
@@ -65,7 +183,7 @@ void FFTwrapper::smps2freqs(const float *smps, fft_t *freqs)
 		time[i] = static_cast<double>(smps[i]);
 
 	//DFT
-	fftw_execute(planfftw);
+	fftw_execute_dft_r2c(planfftw, time, fft);
 
 	//Grab data
 	memcpy((void *)freqs, (const void *)fft, fftsize * sizeof(double));
@@ -81,7 +199,7 @@ void FFTwrapper::freqs2smps(const fft_t *freqs, float *smps)
 	fft[fftsize / 2][1] = 0.0f;
 
 	//IDFT
-	fftw_execute(planfftw_inv);
+	fftw_execute_dft_c2r(planfftw_inv, fft, time);
 
 	//Grab data
 	for(int i = 0 ; i < fftsize ; ++i)
@@ -92,10 +210,85 @@ void FFTwrapper::freqs2smps(const fft_t *freqs, float *smps)
 
 void FFT_cleanup()
 {
+	pthread_mutex_lock(&planner_mutex);
+	pthread_mutex_lock(&mutex);
+	
+	for (std::map<int, fft_cached_plans_t>::iterator it = plans_cache.begin(); it != plans_cache.end(); ++it)
+	{
+		fftw_destroy_plan(it->second.plan);
+		fftw_destroy_plan(it->second.plan_inv);
+	}
+	plans_cache.clear();
 	fftw_cleanup();
-	pthread_mutex_destroy(mutex);
-	delete mutex;
-	mutex = NULL;
+	
+	pthread_mutex_unlock(&mutex);
+	pthread_mutex_unlock(&planner_mutex);
+}
+
+/**
+*	@brief	Set the FFTW wisdom file and import its wisdom (if exists).
+*			Plans created later are measured only if this wisdom holds them.
+*	@param	path	wisdom file path
+*	@return 0 if wisdom was imported; -1 otherwise (e.g. no file yet)
+*/
+int FFT_set_wisdom_file(const char *path)
+{
+	int res = -1;
+
+	if (path == NULL)
+	{
+		return -1;
+	}
+
+	pthread_mutex_lock(&planner_mutex);
+	
+	wisdom_file_path = path;
+	if (fftw_import_wisdom_from_filename(path))
+	{
+		wisdom_imported = true;
+		res = 0;
+	}
+	
+	pthread_mutex_unlock(&planner_mutex);
+
+	return res;
+}
+
+/**
+*	@brief	Export the accumulated FFTW wisdom to the wisdom file
+*	@param	none
+*	@return 0 if done; -1 otherwise
+*/
+int FFT_save_wisdom()
+{
+	int res = -1;
+
+	pthread_mutex_lock(&planner_mutex);
+	
+	if (!wisdom_file_path.empty() && fftw_export_wisdom_to_filename(wisdom_file_path.c_str()))
+	{
+		res = 0;
+	}
+	
+	pthread_mutex_unlock(&planner_mutex);
+
+	return res;
+}
+
+/**
+*	@brief	Return the number of cached plan sizes
+*	@param	none
+*	@return number of cached plan sizes
+*/
+int FFT_get_num_of_cached_plans()
+{
+	int num;
+
+	pthread_mutex_lock(&mutex);
+	num = (int)plans_cache.size();
+	pthread_mutex_unlock(&mutex);
+
+	return num;
 }
 
 //}// namespace
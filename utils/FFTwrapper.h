@@ -19,10 +19,19 @@
 typedef double fftw_real;
 typedef std::complex<fftw_real> fft_t;
 
+// Planner rigor of the cached plans: estimated (no measuring), or measured only
+// when the wisdom file holds the measured plan of that size
+#define _FFT_PLANNER_FLAGS			FFTW_ESTIMATE
+#define _FFT_WISDOM_PLANNER_FLAGS	(FFTW_MEASURE | FFTW_WISDOM_ONLY)
+#define _FFT_WISDOM_FILE_NAME		"fftw_wisdom.dat"
+
 
 //namespace padfft {
 
-	/** A wrapper for the FFTW library (Fast Fourier Transforms) */
+	/** A wrapper for the FFTW library (Fast Fourier Transforms).
+	 *  Plans are created once per size and cached for the process lifetime;
+	 *  each wrapper owns its buffers, so wrappers of the same size may be
+	 *  used concurrently. */
 	class FFTwrapper
 {
 public:
@@ -41,6 +50,8 @@ private:
 	fftw_real    *time;
 	fftw_complex *fft;
 	fftw_plan     planfftw, planfftw_inv;
+
+	static void get_cached_plans(int size, fftw_plan *plan, fftw_plan *plan_inv);
 }
 ;
 	
@@ -65,6 +76,11 @@ template<class _Tp>
 	
 void FFT_cleanup();
 
+int FFT_set_wisdom_file(const char *path);
+int FFT_save_wisdom();
+int FFT_get_num_of_cached_plans();
+void FFT_prepare_plans(int size);
+
 //}
 
 
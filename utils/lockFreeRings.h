@@ -0,0 +1,354 @@
+/**
+*	@file		lockFreeRings.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		Bounded lock-free rings of fixed-size records, preallocated (no
+*				allocations on push/pop). Used instead of SafeQueue on real-time paths.
+*
+*				SpscRing - wait-free, a single producer and a single consumer.
+*				MpscRing - lock-free, any number of producers and a single consumer
+*						   (per record sequence numbers).
+*
+*				Records may be written and read in place:
+*					producer: get_write_slot() - fill - commit_write_slot()
+*					consumer: get_read_slot() - use - release_read_slot()
+*				or copied by push() / pop().
+*
+*				A non real-time consumer may block until data is available or a timeout
+*				expired (wait_for_data()). Producers never block: waking a waiting
+*				consumer (futex) costs a system call only when a consumer is waiting.
+*
+*		Use: SpscRing<record_t, 256> rname;
+*/
+
+#ifndef _LOCK_FREE_RINGS
+#define _LOCK_FREE_RINGS
+
+#include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+// Producer and consumer indexes are kept on separate cache lines
+#define _LOCK_FREE_RINGS_CACHE_LINE_SIZE		64
+
+/* Lets a non real-time consumer sleep until a producer publishes a record */
+class RingWaiter
+{
+public:
+	RingWaiter(void)
+		: sequence(0)
+		, waiters(0)
+	{}
+
+	// Producer: called after a record is published.
+	void notify()
+	{
+		__atomic_add_fetch(&sequence, 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&waiters, __ATOMIC_SEQ_CST) > 0)
+		{
+			syscall(SYS_futex, &sequence, FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+		}
+	}
+
+	// Consumer: read before checking for data; then wait() with the returned value.
+	uint32_t get_sequence() { return __atomic_load_n(&sequence, __ATOMIC_SEQ_CST); }
+
+	// Consumer: sleep until notified after seq was read, or timeout (msec; < 0: no timeout).
+	void wait(uint32_t seq, int timeout_msec)
+	{
+		struct timespec timeout;
+
+		timeout.tv_sec = timeout_msec / 1000;
+		timeout.tv_nsec = (long)(timeout_msec % 1000) * 1000000L;
+
+		__atomic_add_fetch(&waiters, 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&sequence, __ATOMIC_SEQ_CST) == seq)
+		{
+			// Returns at once if the sequence was changed meanwhile
+			syscall(SYS_futex, &sequence, FUTEX_WAIT_PRIVATE, seq,
+				timeout_msec < 0 ? NULL : &timeout, NULL, 0);
+		}
+		__atomic_sub_fetch(&waiters, 1, __ATOMIC_SEQ_CST);
+	}
+
+private:
+	uint32_t sequence;
+	uint32_t waiters;
+};
+
+template <class T, uint32_t N>
+	class SpscRing
+	{
+		static_assert((N > 1) && ((N & (N - 1)) == 0), "SpscRing size must be a power of 2");
+
+	public:
+		SpscRing(void)
+			: write_index(0)
+			, read_index(0)
+			, overflows_count(0)
+		{}
+
+		// Producer: return a free record to be filled; NULL if full (counted as overflow).
+		T *get_write_slot()
+		{
+			uint32_t write = __atomic_load_n(&write_index, __ATOMIC_RELAXED);
+
+			if ((write - __atomic_load_n(&read_index, __ATOMIC_ACQUIRE)) >= N)
+			{
+				__atomic_add_fetch(&overflows_count, 1, __ATOMIC_RELAXED);
+				return NULL;
+			}
+
+			return &records[write & (N - 1)];
+		}
+
+		// Producer: publish the record returned by get_write_slot().
+		void commit_write_slot()
+		{
+			__atomic_store_n(&write_index, __atomic_load_n(&write_index, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE);
+			waiter.notify();
+		}
+
+		// Producer: copy a record in; false if full.
+		bool push(const T &rec)
+		{
+			T *slot = get_write_slot();
+
+			if (slot == NULL)
+			{
+				return false;
+			}
+
+			*slot = rec;
+			commit_write_slot();
+
+			return true;
+		}
+
+		// Consumer: return the oldest record; NULL if empty.
+		T *get_read_slot()
+		{
+			uint32_t read = __atomic_load_n(&read_index, __ATOMIC_RELAXED);
+
+			if (read == __atomic_load_n(&write_index, __ATOMIC_ACQUIRE))
+			{
+				return NULL;
+			}
+
+			return &records[read & (N - 1)];
+		}
+
+		// Consumer: free the record returned by get_read_slot().
+		void release_read_slot()
+		{
+			__atomic_store_n(&read_index, __atomic_load_n(&read_index, __ATOMIC_RELAXED) + 1, __ATOMIC_RELEASE);
+		}
+
+		// Consumer: copy the oldest record out; false if empty.
+		bool pop(T *rec)
+		{
+			T *slot = get_read_slot();
+
+			if ((slot == NULL) || (rec == NULL))
+			{
+				return false;
+			}
+
+			*rec = *slot;
+			release_read_slot();
+
+			return true;
+		}
+
+		// Consumer (non real-time): wait until a record is available or timeout (msec; < 0: no timeout).
+		bool wait_for_data(int timeout_msec)
+		{
+			uint32_t seq = waiter.get_sequence();
+
+			if (get_read_slot() != NULL)
+			{
+				return true;
+			}
+
+			waiter.wait(seq, timeout_msec);
+
+			return get_read_slot() != NULL;
+		}
+
+		// Approximate when called by a thread that is not the producer or the consumer.
+		uint32_t get_num_of_records()
+		{
+			return __atomic_load_n(&write_index, __ATOMIC_ACQUIRE) - __atomic_load_n(&read_index, __ATOMIC_ACQUIRE);
+		}
+
+		// Records dropped because the ring was full.
+		uint32_t get_overflows_count() { return __atomic_load_n(&overflows_count, __ATOMIC_RELAXED); }
+
+	private:
+		T records[N];
+
+		// Free running indexes; record = index % N
+		alignas(_LOCK_FREE_RINGS_CACHE_LINE_SIZE) uint32_t write_index;
+		alignas(_LOCK_FREE_RINGS_CACHE_LINE_SIZE) uint32_t read_index;
+
+		alignas(_LOCK_FREE_RINGS_CACHE_LINE_SIZE) uint32_t overflows_count;
+		RingWaiter waiter;
+	};
+
+template <class T, uint32_t N>
+	class MpscRing
+	{
+		static_assert((N > 1) && ((N & (N - 1)) == 0), "MpscRing size must be a power of 2");
+
+	public:
+		MpscRing(void)
+			: enqueue_position(0)
+			, dequeue_position(0)
+			, overflows_count(0)
+		{
+			for (uint32_t i = 0; i < N; i++)
+			{
+				cells[i].sequence = i;
+			}
+		}
+
+		// Producer: claim a free record to be filled; NULL if full (counted as overflow).
+		// position is set for commit_write_slot().
+		T *get_write_slot(uint32_t *position)
+		{
+			cell_t *cell;
+			uint32_t pos = __atomic_load_n(&enqueue_position, __ATOMIC_RELAXED);
+			int32_t diff;
+
+			while (true)
+			{
+				cell = &cells[pos & (N - 1)];
+				diff = (int32_t)(__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) - pos);
+
+				if (diff == 0)
+				{
+					// Free for this position - claim it
+					if (__atomic_compare_exchange_n(&enqueue_position, &pos, pos + 1,
+							true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+					{
+						*position = pos;
+						return &cell->record;
+					}
+					// pos was reloaded by the failed exchange
+				}
+				else if (diff < 0)
+				{
+					// Full
+					__atomic_add_fetch(&overflows_count, 1, __ATOMIC_RELAXED);
+					return NULL;
+				}
+				else
+				{
+					pos = __atomic_load_n(&enqueue_position, __ATOMIC_RELAXED);
+				}
+			}
+		}
+
+		// Producer: publish the record claimed by get_write_slot().
+		void commit_write_slot(uint32_t position)
+		{
+			__atomic_store_n(&cells[position & (N - 1)].sequence, position + 1, __ATOMIC_RELEASE);
+			waiter.notify();
+		}
+
+		// Producer: copy a record in; false if full.
+		bool push(const T &rec)
+		{
+			uint32_t position;
+			T *slot = get_write_slot(&position);
+
+			if (slot == NULL)
+			{
+				return false;
+			}
+
+			*slot = rec;
+			commit_write_slot(position);
+
+			return true;
+		}
+
+		// Consumer: return the oldest record; NULL if empty (or still being written).
+		T *get_read_slot()
+		{
+			cell_t *cell = &cells[dequeue_position & (N - 1)];
+
+			if (__atomic_load_n(&cell->sequence, __ATOMIC_ACQUIRE) != (dequeue_position + 1))
+			{
+				return NULL;
+			}
+
+			return &cell->record;
+		}
+
+		// Consumer: free the record returned by get_read_slot().
+		void release_read_slot()
+		{
+			// Free for the producer of the position one round ahead
+			__atomic_store_n(&cells[dequeue_position & (N - 1)].sequence, dequeue_position + N, __ATOMIC_RELEASE);
+			dequeue_position++;
+		}
+
+		// Consumer: copy the oldest record out; false if empty.
+		bool pop(T *rec)
+		{
+			T *slot = get_read_slot();
+
+			if ((slot == NULL) || (rec == NULL))
+			{
+				return false;
+			}
+
+			*rec = *slot;
+			release_read_slot();
+
+			return true;
+		}
+
+		// Consumer (non real-time): wait until a record is available or timeout (msec; < 0: no timeout).
+		bool wait_for_data(int timeout_msec)
+		{
+			uint32_t seq = waiter.get_sequence();
+
+			if (get_read_slot() != NULL)
+			{
+				return true;
+			}
+
+			waiter.wait(seq, timeout_msec);
+
+			return get_read_slot() != NULL;
+		}
+
+		// Records dropped because the ring was full.
+		uint32_t get_overflows_count() { return __atomic_load_n(&overflows_count, __ATOMIC_RELAXED); }
+
+	private:
+		typedef struct
+		{
+			uint32_t sequence;
+			T record;
+		} cell_t;
+
+		cell_t cells[N];
+
+		// Free running positions; cell = position % N
+		alignas(_LOCK_FREE_RINGS_CACHE_LINE_SIZE) uint32_t enqueue_position;
+		alignas(_LOCK_FREE_RINGS_CACHE_LINE_SIZE) uint32_t dequeue_position;
+
+		alignas(_LOCK_FREE_RINGS_CACHE_LINE_SIZE) uint32_t overflows_count;
+		RingWaiter waiter;
+	};
+
+#endif
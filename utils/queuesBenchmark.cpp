@@ -0,0 +1,215 @@
+/**
+*	@file		queuesBenchmark.cpp
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A micro-benchmark of the push/pop latency of the thread-safe queues.
+*				A producer thread pushes a number of MIDI-event sized records while the
+*				calling thread pops them; each operation is timed.
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "queuesBenchmark.h"
+#include "safeQueues.h"
+#include "lockFreeRings.h"
+
+#define _QUEUES_BENCHMARK_RING_SIZE				256
+
+typedef struct queue_benchmark_record
+{
+	uint32_t sequence;
+	uint8_t data[28];
+} queue_benchmark_record_t;
+
+typedef struct queue_benchmark_stats
+{
+	uint64_t total_ns;
+	uint64_t max_ns;
+	uint32_t count;
+	uint32_t full_count;
+} queue_benchmark_stats_t;
+
+typedef struct queue_benchmark_params
+{
+	int queue;
+	int num_of_items;
+	queue_benchmark_stats_t push_stats;
+} queue_benchmark_params_t;
+
+static SafeQueue<queue_benchmark_record_t*> benchmark_safe_queue;
+static SpscRing<queue_benchmark_record_t, _QUEUES_BENCHMARK_RING_SIZE> benchmark_spsc_ring;
+static MpscRing<queue_benchmark_record_t, _QUEUES_BENCHMARK_RING_SIZE> benchmark_mpsc_ring;
+
+/**
+*   @brief  Return a monotonic timestamp
+*   @param  none
+*   @return time in ns
+*/
+static inline uint64_t benchmark_now_ns()
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+*   @brief  Add an operation time to the statistics
+*   @param  stats	a pointer to the statistics
+*   @param	time_ns	operation time
+*   @return void
+*/
+static void benchmark_record_time(queue_benchmark_stats_t *stats, uint64_t time_ns)
+{
+	stats->total_ns += time_ns;
+	if (time_ns > stats->max_ns)
+	{
+		stats->max_ns = time_ns;
+	}
+	stats->count++;
+}
+
+/**
+*   @brief  Producer thread: push all the records into the benchmarked queue.
+*   @param  arg	a pointer to a queue_benchmark_params_t struct
+*   @return NULL
+*/
+static void *benchmark_producer_thread(void *arg)
+{
+	queue_benchmark_params_t *params = (queue_benchmark_params_t*)arg;
+	queue_benchmark_record_t record, *allocated;
+	uint64_t start_ns;
+	bool pushed;
+	int i;
+
+	for (i = 0; i < params->num_of_items; i++)
+	{
+		record.sequence = i;
+		pushed = false;
+		while (!pushed)
+		{
+			start_ns = benchmark_now_ns();
+			if (params->queue == _QUEUES_BENCHMARK_SAFE_QUEUE)
+			{
+				// As used: a record is allocated per push
+				allocated = new queue_benchmark_record_t(record);
+				benchmark_safe_queue.enqueue(allocated);
+				pushed = true;
+			}
+			else if (params->queue == _QUEUES_BENCHMARK_SPSC_RING)
+			{
+				pushed = benchmark_spsc_ring.push(record);
+			}
+			else
+			{
+				pushed = benchmark_mpsc_ring.push(record);
+			}
+
+			if (pushed)
+			{
+				benchmark_record_time(&params->push_stats, benchmark_now_ns() - start_ns);
+			}
+			else
+			{
+				params->push_stats.full_count++;
+				sched_yield();
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+*   @brief  Run the queues micro-benchmark. Not for use while the synthesizer is playing.
+*   @param  num_of_items	number of records pushed through each queue
+*							_QUEUES_BENCHMARK_MIN_NUM_OF_ITEMS to _QUEUES_BENCHMARK_MAX_NUM_OF_ITEMS
+*   @param	results			an array of _QUEUES_BENCHMARK_NUM_OF_QUEUES results
+*							(indexed _QUEUES_BENCHMARK_SAFE_QUEUE ...)
+*   @return 0 if done; -1 if parameters are out of range; -2 if a thread could not be
+*			created; -3 if records were lost or reordered
+*/
+int run_queues_benchmark(int num_of_items, queue_benchmark_result_t *results)
+{
+	queue_benchmark_params_t params;
+	queue_benchmark_stats_t pop_stats;
+	queue_benchmark_record_t record, *allocated;
+	pthread_t producer;
+	uint64_t start_ns;
+	bool popped, timeout, blocking = false;
+	int queue, i, res = 0;
+
+	if ((num_of_items < _QUEUES_BENCHMARK_MIN_NUM_OF_ITEMS) ||
+		(num_of_items > _QUEUES_BENCHMARK_MAX_NUM_OF_ITEMS) || (results == NULL))
+	{
+		return -1;
+	}
+
+	for (queue = 0; queue < _QUEUES_BENCHMARK_NUM_OF_QUEUES; queue++)
+	{
+		params.queue = queue;
+		params.num_of_items = num_of_items;
+		params.push_stats = { 0, 0, 0, 0 };
+		pop_stats = { 0, 0, 0, 0 };
+
+		if (pthread_create(&producer, NULL, benchmark_producer_thread, &params) != 0)
+		{
+			return -2;
+		}
+
+		for (i = 0; i < num_of_items; i++)
+		{
+			popped = false;
+			while (!popped)
+			{
+				start_ns = benchmark_now_ns();
+				if (queue == _QUEUES_BENCHMARK_SAFE_QUEUE)
+				{
+					allocated = benchmark_safe_queue.dequeue(0, &timeout, &blocking);
+					if (allocated != NULL)
+					{
+						record = *allocated;
+						delete allocated;
+						popped = true;
+					}
+				}
+				else if (queue == _QUEUES_BENCHMARK_SPSC_RING)
+				{
+					popped = benchmark_spsc_ring.pop(&record);
+				}
+				else
+				{
+					popped = benchmark_mpsc_ring.pop(&record);
+				}
+
+				if (popped)
+				{
+					benchmark_record_time(&pop_stats, benchmark_now_ns() - start_ns);
+					if (record.sequence != (uint32_t)i)
+					{
+						res = -3;
+					}
+				}
+				else
+				{
+					sched_yield();
+				}
+			}
+		}
+
+		pthread_join(producer, NULL);
+
+		results[queue].push_avg_ns = (uint32_t)(params.push_stats.total_ns / params.push_stats.count);
+		results[queue].push_max_ns = (uint32_t)params.push_stats.max_ns;
+		results[queue].pop_avg_ns = (uint32_t)(pop_stats.total_ns / pop_stats.count);
+		results[queue].pop_max_ns = (uint32_t)pop_stats.max_ns;
+		results[queue].push_full_count = params.push_stats.full_count;
+	}
+
+	return res;
+}
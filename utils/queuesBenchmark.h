@@ -0,0 +1,38 @@
+/**
+*	@file		queuesBenchmark.h
+*	@author		Nahum Budin
+*	@date		17-Oct-2026
+*	@version	1.0
+*
+*	@brief		A micro-benchmark of the push/pop latency of the thread-safe queues
+*				(SafeQueue, as used with allocated records, vs. the lock-free rings).
+*/
+
+#ifndef _QUEUES_BENCHMARK
+#define _QUEUES_BENCHMARK
+
+#include <stdint.h>
+
+#define _QUEUES_BENCHMARK_SAFE_QUEUE			0
+#define _QUEUES_BENCHMARK_SPSC_RING				1
+#define _QUEUES_BENCHMARK_MPSC_RING				2
+
+#define _QUEUES_BENCHMARK_NUM_OF_QUEUES			3
+
+#define _QUEUES_BENCHMARK_MIN_NUM_OF_ITEMS		1000
+#define _QUEUES_BENCHMARK_MAX_NUM_OF_ITEMS		10000000
+
+typedef struct queue_benchmark_result
+{
+	// Successful operations times (ns)
+	uint32_t push_avg_ns;
+	uint32_t push_max_ns;
+	uint32_t pop_avg_ns;
+	uint32_t pop_max_ns;
+	// Push retries on a full ring
+	uint32_t push_full_count;
+} queue_benchmark_result_t;
+
+int run_queues_benchmark(int num_of_items, queue_benchmark_result_t *results);
+
+#endif
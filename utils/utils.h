@@ -72,6 +72,37 @@ inline void sprng(prng_t p)
 	prng_state = p;
 }
 
+/**
+*   @brief  Fast float 2^x approximation (relative error < 4e-6) used in place of
+*			pow(2.0, x) in audio rate code.
+*			2^x = 2^int(x) * 2^frac(x); 2^frac(x) by a 4th order polynomial
+*			(Chebyshev nodes fit) and 2^int(x) set directly into the exponent bits.
+*   @param  x	exponent (clamped to -126.0 to 126.0)
+*   @return 2^x
+*/
+inline float fast_exp2f(float x)
+{
+	union { float f; int32_t i; } res;
+	float xi, xf;
+
+	if (x < -126.0f)
+	{
+		x = -126.0f;
+	}
+	else if (x > 126.0f)
+	{
+		x = 126.0f;
+	}
+
+	xi = floorf(x);
+	xf = x - xi;
+
+	res.f = 1.00000349f + xf * (0.692972922f + xf * (0.241604357f + xf * (0.0517449978f + xf * 0.0136703095f)));
+	res.i += (int32_t)((uint32_t)(int32_t)xi << 23);
+
+	return res.f;
+}
+
 bool is_valid_audio_driver(int driver);
 bool is_valid_sample_rate(int samp_rate);
 bool is_valid_audio_block_size(int size);